@@ -1536,6 +1536,7 @@ struct oyjlTranslation_s
   void * user_data;                    /**< @brief additional data for translator */
   void (*deAlloc)(void*);              /**< @brief custom deallocator; optional */
   int flags;                           /**< @brief flags for translator; optional */
+  void * index;                        /**< @private per locale lookup tables */
 };
 
 char *         oyjlLanguage          ( const char        * loc )
@@ -119,6 +119,211 @@ oyjl_val oyjlValueAlloc_(oyjl_type type)
     return (v);
 }
 
+/* --- lazy object key index --- */
+
+/* objects with fewer keys are searched linearly */
+#define OYJL_OBJECT_INDEX_MIN 16
+
+typedef struct oyjlObjectIndex_s {
+  char     ** keys;                    /* object arrays the index was built for */
+  oyjl_val  * values;
+  size_t      len;
+  uint32_t    mask;                    /* slots - 1 */
+  int32_t   * slot;                    /* key position or -1 */
+  uint32_t  * hash;                    /* hash of the key in slot */
+  char     ** escaped;                 /* JSON escaped keys or NULL */
+  struct oyjlObjectIndex_s * retired;  /* replaced index, which readers may still probe */
+} oyjlObjectIndex_s;
+
+static uint32_t oyjlKeyHash_         ( const char        * key )
+{
+  uint32_t h = 2166136261u;            /* FNV-1a */
+  while(*key)
+  {
+    h ^= (unsigned char)*key++;
+    h *= 16777619u;
+  }
+  return h;
+}
+
+/* free the index together with all retired ones */
+static void oyjlObjectIndexFree_     ( oyjlObjectIndex_s * idx )
+{
+  size_t i;
+  while(idx)
+  {
+    oyjlObjectIndex_s * retired = idx->retired;
+    if(idx->escaped)
+    {
+      for(i = 0; i < idx->len; ++i)
+        if(idx->escaped[i]) free(idx->escaped[i]);
+      free(idx->escaped);
+    }
+    free(idx);
+    idx = retired;
+  }
+}
+
+static oyjlObjectIndex_s * oyjlObjectIndexNew_ ( oyjl_val v )
+{
+  size_t len = v->u.object.len, i, slots = 4;
+  oyjlObjectIndex_s * idx;
+  char * mem;
+
+  while(slots < len * 2) slots *= 2;
+  mem = calloc( 1, sizeof(oyjlObjectIndex_s) + slots * (sizeof(int32_t) + sizeof(uint32_t)) );
+  if(!mem) return NULL;
+  idx = (oyjlObjectIndex_s*) mem;
+  idx->keys = v->u.object.keys;
+  idx->values = v->u.object.values;
+  idx->len = len;
+  idx->mask = slots - 1;
+  idx->slot = (int32_t*)(mem + sizeof(oyjlObjectIndex_s));
+  idx->hash = (uint32_t*)(idx->slot + slots);
+  for(i = 0; i < slots; ++i)
+    idx->slot[i] = -1;
+
+  for(i = 0; i < len; ++i)
+  {
+    const char * key = v->u.object.keys[i];
+    uint32_t h, s;
+    if(!key) continue;
+    /* path terms carry such keys in escaped form */
+    if(strpbrk(key, "[/"))
+    {
+      if(!idx->escaped)
+        idx->escaped = calloc( len, sizeof(char*) );
+      if(!idx->escaped) { oyjlObjectIndexFree_( idx ); return NULL; }
+      idx->escaped[i] = oyjlStringEscape( key, OYJL_KEY, 0 );
+      if(idx->escaped[i]) key = idx->escaped[i];
+    }
+    h = oyjlKeyHash_( key );
+    s = h & idx->mask;
+    /* keep insert order; the first of duplicate keys is found first */
+    while(idx->slot[s] != -1)
+      s = (s + 1) & idx->mask;
+    idx->slot[s] = (int32_t) i;
+    idx->hash[s] = h;
+  }
+
+  return idx;
+}
+
+/* drop the index; call before each change of the keys, values or len */
+static void oyjlObjectIndexReset_    ( oyjl_val            v )
+{
+  if(v && v->type == oyjl_t_object && v->u.object.index)
+  {
+    oyjlObjectIndexFree_( (oyjlObjectIndex_s*) v->u.object.index );
+    v->u.object.index = NULL;
+  }
+}
+
+/* @return key position, -1 - not found, -2 - no index for this object
+ *
+ * Concurrent lookups on a unchanged tree are supported with GCC atomics.
+ * A replaced index is not freed during lookups, as other readers may
+ * still probe it. It is retired into the new index and freed with the
+ * next oyjlObjectIndexReset_(), which needs exclusive access anyway. */
+static int  oyjlObjectIndexFind_     ( oyjl_val            v,
+                                       const char        * term,
+                                       const uint32_t    * term_hash )
+{
+  oyjlObjectIndex_s * idx;
+  uint32_t h, s;
+
+  if(v->u.object.len < OYJL_OBJECT_INDEX_MIN)
+    return -2;
+
+#if defined(__GNUC__)
+  idx = (oyjlObjectIndex_s*) __atomic_load_n( &v->u.object.index, __ATOMIC_ACQUIRE );
+#else
+  idx = (oyjlObjectIndex_s*) v->u.object.index;
+#endif
+
+  /* Changes to the object reset the index with oyjlObjectIndexReset_().
+   * The array check only guards against foreign changes. */
+  if(!idx || idx->keys != v->u.object.keys ||
+     idx->values != v->u.object.values || idx->len != v->u.object.len)
+  {
+    oyjlObjectIndex_s * fresh = oyjlObjectIndexNew_( v );
+    if(!fresh) return -2;
+    fresh->retired = idx;
+#if defined(__GNUC__)
+    if(__atomic_compare_exchange_n( &v->u.object.index, (void**)&idx, fresh, 0,
+                                    __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE ))
+      idx = fresh;
+    else
+    {
+      /* a other reader was faster; idx holds its index now */
+      fresh->retired = NULL;
+      oyjlObjectIndexFree_( fresh );
+    }
+#else
+    /* without atomics lookups are not thread safe */
+    v->u.object.index = fresh;
+    idx = fresh;
+#endif
+  }
+
+  h = term_hash ? *term_hash : oyjlKeyHash_( term );
+  s = h & idx->mask;
+  while(idx->slot[s] != -1)
+  {
+    int32_t pos = idx->slot[s];
+    if(idx->hash[s] == h)
+    {
+      const char * key = idx->escaped && idx->escaped[pos] ? idx->escaped[pos] : v->u.object.keys[pos];
+      if(strcmp( key, term ) == 0)
+        return pos;
+    }
+    s = (s + 1) & idx->mask;
+  }
+
+  return -1;
+}
+
+/* search a object key in path term syntax; @return position or -1
+ * Growing objects change on each insert. So OYJL_CREATE_NEW searches
+ * linearly instead of rebuilding the index each time. */
+static int  oyjlObjectFindKey_       ( oyjl_val            parent,
+                                       const char        * term,
+                                       const uint32_t    * term_hash,
+                                       int                 flags )
+{
+  int count, j;
+
+  if(!parent || parent->type != oyjl_t_object)
+    return -1;
+
+  count = parent->u.object.len;
+  /* a empty term matches to everything */
+  if(term[0] == '\000')
+    return count ? 0 : -1;
+
+  if(!(flags & OYJL_CREATE_NEW))
+  {
+    j = oyjlObjectIndexFind_( parent, term, term_hash );
+    if(j != -2)
+      return j;
+  }
+
+  for(j = 0; j < count; ++j)
+  {
+    const char * key = parent->u.object.keys[j],
+               * escaped = NULL;
+    /* search for JSON escaped key */
+    if(strpbrk(key, "[/"))
+      escaped = oyjlJsonEscape(key, OYJL_KEY);
+    if(strcmp( escaped?escaped:key, term ) == 0)
+      return j;
+    else if(*oyjl_debug > 1)
+      fprintf( stdout, OYJL_DBG_FORMAT "key:%s escaped:%s (serach)term:%s\n", OYJL_DBG_ARGS, oyjlTermColorF(oyjlITALIC,"%s",key), escaped?escaped:"----", term);
+  }
+
+  return -1;
+}
+
 static void oyjlObjectFree_(oyjl_val v)
 {
     size_t i;
@@ -143,6 +348,7 @@ static void oyjlObjectFree_(oyjl_val v)
       free((void*) v->u.object.keys);
     if(v->u.object.values)
       free(v->u.object.values);
+    oyjlObjectIndexReset_( v );
 }
 
 static void oyjlArrayFree_(oyjl_val v)
@@ -1595,27 +1801,9 @@ static oyjl_val  oyjlTreeGetValue_   ( oyjl_val            v,
     } else
     {
       /* search for name in object */
-      for(j = 0; j < count; ++j)
-      {
-        int flags_ = 0;
-        const char * key = parent->u.object.keys[j],
-                   * escaped = NULL;
-        /* search for JSON escaped key */
-        if(strpbrk(key, "[/"))
-          flags_ |= OYJL_KEY;
-        if(flags_)
-          escaped = oyjlJsonEscape(key, flags_);
-        if((parent->type == oyjl_t_object && strcmp( escaped?escaped:key, term ) == 0) ||
-            /* a empty term matches to everything */
-           term[0] == '\000')
-        {
-          found = 1;
-          level = oyjlValuePosGet( parent, j );
-          break;
-        }
-        else if(*oyjl_debug > 1)
-          fprintf( stdout, OYJL_DBG_FORMAT "key:%s escaped:%s (serach)term:%s\n", OYJL_DBG_ARGS, oyjlTermColorF(oyjlITALIC,"%s",key), escaped?escaped:"----", term);
-      }
+      j = oyjlObjectFindKey_( parent, term, NULL, flags );
+      if(j >= 0)
+        level = oyjlValuePosGet( parent, j );
 
       /* add new leave */
       if(!level &&
@@ -1637,6 +1825,7 @@ static oyjl_val  oyjlTreeGetValue_   ( oyjl_val            v,
             oyjl_val *tmp;
             char ** keys;
 
+            oyjlObjectIndexReset_( parent );
             tmp = realloc(parent->u.object.values,
                     sizeof(*(parent->u.object.values)) * (parent->u.object.len + 1));
             if (tmp == NULL)
@@ -1831,6 +2020,168 @@ oyjl_val   oyjlTreeGetValueF         ( oyjl_val            v,
   return value;
 }
 
+/* --- compiled path expressions --- */
+
+typedef enum {
+  oyjlPATH_KEY_,                       /* object key */
+  oyjlPATH_POS_,                       /* fixed position */
+  oyjlPATH_ARG_                        /* position from the index argument */
+} oyjlPATH_TERM_e;
+
+typedef struct {
+  oyjlPATH_TERM_e type;
+  int             pos;
+  uint32_t        hash;
+  char          * key;
+} oyjlPathTerm_s;
+
+struct oyjlPath_s {
+  int              n;
+  oyjlPathTerm_s * terms;
+};
+
+/** @brief   parse a path expression once for many lookups
+ *
+ *  oyjlTreeGetValue() splits the xpath into a allocated string list on
+ *  each call. A compiled path does that once and keeps object key hashes,
+ *  such that oyjlPathGetValue() runs without any allocation.
+ *
+ *  The syntax is the same as for oyjlTreeGetValue(). Additionally a
+ *  "[%d]" term takes its array position from the index argument of
+ *  oyjlPathGetValue(). That replaces the oyjlTreeGetValueF() formatting
+ *  in loops.
+ *  @code
+    oyjlPath_s * path = oyjlPathCompile( "org/freedesktop/openicc/device/monitor/[%d]/EDID_model" );
+    for(i = 0; i < n; ++i)
+    {
+      oyjl_val v = oyjlPathGetValue( root, path, &i );
+      ...
+    }
+    oyjlPathRelease( &path );
+    @endcode
+ *
+ *  @param[in]     xpath               the slashed path expression
+ *  @return                            the compiled path or zero
+ *
+ *  @version Oyjl: 1.0.0
+ *  @date    2026/10/19
+ *  @since   2026/10/19 (Oyjl: 1.0.0)
+ */
+oyjlPath_s * oyjlPathCompile         ( const char        * xpath )
+{
+  oyjlPath_s * path = NULL;
+  int n = 0, i;
+  char ** list;
+
+  if(!xpath) return path;
+
+  list = oyjlStringSplit( xpath, '/', &n, malloc );
+  if(!list) return path;
+
+  oyjlAllocHelper_m( path, oyjlPath_s, 1, malloc, goto clean );
+  oyjlAllocHelper_m( path->terms, oyjlPathTerm_s, n + 1, malloc, free(path); path = NULL; goto clean );
+  path->n = n;
+
+  for(i = 0; i < n; ++i)
+  {
+    oyjlPathTerm_s * t = &path->terms[i];
+    int pos = 0;
+    if(strcmp( list[i], "[%d]" ) == 0)
+      t->type = oyjlPATH_ARG_;
+    else
+    {
+      /* same term interpretation as in oyjlTreeGetValue_() */
+      oyjlPathTermGetIndex_( list[i], &pos );
+      if(pos != -1)
+      {
+        t->type = oyjlPATH_POS_;
+        t->pos = pos;
+      } else
+      {
+        t->type = oyjlPATH_KEY_;
+        t->key = list[i];
+        list[i] = NULL;
+        t->hash = oyjlKeyHash_( t->key );
+      }
+    }
+  }
+
+clean:
+  oyjlStringListRelease( &list, n, free );
+  return path;
+}
+
+/** @brief   obtain a node by a compiled path expression
+ *
+ *  The function does not allocate memory per lookup. Only objects with
+ *  many keys get a key hash index on their first lookup, which is reused
+ *  by later oyjlPathGetValue() and oyjlTreeGetValue() calls.
+ *
+ *  @param[in]     root                the oyjl node
+ *  @param[in]     path                from oyjlPathCompile()
+ *  @param[in]     index               positions for the "[%d]" terms in
+ *                                     order of appearance; optional
+ *  @return                            the requested node or zero
+ *
+ *  @version Oyjl: 1.0.0
+ *  @date    2026/10/19
+ *  @since   2026/10/19 (Oyjl: 1.0.0)
+ */
+oyjl_val   oyjlPathGetValue          ( oyjl_val            root,
+                                       const oyjlPath_s  * path,
+                                       const int         * index )
+{
+  oyjl_val level = root;
+  int i, arg = 0;
+
+  if(!root || !path)
+    return NULL;
+
+  for(i = 0; i < path->n && level; ++i)
+  {
+    const oyjlPathTerm_s * t = &path->terms[i];
+    int count = oyjlValueCount( level ),
+        pos;
+
+    if(count == 0)
+      return NULL;
+
+    if(t->type == oyjlPATH_KEY_)
+      pos = oyjlObjectFindKey_( level, t->key, &t->hash, 0 );
+    else if(t->type == oyjlPATH_ARG_)
+      pos = index ? index[arg++] : -1;
+    else
+      pos = t->pos;
+
+    if(0 <= pos && pos < count)
+      level = oyjlValuePosGet( level, pos );
+    else
+      level = NULL;
+  }
+
+  return level;
+}
+
+/** @brief   release a compiled path expression
+ *
+ *  @version Oyjl: 1.0.0
+ *  @date    2026/10/19
+ *  @since   2026/10/19 (Oyjl: 1.0.0)
+ */
+void       oyjlPathRelease           ( oyjlPath_s       ** path )
+{
+  oyjlPath_s * s;
+  int i;
+
+  if(!path || !*path) return;
+  s = *path;
+  for(i = 0; i < s->n; ++i)
+    if(s->terms[i].key) free(s->terms[i].key);
+  free(s->terms);
+  free(s);
+  *path = NULL;
+}
+
 /** Function oyjlTreeSetStringF
  *  @brief   set a child node to a string value
  *
@@ -2123,6 +2474,8 @@ void oyjlValueClear          (oyjl_val v)
     else if (OYJL_GET_ARRAY(v))
         oyjlArrayFree_(v);
 
+    /* a object reusing this node expects a zero index */
+    memset( &v->u, 0, sizeof(v->u) );
     v->type = oyjl_t_null;
 }
 #undef Florian_Forster_SOURCE_GUARD
@@ -2219,6 +2572,7 @@ void oyjlTreeClearValue              ( oyjl_val            root,
            {
              if( p->u.object.values[i] == o )
              {
+               oyjlObjectIndexReset_( p );
                if(p->u.object.keys[i])
                  free(p->u.object.keys[i]);
                p->u.object.keys[i] = NULL;
@@ -2472,6 +2826,12 @@ struct oyjl_tr_example_s {
   int start;                           /**< @brief loc start in catalog paths */
   int end;                             /**< @brief loc end in catalog paths */
 };
+static const char * oyjlTranslation_Lookup_ (
+                                       oyjlTranslation_s * context,
+                                       const char        * lang,
+                                       const char        * text,
+                                       int                 only_lang,
+                                       int               * indexed );
 
 /** @brief   translate string
  *
@@ -2511,7 +2871,17 @@ char *         oyjlTranslate         ( oyjlTranslation_s * context,
 
     lang = oyjlTranslation_GetLang( context );
     if(start >= 0 && end >= 0)
-      translated = oyjlTranslate2_( lang, catalog, start, end, domain, text, flags );
+    {
+      int indexed = 0;
+      /* OYJL_OBSERVE keeps the verbose catalog path */
+      if(!(flags & (OYJL_GETTEXT | OYJL_OBSERVE)) &&
+         lang && lang[0] && strcmp(lang,"C") != 0 && text[0])
+        translated = (char*) oyjlTranslation_Lookup_( context, lang, text,
+                                       end && !(flags & OYJL_NO_OPTIMISE),
+                                       &indexed );
+      if(!indexed)
+        translated = oyjlTranslate2_( lang, catalog, start, end, domain, text, flags );
+    }
   }
 
   return translated && translated[0] ? translated : (char*)text;
@@ -3205,8 +3575,214 @@ struct oyjlTranslation_s
   void * user_data;                    /**< @brief additional data for translator */
   void (*deAlloc)(void*);              /**< @brief custom deallocator; optional */
   int flags;                           /**< @brief flags for translator; optional */
+  void * index;                        /**< @private per locale lookup tables */
 };
 
+/* --- per locale translation tables --- */
+
+/* oyjlTranslate2_() formats and walks up to three catalog paths per
+ * string and scans all catalog paths for the "back" locale and for
+ * other country variants. A context keeps one hash table per used locale
+ * instead. It holds the same entries in the same priority, so a table
+ * miss is a catalog miss. Tables live until oyjlTranslation_Release(),
+ * such that returned strings stay valid as long as the catalog does. */
+typedef struct oyjlTrIndex_s {
+  struct oyjlTrIndex_s * next;
+  char      * lang;                    /* locale the table was built for */
+  int         only_lang;               /* no language/country fall backs */
+  int         n;
+  char     ** keys;                    /* source texts */
+  char     ** values;                  /* translations */
+  uint32_t    mask;                    /* slots - 1 */
+  int32_t   * slot;                    /* entry position or -1 */
+  uint32_t  * hash;                    /* hash of the key in slot */
+} oyjlTrIndex_s;
+
+static void oyjlTrIndexFree_         ( oyjlTrIndex_s     * idx )
+{
+  while(idx)
+  {
+    oyjlTrIndex_s * next = idx->next;
+    oyjlStringListRelease( &idx->keys, idx->n, free );
+    oyjlStringListRelease( &idx->values, idx->n, free );
+    if(idx->slot) free(idx->slot);
+    if(idx->hash) free(idx->hash);
+    if(idx->lang) free(idx->lang);
+    free(idx);
+    idx = next;
+  }
+}
+
+static int  oyjlTrIndexFind_         ( oyjlTrIndex_s     * idx,
+                                       const char        * key,
+                                       uint32_t            h )
+{
+  uint32_t s = h & idx->mask;
+  while(idx->slot[s] != -1)
+  {
+    int32_t pos = idx->slot[s];
+    if(idx->hash[s] == h && strcmp( idx->keys[pos], key ) == 0)
+      return pos;
+    s = (s + 1) & idx->mask;
+  }
+  return -1;
+}
+
+/* the first entry for a key wins; @return error */
+static int  oyjlTrIndexAdd_          ( oyjlTrIndex_s     * idx,
+                                       const char        * key,
+                                       const char        * value )
+{
+  uint32_t h = oyjlKeyHash_( key ), s;
+
+  if(oyjlTrIndexFind_( idx, key, h ) >= 0)
+    return 0;
+
+  s = h & idx->mask;
+  while(idx->slot[s] != -1)
+    s = (s + 1) & idx->mask;
+  idx->keys[idx->n] = oyjlStringCopy( key, 0 );
+  idx->values[idx->n] = oyjlStringCopy( value, 0 );
+  if(!idx->keys[idx->n] || !idx->values[idx->n])
+  {
+    if(idx->keys[idx->n]) { free(idx->keys[idx->n]); idx->keys[idx->n] = NULL; }
+    if(idx->values[idx->n]) { free(idx->values[idx->n]); idx->values[idx->n] = NULL; }
+    return 1;
+  }
+  idx->slot[s] = idx->n;
+  idx->hash[s] = h;
+  ++idx->n;
+  return 0;
+}
+
+static oyjlTrIndex_s * oyjlTrIndexNew_(oyjl_val            catalog,
+                                       const char        * lang,
+                                       int                 only_lang )
+{
+  const char * base = "org/freedesktop/oyjl/translations/";
+  int base_len = strlen(base), count = 0, i, pass, passes, error = 0,
+      back = strcmp(lang, "back") == 0;
+  char ** paths = oyjlTreeToPaths( catalog, 10000000, NULL, OYJL_KEY | OYJL_NO_ALLOC, &count );
+  char * language = back ? NULL : oyjlLanguage( lang ),
+       * country = back ? NULL : oyjlCountry( lang ),
+       * language_country = NULL;
+  oyjlTrIndex_s * idx = NULL;
+  size_t slots = 4;
+
+  if(language && country)
+    oyjlStringAdd( &language_country, 0,0, "%s_%s", language, country );
+
+  while(slots < (size_t)count * 2) slots *= 2;
+  oyjlAllocHelper_m( idx, oyjlTrIndex_s, 1, malloc, goto clean );
+  idx->lang = oyjlStringCopy( lang, 0 );
+  idx->only_lang = only_lang;
+  idx->mask = slots - 1;
+  oyjlAllocHelper_m( idx->keys, char*, count + 1, malloc, error = 1; goto clean );
+  oyjlAllocHelper_m( idx->values, char*, count + 1, malloc, error = 1; goto clean );
+  oyjlAllocHelper_m( idx->slot, int32_t, slots, malloc, error = 1; goto clean );
+  oyjlAllocHelper_m( idx->hash, uint32_t, slots, malloc, error = 1; goto clean );
+  for(i = 0; i < (int)slots; ++i)
+    idx->slot[i] = -1;
+
+  /* same order as the lookups in oyjlTranslate2_() */
+  passes = back ? 2 : only_lang ? 1 : 4;
+  for(pass = 0; pass < passes && !error; ++pass)
+  for(i = 0; i < count && !error; ++i)
+  {
+    const char * path = paths[i], * term, * value;
+    char * loc, * key;
+    int loc_len, match = 0;
+
+    if(strncmp( path, base, base_len ) != 0)
+      continue;
+    term = strchr( &path[base_len], '/' );
+    if(!term) continue;
+    loc_len = term - &path[base_len];
+    loc = oyjlStringAppendN( NULL, &path[base_len], loc_len, malloc );
+    ++term;
+
+    if(back)
+      match = (pass == 0) == (strcmp( loc, "back" ) == 0);
+    else if(pass == 0)
+      match = strcmp( loc, lang ) == 0;
+    else if(pass == 1)
+      match = language_country && strcmp( loc, language_country ) == 0;
+    else if(pass == 2)
+      match = language && strcmp( loc, language ) == 0;
+    else
+      match = language && strncmp( loc, language, strlen(language) ) == 0;
+    free(loc);
+    if(!match) continue;
+
+    value = oyjlTreeGetString_( catalog, 0, path );
+    if(!value) continue;
+    key = oyjlStringEscape( term, OYJL_REVERSE | OYJL_KEY, 0 );
+    if(back && pass == 1)
+      /* reverse: translation -> source text */
+      error = oyjlTrIndexAdd_( idx, value, key );
+    else
+      error = oyjlTrIndexAdd_( idx, key, value );
+    free(key);
+  }
+
+clean:
+  if(paths && count)
+  {
+    if((long)catalog->type == oyjlOBJECT_JSON)
+      free(paths);
+    else
+      oyjlStringListRelease( &paths, count, free );
+  }
+  if(language) free(language);
+  if(country) free(country);
+  if(language_country) free(language_country);
+  if(error)
+  {
+    oyjlTrIndexFree_( idx );
+    idx = NULL;
+  }
+
+  return idx;
+}
+
+/* @return the translation or NULL; *indexed is 0 without table */
+static const char * oyjlTranslation_Lookup_ (
+                                       oyjlTranslation_s * context,
+                                       const char        * lang,
+                                       const char        * text,
+                                       int                 only_lang,
+                                       int               * indexed )
+{
+  oyjlTrIndex_s * idx, * head;
+  int pos;
+
+  *indexed = 0;
+  for(idx = (oyjlTrIndex_s*) context->index; idx; idx = idx->next)
+    if(idx->only_lang == only_lang && strcmp( idx->lang, lang ) == 0)
+      break;
+
+  if(!idx)
+  {
+    idx = oyjlTrIndexNew_( context->catalog, lang, only_lang );
+    if(!idx)
+      return NULL;
+    head = (oyjlTrIndex_s*) context->index;
+#if defined(__GNUC__)
+    do {
+      idx->next = head;
+    } while(!__atomic_compare_exchange_n( &context->index, (void**)&head, idx, 0,
+                                          __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE ));
+#else
+    idx->next = head;
+    context->index = idx;
+#endif
+  }
+
+  *indexed = 1;
+  pos = oyjlTrIndexFind_( idx, text, oyjlKeyHash_( text ) );
+  return pos >= 0 ? idx->values[pos] : NULL;
+}
+
 /** @brief create i18n context 
  *
  *  The passed in catalog shall contain its translations in the
@@ -3441,6 +4017,8 @@ void       oyjlTranslation_Release   ( oyjlTranslation_s** context_ )
   if(context->lang)
     free(context->lang);
   context->lang = NULL;
+  oyjlTrIndexFree_( (oyjlTrIndex_s*) context->index );
+  context->index = NULL;
   free(context);
   context = NULL;
 
@@ -105,6 +105,7 @@ typedef struct oyjl_val_s
             char **keys; /**< @brief Array of keys */
             oyjl_val *values; /**< @brief Array of values. */
             size_t len; /**< @brief Number of key-value-pairs. */
+            void * index; /**< @private lazy key hash index; do not touch */
         } object;        /**< @brief objects with key/value pairs */
         struct {
             oyjl_val *values; /**< @brief Array of elements. */
@@ -312,6 +313,13 @@ oyjl_val   oyjlTreeGetValueF         ( oyjl_val            v,
                                        int                 flags,
                                        const char        * xformat,
                                                            ... );
+/** @brief a parsed path expression; see oyjlPathCompile() */
+typedef struct oyjlPath_s oyjlPath_s;
+oyjlPath_s * oyjlPathCompile         ( const char        * xpath );
+oyjl_val   oyjlPathGetValue          ( oyjl_val            root,
+                                       const oyjlPath_s  * path,
+                                       const int         * index );
+void       oyjlPathRelease           ( oyjlPath_s       ** path );
 int        oyjlTreeSetStringF        ( oyjl_val            root,
                                        int                 flags,
                                        const char        * value_text,
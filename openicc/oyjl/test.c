@@ -39,6 +39,7 @@
   TEST_RUN( testDataFormat, "Data Format Detection", 1 ); \
   TEST_RUN( testJson, "JSON handling", 1 ); \
   TEST_RUN( testJsonEscape, "JSON Escape handling", 1 ); \
+  TEST_RUN( testTreeIndex, "Tree index and compiled paths", 1 ); \
   TEST_RUN( testFromJson, "Data Writers", 1 ); \
   TEST_RUN( testJsonRoundtrip, "Data Readers", 1 ); \
   TEST_RUN( testUiRoundtrip, "Ui Export", 1 ); \
@@ -56,6 +57,7 @@
   TEST_RUN( testJson, "JSON handling simple", 1 ); \
   TEST_RUN( testJsonEscape, "JSON Escape handling", 1 ); \
   TEST_RUN( testJson2, "JSON handling", 1 ); \
+  TEST_RUN( testTreeIndex, "Tree index and compiled paths", 1 ); \
   TEST_RUN( testFromJson, "Data Writers", 1 ); \
   TEST_RUN( testJsonRoundtrip, "Data Readers", 1 ); \
   TEST_RUN( testUiRoundtrip, "Ui Export", 1 ); \
@@ -1693,6 +1695,154 @@ char *     oyjlTreeSerialisedPrint_  ( oyjl_val            v,
   return result;
 }
 
+oyjlTESTRESULT_e testTreeIndex ()
+{
+  oyjlTESTRESULT_e result = oyjlTESTRESULT_UNKNOWN;
+
+  fprintf(stdout, "\n" );
+
+  /* a device DB in the layout of OpenICC_device_config_DB.json */
+  oyjl_val root = oyjlTreeNew( "" );
+  int devices = 64, keys = 24, i, j, n, errors = 0;
+  double clck;
+  for(i = 0; i < devices; ++i)
+  {
+    oyjlTreeSetStringF( root, OYJL_CREATE_NEW, "EDID_", "org/freedesktop/openicc/device/monitor/[%d]/prefix", i );
+    for(j = 0; j < keys; ++j)
+      oyjlTreeSetStringF( root, OYJL_CREATE_NEW, "0.3", "org/freedesktop/openicc/device/monitor/[%d]/EDID_key_%02d", i, j );
+    oyjlTreeSetIntF( root, OYJL_CREATE_NEW, i, "org/freedesktop/openicc/device/monitor/[%d]/EDID_model", i );
+  }
+
+  n = 200;
+  clck = oyjlClock();
+  for(j = 0; j < n; ++j)
+    for(i = 0; i < devices; ++i)
+    {
+      oyjl_val v = oyjlTreeGetValueF( root, 0, "org/freedesktop/openicc/device/monitor/[%d]/EDID_model", i );
+      if(!v || v->u.number.i != i) ++errors;
+    }
+  clck = oyjlClock() - clck;
+  if( errors == 0 )
+  { PRINT_SUB_PROFILING( oyjlTESTRESULT_SUCCESS, n*devices,clck/(double)CLOCKS_PER_SEC,"key",
+    "oyjlTreeGetValueF(device DB)" );
+  } else
+  { PRINT_SUB_INT( oyjlTESTRESULT_FAIL, errors,
+    "oyjlTreeGetValueF(device DB)" );
+  }
+
+  oyjlPath_s * path = oyjlPathCompile( "org/freedesktop/openicc/device/monitor/[%d]/EDID_model" );
+  errors = 0;
+  clck = oyjlClock();
+  for(j = 0; j < n; ++j)
+    for(i = 0; i < devices; ++i)
+    {
+      oyjl_val v = oyjlPathGetValue( root, path, &i );
+      if(!v || v->u.number.i != i) ++errors;
+    }
+  clck = oyjlClock() - clck;
+  if( path && errors == 0 )
+  { PRINT_SUB_PROFILING( oyjlTESTRESULT_SUCCESS, n*devices,clck/(double)CLOCKS_PER_SEC,"key",
+    "oyjlPathGetValue(device DB)" );
+  } else
+  { PRINT_SUB_INT( oyjlTESTRESULT_FAIL, errors,
+    "oyjlPathGetValue(device DB)" );
+  }
+  oyjlPathRelease( &path );
+
+  /* a new key in a indexed object must be found */
+  oyjlTreeSetStringF( root, OYJL_CREATE_NEW, "late", "org/freedesktop/openicc/device/monitor/[3]/EDID_late" );
+  oyjl_val v = oyjlTreeGetValue( root, 0, "org/freedesktop/openicc/device/monitor/[3]/EDID_late" );
+  oyjlTreeClearValue( root, "org/freedesktop/openicc/device/monitor/[3]/EDID_key_00" );
+  oyjl_val gone = oyjlTreeGetValue( root, 0, "org/freedesktop/openicc/device/monitor/[3]/EDID_key_00" );
+  if( v && OYJL_GET_STRING(v) && strcmp(OYJL_GET_STRING(v), "late") == 0 && !gone )
+  { PRINT_SUB( oyjlTESTRESULT_SUCCESS,
+    "object index follows changes" );
+  } else
+  { PRINT_SUB( oyjlTESTRESULT_FAIL,
+    "object index follows changes" );
+  }
+  oyjlTreeFree( root ); root = NULL;
+
+  /* a removal shrinks the arrays in place and the next insert can realloc
+   * them to the same pointers and length */
+  root = oyjlTreeNew( "" );
+  for(i = 0; i < 20; ++i)
+    oyjlTreeSetStringF( root, OYJL_CREATE_NEW, "value", "obj/key_%02d", i );
+  oyjlTreeGetValue( root, 0, "obj/key_05" ); /* build the index */
+  oyjlTreeClearValue( root, "obj/key_00" );
+  oyjlTreeSetStringF( root, OYJL_CREATE_NEW, "new", "obj/key_new" );
+  errors = 0;
+  for(i = 1; i < 20; ++i)
+    if(!oyjlTreeGetValueF( root, 0, "obj/key_%02d", i )) ++errors;
+  if(!oyjlTreeGetValue( root, 0, "obj/key_new" )) ++errors;
+  if(oyjlTreeGetValue( root, 0, "obj/key_00" )) ++errors;
+  if( errors == 0 )
+  { PRINT_SUB( oyjlTESTRESULT_SUCCESS,
+    "object index after remove and insert" );
+  } else
+  { PRINT_SUB_INT( oyjlTESTRESULT_FAIL, errors,
+    "object index after remove and insert" );
+  }
+  oyjlTreeFree( root ); root = NULL;
+
+  /* translation catalogs have many keys per language object */
+  int size = sizeof(liboyjl_i18n_oiJS);
+  oyjl_val catalog = (oyjl_val) oyjlStringAppendN( NULL, (const char*) liboyjl_i18n_oiJS, size, malloc );
+  root = oyjlTreeDeSerialise( catalog, 0, size );
+  free( catalog ); catalog = NULL;
+  oyjl_val trs = oyjlTreeGetValue( root, 0, "org/freedesktop/oyjl/translations" ),
+           lang = NULL;
+  for(i = 0; i < oyjlValueCount( trs ); ++i)
+  {
+    oyjl_val l = oyjlValuePosGet( trs, i );
+    if(!lang || oyjlValueCount( l ) > oyjlValueCount( lang ))
+      lang = l;
+  }
+  int count = oyjlValueCount( lang );
+  char ** terms = NULL;
+  if(count)
+    terms = (char**) calloc( count, sizeof(char*) );
+  for(i = 0; i < count; ++i)
+  {
+    const char * key = lang->u.object.keys[i];
+    terms[i] = oyjlStringCopy( strpbrk( key, "[/" ) ? oyjlJsonEscape( key, OYJL_KEY ) : key, 0 );
+  }
+
+  errors = 0;
+  n = 20;
+  clck = oyjlClock();
+  for(j = 0; j < n; ++j)
+    for(i = 0; i < count; ++i)
+      if(!oyjlTreeGetValue( lang, 0, terms[i] ))
+        ++errors;
+  clck = oyjlClock() - clck;
+  for(i = 0; i < count; ++i)
+  {
+    v = oyjlTreeGetValue( lang, 0, terms[i] );
+    /* duplicate keys resolve to the first one */
+    if(v != lang->u.object.values[i])
+    {
+      int k = 0;
+      while(k < i && strcmp( terms[k], terms[i] ) != 0) ++k;
+      if(k == i || v != lang->u.object.values[k])
+        ++errors;
+    }
+  }
+  if( count && errors == 0 )
+  { PRINT_SUB_PROFILING( oyjlTESTRESULT_SUCCESS, n*count,clck/(double)CLOCKS_PER_SEC,"key",
+    "oyjlTreeGetValue(catalog) %d keys", count );
+  } else
+  { PRINT_SUB_INT( oyjlTESTRESULT_FAIL, errors,
+    "oyjlTreeGetValue(catalog) %d keys", count );
+  }
+
+  if(terms)
+    oyjlStringListRelease( &terms, count, free );
+  oyjlTreeFree( root );
+
+  return result;
+}
+
 oyjlTESTRESULT_e testFromJson ()
 {
   oyjlTESTRESULT_e result = oyjlTESTRESULT_UNKNOWN;
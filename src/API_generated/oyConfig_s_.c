@@ -626,6 +626,224 @@ int oyConfig_Release_( oyConfig_s_ **config )
 
 
 /* Include "Config.private_methods_definitions.c" { */
+/** @internal
+ *  @brief   the device options, which oyConfig_Match() compares
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2026/10/19
+ *  @since   2026/10/19 (Oyranos: 0.9.7)
+ */
+oyOptions_s *  oyConfig_MatchOptions_( oyConfig_s_       * device )
+{
+  if(oyOptions_Count( device->backend_core ))
+    return device->backend_core;
+  /* fall back for pure DB contructed oyConfig_s */
+  return device->db;
+}
+
+/** @internal
+ *  @brief   project options into a oyConfigMatch_s
+ *
+ *  @param[out]    match               to be released with oyConfigMatch_Clear_()
+ *  @param[in]     options             the key/value pairs
+ *  @return                            0 - good, >= 1 - error
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2026/10/19
+ *  @since   2026/10/19 (Oyranos: 0.9.7)
+ */
+int      oyConfigMatch_Set_          ( oyConfigMatch_s   * match,
+                                       oyOptions_s       * options )
+{
+  int i, n = oyOptions_Count( options );
+  oyOption_s * o;
+
+  memset( match, 0, sizeof(oyConfigMatch_s) );
+  if(!n)
+    return 0;
+
+  oyAllocHelper_m_( match->keys, char*, n, oyAllocateFunc_, return 1 );
+  oyAllocHelper_m_( match->values, char*, n, oyAllocateFunc_, oyConfigMatch_Clear_( match ); return 1 );
+  oyAllocHelper_m_( match->slots, int, n, oyAllocateFunc_, oyConfigMatch_Clear_( match ); return 1 );
+  match->n = n;
+
+  for(i = 0; i < n; ++i)
+  {
+    o = oyOptions_Get( options, i );
+    match->keys[i] = oyFilterRegistrationToText( oyOption_GetRegistration(o),
+                                                 oyFILTER_REG_MAX, 0 );
+    match->values[i] = oyOption_GetValueText( o, oyAllocateFunc_ );
+    match->slots[i] = -1;
+    oyOption_Release( &o );
+  }
+
+  return 0;
+}
+
+/** @internal
+ *  @brief   release the members of a oyConfigMatch_s
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2026/10/19
+ *  @since   2026/10/19 (Oyranos: 0.9.7)
+ */
+void     oyConfigMatch_Clear_        ( oyConfigMatch_s   * match )
+{
+  int i;
+
+  for(i = 0; i < match->n; ++i)
+  {
+    if(match->keys[i]) oyDeAllocateFunc_( match->keys[i] );
+    if(match->values[i]) oyDeAllocateFunc_( match->values[i] );
+  }
+  if(match->keys) oyDeAllocateFunc_( match->keys );
+  if(match->values) oyDeAllocateFunc_( match->values );
+  if(match->slots) oyDeAllocateFunc_( match->slots );
+  memset( match, 0, sizeof(oyConfigMatch_s) );
+}
+
+/* rank maps are copied into each DB config; compare them by content */
+static int     oyRankMapEqual_       ( const oyRankMap   * a,
+                                       const oyRankMap   * b )
+{
+  int k = 0;
+
+  if(a == b)
+    return 1;
+  if(!a || !b)
+    return 0;
+
+  while(a[k].key && b[k].key)
+  {
+    if(a[k].match_value != b[k].match_value ||
+       a[k].none_match_value != b[k].none_match_value ||
+       a[k].not_found_value != b[k].not_found_value ||
+       strcmp( a[k].key, b[k].key ) != 0)
+      return 0;
+    ++k;
+  }
+
+  return !a[k].key && !b[k].key;
+}
+
+/* resolve each key to its rank map entry */
+static void    oyConfigMatch_Compile_( oyConfigMatch_s   * match,
+                                       const oyRankMap   * rank_map )
+{
+  int i, k;
+
+  if(match->rank_map == rank_map ||
+     (match->rank_map && oyRankMapEqual_( match->rank_map, rank_map )))
+    return;
+
+  for(i = 0; i < match->n; ++i)
+  {
+    match->slots[i] = -1;
+    k = 0;
+    while(rank_map && match->keys[i] && rank_map[k].key)
+    {
+      if(oyStrcmp_(rank_map[k].key, match->keys[i]) == 0)
+      {
+        match->slots[i] = k;
+        break;
+      }
+      ++k;
+    }
+  }
+  match->rank_map = rank_map;
+}
+
+/** @internal
+ *  @brief   rank device against pattern
+ *
+ *  The rules are the ones of oyConfig_Match(). Pattern keys are found by
+ *  sub string and the first such key decides. The device projection keeps
+ *  its rank map slots for the next call with a equal rank_map.
+ *
+ *  @param[in,out] device              the device projection
+ *  @param[in]     pattern             the pattern projection
+ *  @param[in]     rank_map            the rank map; optional
+ *  @param         path_separator      a char to split into hierarchical levels
+ *  @param         key_separator       a char to split key strings
+ *  @param         flags               OY_MATCH_SUB_STRING
+ *  @return                            the rank value
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2026/10/19
+ *  @since   2026/10/19 (Oyranos: 0.9.7)
+ */
+int32_t  oyConfigMatch_Rank_         ( oyConfigMatch_s   * device,
+                                       oyConfigMatch_s   * pattern,
+                                       const oyRankMap   * rank_map,
+                                       char                path_separator,
+                                       char                key_separator,
+                                       int                 flags )
+{
+  int32_t rank = 0;
+  int i, j, slot, has_opt, match;
+  const char * d_opt, * d_val, * p_val;
 
+  oyConfigMatch_Compile_( device, rank_map );
+
+  for(i = 0; i < device->n; ++i)
+  {
+    d_opt = device->keys[i];
+    d_val = device->values[i];
+    slot = rank_map ? device->slots[i] : -1;
+    has_opt = 0;
+
+    if(d_val && d_opt)
+    for(j = 0; j < pattern->n; ++j)
+    {
+      if(!pattern->keys[j] || !oyStrstr_(pattern->keys[j], d_opt))
+        continue;
+
+      p_val = pattern->values[j];
+      has_opt = 1;
+
+      if(flags & OY_MATCH_SUB_STRING)
+        match = oyFilterStringMatch( d_val, p_val, oyOBJECT_NONE,
+                                     path_separator, key_separator, flags );
+      else
+        /* equal non empty texts match without splitting */
+        match = (p_val && d_val[0] && strcmp( d_val, p_val ) == 0) ||
+                oyTextIccDictMatch( d_val, p_val, 0.0005,
+                                    path_separator, key_separator );
+
+      if(match)
+      {
+        if(!rank_map)
+          ++rank;
+        else if(slot >= 0)
+        {
+          if(oy_debug)
+            DBG_PROG5_S( "match_value[%s]: %s - %s %d+%d",
+                         d_opt, d_val, oyNoEmptyString_m_(p_val),
+                         rank, rank_map[slot].match_value );
+          rank += rank_map[slot].match_value;
+        }
+      } else if(slot >= 0)
+      {
+        if(oy_debug)
+          DBG_PROG5_S( "none_match_value[%s]: %s - %s %d+%d",
+                       d_opt, d_val, oyNoEmptyString_m_(p_val),
+                       rank, rank_map[slot].none_match_value );
+        rank += rank_map[slot].none_match_value;
+      }
+      break;
+    }
+
+    if(!has_opt && slot >= 0)
+    {
+      if(oy_debug)
+        DBG_NUM4_S( "not_found_value[%s]: %s %d+%d\n",
+                    d_opt, oyNoEmptyString_m_(d_val),
+                    rank, rank_map[slot].not_found_value );
+      rank += rank_map[slot].not_found_value;
+    }
+  }
+
+  return rank;
+}
 /* } Include "Config.private_methods_definitions.c" */
 
@@ -28,6 +28,7 @@
 
 #include "oyranos_module_internal.h"
 #include "oyCMMapiFilters_s.h"
+#include "oyConnectorImaging_s.h"
 #include "oyFilterGraph_s.h"
 #include "oyFilterPlug_s_.h"
 #include "oyFilterNode_s_.h"
@@ -35,6 +36,7 @@
 #include "oyImage_s_.h"
 #include "oyCMMapi9_s_.h"
 #include "oyPixelAccess_s_.h"
+#include "oyranos_color.h"
   
 
 
@@ -222,6 +224,102 @@ int                oyConversion_Correct (
   return error;
 }
 
+/* Find a pixel layout, which a filter connector can consume. A unchanged
+ * layout means, the filter can process the pixels directly. */
+static oyPixel_t   oyConversion_FitPixelLayout_ (
+                                       oyPixel_t           layout,
+                                       oyConnectorImaging_s * pattern )
+{
+  oyPixel_t fit = layout;
+  const oyDATATYPE_e * data_types = NULL;
+  int data_types_n = 0, i, j, found = 0, max_coff;
+  oyDATATYPE_e data_type = oyToDataType_m( layout );
+
+  oyConnectorImaging_GetDataTypes( pattern, &data_types, &data_types_n );
+  for(i = 0; i < data_types_n; ++i)
+    if(data_types[i] == data_type)
+      found = 1;
+  if(data_types_n && !found)
+  {
+    /* select the most precise data type of the connector */
+    const oyDATATYPE_e precise[6] = { oyFLOAT, oyDOUBLE, oyUINT16, oyHALF,
+                                      oyUINT32, oyUINT8 };
+    for(j = 0; j < 6 && !found; ++j)
+      for(i = 0; i < data_types_n; ++i)
+        if(data_types[i] == precise[j])
+        {
+          fit = (fit & ~(oyPixel_t)oyDataType_m(15)) |
+                oyDataType_m(precise[j]);
+          found = 1;
+          break;
+        }
+  }
+
+  if(oyToPlanar_m( fit ) &&
+     !oyConnectorImaging_GetCapability( pattern, oyCONNECTOR_IMAGING_CAP_CAN_PLANAR ))
+    fit &= ~(oyPixel_t)OY_PLANAR;
+  if(!oyToPlanar_m( fit ) &&
+     !oyConnectorImaging_GetCapability( pattern, oyCONNECTOR_IMAGING_CAP_CAN_INTERWOVEN ))
+    fit |= OY_PLANAR;
+  if(oyToSwapColorChannels_m( fit ) &&
+     !oyConnectorImaging_GetCapability( pattern, oyCONNECTOR_IMAGING_CAP_CAN_SWAP ))
+    fit &= ~(oyPixel_t)OY_SWAP_COLOR_CHANNELS;
+  if(oyToByteswap_m( fit ) &&
+     !oyConnectorImaging_GetCapability( pattern, oyCONNECTOR_IMAGING_CAP_CAN_SWAP_BYTES ))
+    fit &= ~(oyPixel_t)OY_BYTESWAPED;
+  max_coff = oyConnectorImaging_GetCapability( pattern,
+                                    oyCONNECTOR_IMAGING_CAP_MAX_COLOR_OFFSET );
+  if(max_coff >= 0 && (int)oyToColorOffset_m( fit ) > max_coff)
+    fit &= ~(oyPixel_t)oyColorOffset_m(255);
+
+  return fit;
+}
+
+/* Create a intermediate image, which the nodes plug or socket can consume.
+ * Return NULL, if the node handles the image layout itself. */
+static oyImage_s * oyConversion_FitImage_ (
+                                       oyImage_s         * image,
+                                       oyFilterNode_s    * node,
+                                       int                 is_plug,
+                                       oyObject_s          object )
+{
+  oyConnectorImaging_s * pattern = (oyConnectorImaging_s*)
+                                oyFilterNode_ShowConnector( node, 0, is_plug );
+  oyPixel_t layout = oyImage_GetPixelLayout( image, oyLAYOUT ),
+            fit = layout;
+  oyImage_s * fitted = NULL;
+  int premultiplied = 0, i,
+      channels_n = oyToChannels_m( layout );
+
+  if(!pattern || pattern->type_ != oyOBJECT_CONNECTOR_IMAGING_S || !layout)
+  {
+    oyConnectorImaging_Release( &pattern );
+    return NULL;
+  }
+
+  fit = oyConversion_FitPixelLayout_( layout, pattern );
+
+  for(i = 0; i < channels_n; ++i)
+    if(oyImage_GetChannelType( image, i ) ==
+       oyCHANNELTYPE_COLOR_LIGHTNESS_PREMULTIPLIED)
+      premultiplied = 1;
+  if(premultiplied &&
+     oyConnectorImaging_GetCapability( pattern, oyCONNECTOR_IMAGING_CAP_CAN_PREMULTIPLIED_ALPHA ))
+    premultiplied = 0;
+
+  if(fit != layout || premultiplied)
+  {
+    oyProfile_s * p = oyImage_GetProfile( image );
+    fitted = oyImage_Create( oyImage_GetWidth( image ),
+                             oyImage_GetHeight( image ), NULL, fit, p, object );
+    oyProfile_Release( &p );
+  }
+
+  oyConnectorImaging_Release( &pattern );
+
+  return fitted;
+}
+
 /** Function  oyConversion_CreateBasicPixels
  *  @memberof oyConversion_s
  *  @brief    Allocate and initialise a basic oyConversion_s object
@@ -250,8 +348,14 @@ int                oyConversion_Correct (
  *  @param         object              the optional object
  *  @return                            the conversion context
  *
- *  @version Oyranos: 0.9.6
- *  @date    2014/06/29
+ *  A "//" OY_TYPE_STD "/layout" node is placed before or after the icc node,
+ *  when the icc module can not consume the input or output pixel layout,
+ *  e.g. for not supported data types, planar or byte swapped samples or
+ *  premultiplied alpha. Otherwise the icc module handles the layout itself
+ *  and no extra node is created.
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2026/10/19
  *  @since   2008/06/26 (Oyranos: 0.1.8)
  */
 oyConversion_s   * oyConversion_CreateBasicPixels (
@@ -262,7 +366,9 @@ oyConversion_s   * oyConversion_CreateBasicPixels (
 {
   oyConversion_s * s = 0;
   int error = !input || !output;
-  oyFilterNode_s * in = 0, * out = 0, * a[3] = {NULL,NULL,NULL};
+  oyFilterNode_s * in = 0, * out = 0,
+                 * a[5] = {NULL,NULL,NULL,NULL,NULL};
+  oyImage_s * fitted_in = NULL, * fitted_out = NULL;
 
   if(error <= 0)
   {
@@ -279,15 +385,48 @@ oyConversion_s   * oyConversion_CreateBasicPixels (
     if(error <= 0)
       a[2] = out = oyFilterNode_FromOptions( OY_CMM_STD, "//" OY_TYPE_STD "/icc_color", options, object );
     if(error <= 0)
-      error = oyFilterNode_SetData( out, (oyStruct_s*)output, 0, 0 );
+    {
+      fitted_in = oyConversion_FitImage_( input, out, 1, object );
+      fitted_out = oyConversion_FitImage_( output, out, 0, object );
+    }
+
+    /* convert input pixels, which the icc node can not consume */
+    if(error <= 0 && fitted_in)
+    {
+      a[1] = oyFilterNode_NewWith( "//" OY_TYPE_STD "/layout", options, 0 );
+      error = !a[1];
+      if(error <= 0)
+        error = oyFilterNode_SetData( a[1], (oyStruct_s*)fitted_in, 0, 0 );
+      if(error <= 0)
+        error = oyFilterNode_Connect( in, "//" OY_TYPE_STD "/data",
+                                      a[1], "//" OY_TYPE_STD "/data", 0 );
+      in = a[1];
+    }
+
+    if(error <= 0)
+      error = oyFilterNode_SetData( out, fitted_out ? (oyStruct_s*)fitted_out :
+                                         (oyStruct_s*)output, 0, 0 );
     if(error <= 0)
       error = oyFilterNode_Connect( in, "//" OY_TYPE_STD "/data",
                                     out, "//" OY_TYPE_STD "/data", 0 );
 
     in = out; out = 0;
 
+    /* convert the icc node pixels into the output layout */
+    if(error <= 0 && fitted_out)
+    {
+      a[3] = out = oyFilterNode_NewWith( "//" OY_TYPE_STD "/layout", options, 0 );
+      error = !out;
+      if(error <= 0)
+        error = oyFilterNode_SetData( out, (oyStruct_s*)output, 0, 0 );
+      if(error <= 0)
+        error = oyFilterNode_Connect( in, "//" OY_TYPE_STD "/data",
+                                      out, "//" OY_TYPE_STD "/data", 0 );
+      in = out; out = 0;
+    }
+
     if(error <= 0)
-      a[2] = out = oyFilterNode_NewWith( "//" OY_TYPE_STD "/output", options, 0 );
+      a[4] = out = oyFilterNode_NewWith( "//" OY_TYPE_STD "/output", options, 0 );
     if(error <= 0)
     {
       error = oyFilterNode_Connect( in, "//" OY_TYPE_STD "/data",
@@ -299,10 +438,13 @@ oyConversion_s   * oyConversion_CreateBasicPixels (
       error = oyConversion_Set( s, 0, out );
   }
 
+  oyImage_Release( &fitted_in );
+  oyImage_Release( &fitted_out );
+
   if(error)
   {
     int i;
-    for( i = 2; i >= 0; --i )
+    for( i = 4; i >= 0; --i )
       oyFilterNode_Release( &a[i] );
     oyConversion_Release ( &s );
   }
@@ -500,6 +642,243 @@ oyConversion_s * oyConversion_CreateFromImage (
   return conversion;
 }
 
+/* width and height of the sample image inside a gamut check context */
+#define OY_GAMUT_CHECK_WIDTH 128
+#define OY_GAMUT_CHECK_PROOF OY_TOP_SHARED OY_SLASH OY_DOMAIN_INTERNAL OY_SLASH OY_TYPE_STD OY_SLASH "gamut_check/proof"
+
+/** Function  oyConversion_CreateGamutCheck
+ *  @memberof oyConversion_s
+ *  @brief    Reusable context for batched gamut checks
+ *
+ *  The context converts from a Lab or XYZ space into Lab while soft
+ *  proofing and marking out of gamut colors. A second, proof only
+ *  conversion for the color distances is attached. Both are prepared
+ *  once and evaluate many sample batches through oyConversion_GamutCheck().
+ *
+ *  While it is possible to add multiple proofing profiles at once,
+ *  the results will be washed out. Use one context per proofing profile
+ *  for precise results.
+ *
+ *  The context holds one sample image for its conversions and is not
+ *  reentrant. Use one context per thread for concurrent checks.
+ *
+ *  @param[in]     space               the sample color space, Lab or XYZ; optional, default Lab
+ *  @param[in]     proofing            the proofing profiles
+ *  @param[in]     options             additional options for the icc node; optional
+ *  @param[in]     obj                 Oyranos object (optional)
+ *  @return                            the gamut check context
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2026/10/19
+ *  @since   2026/10/19 (Oyranos: 0.9.7)
+ */
+oyConversion_s *   oyConversion_CreateGamutCheck (
+                                       oyProfile_s       * space,
+                                       oyProfiles_s      * proofing,
+                                       oyOptions_s       * options,
+                                       oyObject_s          obj )
+{
+  int icc_profile_flags = 0, w = OY_GAMUT_CHECK_WIDTH, error;
+  oyPixel_t layout = oyChannels_m(3) | oyDataType_m(oyDOUBLE);
+  oyProfile_s * p_lab, * p_in;
+  oyProfiles_s * profs = oyProfiles_Copy( proofing, NULL );
+  oyOptions_s * opts = oyOptions_Copy( options, NULL );
+  oyImage_s * in = NULL, * out = NULL, * proof_out = NULL;
+  oyConversion_s * s = NULL, * proof = NULL;
+  icColorSpaceSignature csp;
+
+  oyOptions_FindInt( options, "icc_profile_flags", 0, &icc_profile_flags );
+  p_lab = oyProfile_FromStd( oyASSUMED_LAB, icc_profile_flags, NULL );
+  p_in = space ? oyProfile_Copy( space, NULL ) : oyProfile_Copy( p_lab, NULL );
+  csp = (icColorSpaceSignature) oyProfile_GetSignature( p_in, oySIGNATURE_COLOR_SPACE );
+
+  error = !p_lab || !oyProfiles_Count( proofing ) ||
+          (csp != icSigLabData && csp != icSigXYZData);
+  if(error)
+    WARNc1_S( "need Lab or XYZ samples and proofing profiles: %s",
+              oyProfile_GetText( p_in, oyNAME_DESCRIPTION ) );
+
+  if(!error)
+  {
+    oyOptions_SetFromString( &opts, OY_DEFAULT_RENDERING_INTENT, "1", OY_CREATE_NEW );
+    oyOptions_SetFromString( &opts, OY_DEFAULT_RENDERING_BPC, "0", OY_CREATE_NEW );
+    oyOptions_MoveInStruct( &opts, OY_PROFILES_SIMULATION,
+                            (oyStruct_s**) &profs, OY_CREATE_NEW );
+    oyOptions_SetFromString( &opts, OY_DEFAULT_PROOF_SOFT, "1", OY_CREATE_NEW );
+    oyOptions_SetFromString( &opts, OY_DEFAULT_RENDERING_INTENT_PROOF, "3", OY_CREATE_NEW );
+
+    /* both conversions share the sample image */
+    in        = oyImage_Create( w, w, NULL, layout, p_in, obj );
+    out       = oyImage_Create( w, w, NULL, layout, p_lab, obj );
+    proof_out = oyImage_Create( w, w, NULL, layout, p_lab, obj );
+
+    proof = oyConversion_CreateBasicPixels( in, proof_out, opts, obj );
+    /* The gamut warning expands the grid size and slows the context creation
+     * down. However, it is needed for precise enough output. */
+    oyOptions_SetFromString( &opts, OY_DEFAULT_RENDERING_GAMUT_WARNING, "1", OY_CREATE_NEW );
+    s = oyConversion_CreateBasicPixels( in, out, opts, obj );
+    error = !s || !proof;
+  }
+
+  if(!error)
+    error = oyOptions_MoveInStruct( &s->oy_->handles_, OY_GAMUT_CHECK_PROOF,
+                                    (oyStruct_s**) &proof, OY_CREATE_NEW );
+  if(error)
+    oyConversion_Release( &s );
+
+  oyConversion_Release( &proof );
+  oyImage_Release( &in );
+  oyImage_Release( &out );
+  oyImage_Release( &proof_out );
+  oyOptions_Release( &opts );
+  oyProfiles_Release( &profs );
+  oyProfile_Release( &p_in );
+  oyProfile_Release( &p_lab );
+
+  return s;
+}
+
+static int oyIsGamutMarker_          ( const double        lab[],
+                                       double              delta )
+{
+  return fabs(lab[0] - 0.5) < delta &&
+         fabs(lab[1] - 0.5) < delta &&
+         fabs(lab[2] - 0.5) < delta;
+}
+
+/** Function  oyConversion_GamutCheck
+ *  @memberof oyConversion_s
+ *  @brief    Check a batch of colors against a gamut check context
+ *
+ *  The samples are pushed in blocks through the prepared conversions of
+ *  oyConversion_CreateGamutCheck(). Only the requested results are
+ *  computed; the color distances need a second conversion run.
+ *  A partial block is converted as a whole; small batches should be
+ *  collected for throughput. Calls on the same context must not overlap.
+ *
+ *  @param[in]     gamut_check         the context from oyConversion_CreateGamutCheck()
+ *  @param[in]     colors              count * 3 samples in ICC double encoding of the context space
+ *  @param[in]     count               number of samples
+ *  @param[out]    is_outside          count flags, 1 for out of gamut; optional
+ *  @param[out]    dE                  count CIE *Lab distances between sample and proof; optional
+ *  @return                            number of out of gamut samples, or -1 for error
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2026/10/19
+ *  @since   2026/10/19 (Oyranos: 0.9.7)
+ */
+int                oyConversion_GamutCheck (
+                                       oyConversion_s    * gamut_check,
+                                       const double      * colors,
+                                       int                 count,
+                                       int               * is_outside,
+                                       double            * dE )
+{
+  oyConversion_s_ * s = (oyConversion_s_*)gamut_check;
+  oyConversion_s * proof = NULL;
+  oyOption_s * o = NULL;
+  oyProfile_s * p_in;
+  oyImage_s * in = NULL, * out = NULL, * proof_out = NULL;
+  oyArray2d_s * a_in = NULL, * a_out = NULL, * a_proof = NULL;
+  double ** in_rows = NULL, ** out_rows = NULL, ** proof_rows = NULL;
+  const double xyz_factor = 1.0 + 32767.0/32768.0;
+  int w = OY_GAMUT_CHECK_WIDTH, chunk = w * w, start, outside = 0, is_xyz,
+      error = !colors || count < 0;
+
+  oyCheckType__m( oyOBJECT_CONVERSION_S, return -1 )
+
+  if(error)
+    return -1;
+
+  in = oyConversion_GetImage( gamut_check, OY_INPUT );
+  out = oyConversion_GetImage( gamut_check, OY_OUTPUT );
+  p_in = oyImage_GetProfile( in );
+  is_xyz = oyProfile_GetSignature( p_in, oySIGNATURE_COLOR_SPACE ) == icSigXYZData;
+  oyProfile_Release( &p_in );
+  a_in = (oyArray2d_s*) oyImage_GetPixelData( in );
+  a_out = (oyArray2d_s*) oyImage_GetPixelData( out );
+  in_rows = (double**) oyArray2d_GetData( a_in );
+  out_rows = (double**) oyArray2d_GetData( a_out );
+  if(dE)
+  {
+    o = oyOptions_Find( s->oy_->handles_, OY_GAMUT_CHECK_PROOF, oyNAME_PATTERN );
+    proof = (oyConversion_s*) oyOption_GetStruct( o, oyOBJECT_CONVERSION_S );
+    proof_out = oyConversion_GetImage( proof, OY_OUTPUT );
+    a_proof = (oyArray2d_s*) oyImage_GetPixelData( proof_out );
+    proof_rows = (double**) oyArray2d_GetData( a_proof );
+  }
+  error = !in_rows || !out_rows || (dE && !proof_rows);
+
+  for(start = 0; start < count && !error; start += chunk)
+  {
+    int n = count - start < chunk ? count - start : chunk,
+        lines = (n + w - 1) / w, i, y;
+
+    for(y = 0; y < lines; ++y)
+    {
+      int x_n = y == lines - 1 ? n - y * w : w;
+      memcpy( in_rows[y], &colors[(start + y * w) * 3], x_n * 3 * sizeof(double) );
+    }
+
+    if(is_outside && oyConversion_RunPixels( gamut_check, NULL ) > 0)
+      error = 1;
+    if(dE && !error && oyConversion_RunPixels( proof, NULL ) > 0)
+      error = 1;
+    if(error)
+      break;
+
+#if defined(USE_OPENMP)
+#pragma omp parallel for reduction(+:outside)
+#endif
+    for(i = 0; i < n; ++i)
+    {
+      const double * c = &colors[(start + i) * 3];
+      double lab[3], icc_lab[3], proofed[3];
+
+      if(is_xyz)
+      {
+        double XYZ[3] = { c[0] * xyz_factor, c[1] * xyz_factor, c[2] * xyz_factor };
+        oyXYZ2Lab( XYZ, lab );
+        oyCIE2IccLab( lab, icc_lab, NULL );
+      } else
+      {
+        icc_lab[0] = c[0]; icc_lab[1] = c[1]; icc_lab[2] = c[2];
+        oyIcc2CIELab( c, lab, NULL );
+      }
+
+      if(is_outside)
+      {
+        /* samples near the marker color itself count as inside */
+        is_outside[start + i] =
+                    oyIsGamutMarker_( &out_rows[i / w][(i % w) * 3], 0.01 ) &&
+                    !oyIsGamutMarker_( icc_lab, 0.03 );
+        outside += is_outside[start + i];
+      }
+
+      if(dE)
+      {
+        oyIcc2CIELab( &proof_rows[i / w][(i % w) * 3], proofed, NULL );
+        dE[start + i] = sqrt( (lab[0] - proofed[0]) * (lab[0] - proofed[0]) +
+                              (lab[1] - proofed[1]) * (lab[1] - proofed[1]) +
+                              (lab[2] - proofed[2]) * (lab[2] - proofed[2]) );
+      }
+    }
+  }
+
+  oyArray2d_Release( &a_in );
+  oyArray2d_Release( &a_out );
+  oyArray2d_Release( &a_proof );
+  oyImage_Release( &in );
+  oyImage_Release( &out );
+  oyImage_Release( &proof_out );
+  oyConversion_Release( &proof );
+  oyOption_Release( &o );
+
+  if(error)
+    return -1;
+  return outside;
+}
+
 /** Function  oyConversion_GetGraph
  *  @memberof oyConversion_s
  *  @brief    Get the filter graph from a conversion context
@@ -695,6 +1074,91 @@ int          oyConversion_GetOnePixel( oyConversion_s    * conversion,
   return error;
 }
 
+/** Function  oyConversion_GetStats
+ *  @memberof oyConversion_s
+ *  @brief    Collect the hot path counters of all nodes as JSON
+ *
+ *  The nodes count runs, pixels, run time, context creation time and
+ *  context cache hits and misses, when ::OY_STATS is set in the environment.
+ *  Otherwise all counters stay zero. The run time of a node includes the
+ *  time of its upstream nodes.
+ *
+ *  @code
+    {
+      "enabled": 1,
+      "nodes": [{
+          "id": 25,
+          "registration": "org/freedesktop/openicc/icc_color/lcm2._icc...",
+          "runs": 4,
+          "pixels": 1048576,
+          "run_seconds": 0.0213,
+          "contexts": 1,
+          "context_seconds": 0.0121,
+          "cache_hits": 0,
+          "cache_misses": 1
+        }]
+    } @endcode
+ *
+ *  @param[in,out] conversion          conversion object
+ *  @param[in]     flags               0x01 - reset the counters after reading
+ *  @param[in]     allocateFunc        user allocator
+ *  @return                            JSON text
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2026/10/19
+ *  @since   2026/10/19 (Oyranos: 0.9.7)
+ */
+OYAPI char *  OYEXPORT
+                oyConversion_GetStats (
+                                       oyConversion_s    * conversion,
+                                       int                 flags,
+                                       oyAlloc_f           allocateFunc )
+{
+  oyConversion_s_ * s = (oyConversion_s_*)conversion;
+  oyFilterGraph_s * graph;
+  oyjl_val root;
+  char * json = NULL, * text;
+  int i, n;
+
+  oyCheckType__m( oyOBJECT_CONVERSION_S, return NULL )
+
+  graph = oyConversion_GetGraph( conversion );
+  n = oyFilterGraph_CountNodes( graph, "", NULL );
+  root = oyjlTreeNew( "" );
+  oyjlTreeSetIntF( root, OYJL_CREATE_NEW, oy_stats, "enabled" );
+  for(i = 0; i < n; ++i)
+  {
+    oyFilterNode_s_ * node = (oyFilterNode_s_*) oyFilterGraph_GetNode( graph, i, "", NULL );
+    oyFilterNodeStats_s * st = &node->stats_;
+
+    oyjlTreeSetIntF( root, OYJL_CREATE_NEW, oyFilterNode_GetId( (oyFilterNode_s*)node ), "nodes/[%d]/id", i );
+    oyjlTreeSetStringF( root, OYJL_CREATE_NEW, node->core->registration_, "nodes/[%d]/registration", i );
+    oyjlTreeSetIntF( root, OYJL_CREATE_NEW, st->runs, "nodes/[%d]/runs", i );
+    oyjlTreeSetIntF( root, OYJL_CREATE_NEW, st->pixels, "nodes/[%d]/pixels", i );
+    oyjlTreeSetDoubleF( root, OYJL_CREATE_NEW, st->run_usec/1000000.0, "nodes/[%d]/run_seconds", i );
+    oyjlTreeSetIntF( root, OYJL_CREATE_NEW, st->contexts, "nodes/[%d]/contexts", i );
+    oyjlTreeSetDoubleF( root, OYJL_CREATE_NEW, st->context_usec/1000000.0, "nodes/[%d]/context_seconds", i );
+    oyjlTreeSetIntF( root, OYJL_CREATE_NEW, st->cache_hits, "nodes/[%d]/cache_hits", i );
+    oyjlTreeSetIntF( root, OYJL_CREATE_NEW, st->cache_misses, "nodes/[%d]/cache_misses", i );
+
+    if(flags & 0x01)
+      memset( st, 0, sizeof(*st) );
+
+    oyFilterNode_Release( (oyFilterNode_s**)&node );
+  }
+
+  text = oyjlTreeToText( root, OYJL_JSON | OYJL_NO_MARKUP );
+  if(text)
+  {
+    json = oyStringCopy( text, allocateFunc );
+    free( text );
+  }
+  oyjlTreeFree( root );
+  oyFilterGraph_Release( &graph );
+
+  return json;
+}
+
 /** Function  oyConversion_RunPixels
  *  @memberof oyConversion_s
  *  @brief    Process a pixel conversion graph
@@ -811,9 +1275,12 @@ int                oyConversion_RunPixels (
     DBGs_PROG2_S( pixel_access_, "Run: node_out[%d] image_out[%d]",
                  oyStruct_GetId((oyStruct_s*)node_out),
                  oyStruct_GetId((oyStruct_s*)image_out) );
-    if(oy_debug) clck = oyClock();
+    if(oy_debug || oy_stats) clck = oyClock();
     error = oyFilterNodePriv_m(node_out)->api7_->oyCMMFilterPlug_Run( plug,
                                              (oyPixelAccess_s*)pixel_access_ );
+    if(oy_stats)
+      oyFilterNode_StatsRun_( (oyFilterNode_s_*)node_out,
+                              (oyPixelAccess_s*)pixel_access_, oyClock() - clck );
     if(oy_debug)
     { clck = oyClock() - clck;
       DBG_PROG1_S( "conversion->out_->api7_->oyCMMFilterPlug_Run(): %g",
@@ -874,12 +1341,18 @@ int                oyConversion_RunPixels (
         oyFilterGraph_PrepareContexts( (oyFilterGraph_s*)pixel_access_->graph, 0 );
         if(oy_debug)
         { clck = oyClock() - clck;
-          DBGs_PROG1_S( pixel_access_,
-                     "oyFilterGraph_PrepareContexts(): %g", clck/1000000.0 );
+          DBGs_PROG2_S( pixel_access_,
+                     "oyFilterGraph_PrepareContexts(): %g\n%s", clck/1000000.0,
+                     oyOptions_FindString( pixel_access_->graph->options,
+                                           "prepared", 0 ) );
           clck = oyClock();
         }
+        if(oy_stats) clck = oyClock();
         error = s->out_->api7_->oyCMMFilterPlug_Run( plug,
                                               (oyPixelAccess_s*)pixel_access_);
+        if(oy_stats)
+          oyFilterNode_StatsRun_( (oyFilterNode_s_*)node_out,
+                                (oyPixelAccess_s*)pixel_access_, oyClock() - clck );
         if(oy_debug)
         { clck = oyClock() - clck;
           DBGs_PROG1_S( pixel_access_,
@@ -843,13 +843,15 @@ OYAPI oyFilterPlug_s * OYEXPORT oyFilterNode_GetPlug (
  *  @memberof oyFilterNode_s
  *  @brief    Run a connected oyFilterPlug_s through the FilterNode
  *
+ *  With ::oy_stats set, the node counts runs, pixels and time.
+ *
  *  @param         node                filter node
  *  @param         plug                the plug
  *  @param         ticket              the job ticket
  *  @return                            error
  *
  *  @version  Oyranos: 0.9.7
- *  @date     2020/02/20
+ *  @date     2026/10/19
  *  @since    2012/09/24 (Oyranos: 0.5.0)
  */
 OYAPI int  OYEXPORT
@@ -859,6 +861,7 @@ OYAPI int  OYEXPORT
 {
   oyFilterNode_s_ * s = (oyFilterNode_s_*)node;
   int error = 0;
+  double clck = 0;
 
   if(!node)
     return -1;
@@ -880,7 +883,10 @@ OYAPI int  OYEXPORT
   }
 #endif
 
+  if(oy_stats) clck = oyClock();
   error = oyCMMapi7_Run( (oyCMMapi7_s*) s->api7_, plug, ticket );
+  if(oy_stats)
+    oyFilterNode_StatsRun_( s, ticket, oyClock() - clck );
   oyStruct_ObserverSignal( (oyStruct_s*) node, oySIGNAL_VISITED, (oyStruct_s*) ticket );
 
   return error;
@@ -41,11 +41,39 @@ typedef struct oyFilterNode_s_ oyFilterNode_s_;
 #include "oyFilterCore_s_.h"
 #include "oyFilterSocket_s.h"
 #include "oyObserver_s_.h"
+#include "oyObject_s.h"
   
 
 #include "oyFilterNode_s.h"
 
 /* Include "FilterNode.private.h" { */
+/** @internal
+ *  @memberof oyFilterNode_s
+ *  @brief    hot path counters
+ *
+ *  The counters are filled only with ::oy_stats being set.
+ *  oyConversion_GetStats() collects them.
+ *
+ *  @version Oyranos: 0.9.7
+ *  @since   2026/10/19 (Oyranos: 0.9.7)
+ *  @date    2026/10/19
+ */
+typedef struct {
+  uint64_t           runs;             /**< oyFilterNode_Run() calls */
+  uint64_t           pixels;           /**< pixels of the run tickets */
+  uint64_t           run_usec;         /**< run time including upstream nodes */
+  uint64_t           contexts;         /**< oyFilterNode_SetContext_() calls */
+  uint64_t           context_usec;     /**< context creation time */
+  uint64_t           cache_hits;       /**< contexts from a cache */
+  uint64_t           cache_misses;     /**< contexts computed by the CMM */
+} oyFilterNodeStats_s;
+#if defined(__GNUC__)
+#define oyFilterNodeStatsAdd_m(node, counter, value) \
+  __atomic_fetch_add( &(node)->stats_.counter, (uint64_t)(value), __ATOMIC_RELAXED )
+#else
+#define oyFilterNodeStatsAdd_m(node, counter, value) \
+  (node)->stats_.counter += (uint64_t)(value)
+#endif
 
 /* } Include "FilterNode.private.h" */
 
@@ -81,6 +109,10 @@ oyObject_s           oy_;            /**< Features name and hash. Do not change
    *  oyCMMapi4_s::oyCMMFilterNode_ContextToMem() and converted to
    *  oyCMMapi4_s::context_type */
   oyPointer_s        * backend_data;
+  /** @private oyFilterNode_GetHash_() api7 key of backend_data */
+  unsigned char        context_hash_[2*OY_HASH_SIZE];
+  /** @private hot path counters */
+  oyFilterNodeStats_s  stats_;
   /** the processing function and node connector descriptions */
   oyCMMapi7_s_       * api7_;
 
@@ -117,6 +149,11 @@ oyFilterNode_s *   oyFilterNode_GetNextFromLinear_ (
 oyPointer    oyFilterNode_TextToInfo_( oyFilterNode_s_    * node,
                                        size_t             * size,
                                        oyAlloc_f            allocateFunc );
+int          oyFilterNode_ContextChanged_ (
+                                       oyFilterNode_s_    * node );
+void         oyFilterNode_StatsRun_  ( oyFilterNode_s_    * node,
+                                       oyPixelAccess_s    * ticket,
+                                       double               usec );
 int      oyFilterNode_Observe_       ( oyObserver_s      * observer,
                                        oySIGNAL_e          signal_type,
                                        oyStruct_s        * signal_data );
@@ -65,6 +65,7 @@ oyObject_s           oy_;            /**< Features name and hash. Do not change
   oyValue_u          * value;          /**< the actual value */
   oyOPTIONSOURCE_e     source;         /**< the source of this value */
   uint32_t             flags;          /**< | oyOPTIONATTRIBUTE_e */
+  int                  value_capacity; /**< allocated elements of a int32 or double list including the count; 0 - unknown */
 
 /* } Include "Option.members.h" */
 
@@ -98,6 +99,9 @@ int            oyOption_SetFromInt_  ( oyOption_s_       * obj,
                                        uint32_t            flags );
 int            oyOption_MoveInStruct_( oyOption_s_       * option,
                                        oyStruct_s       ** s );
+int            oyOption_ListReserve_ ( oyOption_s_       * s,
+                                       oyVALUETYPE_e       list_type,
+                                       int                 n );
 
 /* } Include "Option.private_methods_declarations.h" */
 
@@ -30,7 +30,7 @@
 
 
 
-#include <icc34.h>
+#include <oyranos_icc.h>
   
 #include <oyranos_object.h>
 
@@ -64,6 +64,7 @@ typedef struct oyProfile_s oyProfile_s;
 #define OY_NO_REPAIR     0x80                   /**< do not try to repair or fix profiles */
 #define OY_NO_LOAD       0x100                  /**< do not load profile, create fragment */
 #define OY_SKIP_MTIME_CHECK 0x200               /**< ignore checking time stamp; old bahaviour for faster caching */
+#define OY_PROBE         0x400                  /**< read only header, tag table and text tags; load fully on request */
 /** @} *//* objects_profile */
 
 /* } Include "Profile.public.h" */
@@ -182,6 +183,10 @@ OYAPI oyProfileTag_s * OYEXPORT
 OYAPI oyProfileTag_s * OYEXPORT
                 oyProfile_GetTagById ( oyProfile_s    * profile,
                                        icTagSignature      id );
+OYAPI int OYEXPORT
+                 oyProfile_GetTagView( oyProfile_s       * profile,
+                                       icTagSignature      id,
+                                       oyICCTagView_s    * view );
 OYAPI int OYEXPORT
                    oyProfile_GetTagCount( oyProfile_s    * profile );
 OYAPI int OYEXPORT
@@ -76,6 +76,7 @@ oyObject_s           oy_;            /**< Features name and hash. Do not change
   oyStructList_s     * tags_;          /**< @private list of header + tags */
   int                  tags_modified_; /**< @private note manipulation */
   oyConfig_s         * meta_;          /**< @private parsed meta tag */
+  int                  probe_;         /**< @private block_ holds only header, tag table and text tags */
 
 /* } Include "Profile.members.h" */
 
@@ -102,6 +103,11 @@ oyProfile_s_* oyProfile_FromMemMove_  ( size_t              size,
 oyProfile_s_ *  oyProfile_FromFile_  ( const char        * name,
                                        uint32_t            flags,
                                        oyObject_s          object );
+int          oyProfile_ProbeHasTag_  ( icTagSignature      sig );
+oyProfile_s_ *  oyProfile_FromFileProbe_( const char      * file_name,
+                                       uint32_t            flags,
+                                       oyObject_s          object );
+int          oyProfile_Load_         ( oyProfile_s_      * profile );
 oyPointer    oyProfile_TagsToMem_    ( oyProfile_s_      * profile,
                                        size_t            * size,
                                        oyAlloc_f           allocateFunc );
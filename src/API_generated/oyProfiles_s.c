@@ -30,6 +30,11 @@
 #include "oyProfile_s_.h"
 #include "oyProfiles_s_.h"
 #include "oyConfig_s_.h"
+#include "oyranos_threads.h"
+
+#ifdef HAVE_POSIX
+#include <unistd.h> /* usleep() */
+#endif
   
 
 
@@ -288,6 +293,245 @@ int oyLowerStrcmpWrap_ (const void * a_, const void * b_)
 #endif
 }
 
+/** @internal
+ *  @brief   one profile file of a oyProfilesScan_()
+ */
+typedef struct {
+  char         * file_name;            /**< resolved by the calling thread */
+  oyPointer      block;                /**< file content */
+  size_t         size;                 /**< block size */
+  int            error;                /**< 0 - ICC ID verified; else slow path */
+} oyProfileScan_s;
+
+/** @internal
+ *  @brief   shared context of a oyProfilesScan_()
+ *
+ *  Items are claimed through the next counter. So each file is read
+ *  exactly once, by a oyJob_s worker or by the calling thread. Results
+ *  stay in the slot of the name, which keeps the list order. The jobs
+ *  hold a reference to the context; they are collected with the
+ *  application's oyJobResult() calls or on thread module release and never
+ *  by oyProfilesScan_(), which runs in any thread.
+ */
+typedef struct {
+  oyProfileScan_s * items;
+  int            n;
+  int            next;                 /**< next unclaimed item */
+  int            done;                 /**< completed items */
+} oyProfilesScan_s;
+
+/** the maximum of queued oyJob_s for oyProfilesScan_(); bounds file I/O */
+#define OY_PROFILES_SCAN_JOBS 4
+#if defined(__GNUC__)
+#define oyProfilesScanInc_m(v) __atomic_fetch_add( &(v), 1, __ATOMIC_ACQ_REL )
+#define oyProfilesScanGet_m(v) __atomic_load_n( &(v), __ATOMIC_ACQUIRE )
+#else
+#define oyProfilesScanInc_m(v) (v)++
+#define oyProfilesScanGet_m(v) (v)
+#endif
+
+static int     oyProfilesScanRelease_( oyPointer         * ptr )
+{
+  oyProfilesScan_s * scan = (oyProfilesScan_s*) *ptr;
+  int i;
+
+  if(!scan) return 1;
+
+  for(i = 0; i < scan->n; ++i)
+  {
+    if(scan->items[i].file_name)
+      oyDeAllocateFunc_( scan->items[i].file_name );
+    if(scan->items[i].block)
+      oyDeAllocateFunc_( scan->items[i].block );
+  }
+  oyDeAllocateFunc_( scan->items );
+  oyDeAllocateFunc_( scan );
+  *ptr = NULL;
+
+  return 0;
+}
+
+/* read the file, check the header and compare the stored ICC ID against a
+ * freshly computed MD5; thread safe, messages are left to the slow path */
+static void    oyProfilesScanItem_   ( oyProfileScan_s   * item )
+{
+  char * h, saved[24];
+  uint32_t md5[4] = {0,0,0,0}, id[4];
+  int i;
+
+  item->error = 1;
+  if(!item->file_name)
+    return;
+
+  item->block = oyGetProfileBlock_( item->file_name, &item->size, 0 );
+  h = (char*) item->block;
+  if(!h || item->size < 132 || memcmp( &h[36], "acsp", 4 ) != 0)
+    return;
+
+  /* process as described in the ICC specification */
+  memcpy( &saved[0], &h[44], 4 );    /* flags */
+  memcpy( &saved[4], &h[64], 4 );    /* intent */
+  memcpy( &saved[8], &h[84], 16 );   /* ID */
+  memset( &h[44], 0, 4 );
+  memset( &h[64], 0, 4 );
+  memset( &h[84], 0, 16 );
+  if(oyMiscBlobGetMD5_( h, item->size, (unsigned char*)md5 ) == 0)
+  {
+    memcpy( id, &saved[8], 16 );
+    item->error = 0;
+    for(i = 0; i < 4; ++i)
+      if(oyValueUInt32( id[i] ) != md5[i])
+        item->error = -1;
+  }
+  memcpy( &h[44], &saved[0], 4 );
+  memcpy( &h[64], &saved[4], 4 );
+  memcpy( &h[84], &saved[8], 16 );
+}
+
+static void    oyProfilesScanItems_  ( oyProfilesScan_s  * scan )
+{
+  int i;
+  while((i = oyProfilesScanInc_m( scan->next )) < scan->n)
+  {
+    oyProfilesScanItem_( &scan->items[i] );
+    oyProfilesScanInc_m( scan->done );
+  }
+}
+
+static int     oyProfilesScanWork_   ( oyJob_s           * job )
+{
+  oyProfilesScanItems_( (oyProfilesScan_s*) oyPointer_GetPointer( (oyPointer_s*)job->context ) );
+  return 0;
+}
+
+/** @internal
+ *  @brief   read and check profile files in parallel
+ *
+ *  The files are read and their ICC ID is verified on the oyJob_s worker
+ *  pool and in the calling thread together. At most one job per 32 files
+ *  and no more than OY_PROFILES_SCAN_JOBS are queued, which bounds the
+ *  concurrent file I/O. The OY_PROFILES_SCAN_JOBS environment variable
+ *  replaces both limits, but never more jobs than files are queued;
+ *  0 keeps all work in the calling thread.
+ *
+ *  @param[in]     names               the file names
+ *  @param[in]     n                   count of names
+ *  @param[in]     flags               for oyFindProfile_()
+ *  @return                            a oyProfilesScan_s in a oyPointer_s
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2026/10/19
+ *  @since   2026/10/19 (Oyranos: 0.9.7)
+ */
+static oyPointer_s * oyProfilesScan_ ( char             ** names,
+                                       int                 n,
+                                       uint32_t            flags )
+{
+  oyProfilesScan_s * scan = NULL;
+  oyPointer_s * ptr;
+  int jobs = OY_PROFILES_SCAN_JOBS, i;
+  const char * env = getenv( "OY_PROFILES_SCAN_JOBS" );
+
+  oyAllocHelper_m_( scan, oyProfilesScan_s, 1, oyAllocateFunc_, return NULL );
+  oyAllocHelper_m_( scan->items, oyProfileScan_s, n+1, oyAllocateFunc_, oyDeAllocateFunc_(scan); return NULL );
+  scan->n = n;
+  for(i = 0; i < n; ++i)
+  {
+    scan->items[i].error = 1;
+    if(names[i] && oyStrcmp_(names[i], OY_PROFILE_NONE) != 0)
+      scan->items[i].file_name = oyFindProfile_( names[i], flags );
+  }
+
+  ptr = oyPointer_New( 0 );
+  oyPointer_Set( ptr, __FILE__, "oyProfilesScan_s*", scan,
+                 "oyProfilesScanRelease_", oyProfilesScanRelease_ );
+
+  /* a explicit job count is taken as is, e.g. to test the workers */
+  if(env)
+    jobs = atoi( env );
+  else if(jobs > n / 32)
+    jobs = n / 32;
+  if(jobs > n)
+    jobs = n;
+#if !defined(__GNUC__)
+  jobs = 0;
+#endif
+
+  for(i = 0; i < jobs; ++i)
+  {
+    oyJob_s * job = oyJob_New( 0 );
+    job->context = (oyStruct_s*) oyPointer_Copy( ptr, 0 );
+    job->work = oyProfilesScanWork_;
+    oyJob_Add( &job, 0, 0 );
+    /* no threading available */
+    if(job)
+    {
+      oyJob_Release( &job );
+      break;
+    }
+  }
+
+  /* work in parallel to the jobs; no need to wait for a busy pool */
+  oyProfilesScanItems_( scan );
+  while(oyProfilesScanGet_m( scan->done ) < n)
+#if defined(HAVE_POSIX)
+    usleep( 100 );
+#else
+    ;
+#endif
+
+  return ptr;
+}
+
+/* append the profiles of l to s, sorted case insensitive by description */
+static void  oyProfilesSortByDescription_( oyProfiles_s    * s,
+                                       oyProfiles_s      * l )
+{
+  int count = oyProfiles_Count( l ), i;
+  oyPointer * sort = NULL;
+  oyProfile_s * tmp = NULL;
+#if !defined(HAVE_POSIX)
+  char * t;
+  int j, n;
+#endif
+
+  if(!count)
+    return;
+
+  sort = oyAllocateFunc_(count*sizeof(oyPointer)*2);
+  for(i = 0; i < count; ++i)
+  {
+    tmp = oyProfiles_Get( l, i );
+#if !defined(HAVE_POSIX)
+    t = 0;
+    oyStringAdd_(&t, oyProfile_GetText(tmp, oyNAME_DESCRIPTION), oyAllocateFunc_, 0);
+    n = strlen(t);
+    /* the following upper caseing is portable,
+     * still strcasecmp() might be faster? */
+    for(j = 0; j < n; ++j)
+      if(isalpha(t[j]))
+        t[j] = tolower(t[j]);
+    sort[i*2] = t;
+#else
+    sort[i*2] = (oyPointer) oyProfile_GetText(tmp, oyNAME_DESCRIPTION);
+#endif
+    /* l keeps the profile alive until sorted */
+    sort[i*2+1] = tmp;
+    oyProfile_Release( &tmp );
+  }
+  qsort( sort, count, sizeof(oyPointer)*2, oyLowerStrcmpWrap_ );
+  for(i = 0; i < count; ++i)
+  {
+    tmp = oyProfile_Copy( (oyProfile_s*) sort[i*2+1], 0 );
+    oyProfiles_MoveIn( s, &tmp, -1 );
+#if !defined(HAVE_POSIX)
+    t = (char*)sort[i*2];
+    oyFree_m_(t);
+#endif
+  }
+  oyFree_m_(sort);
+}
+
 /** Function oyProfiles_Create
  *  @memberof oyProfiles_s
  *  @brief   get a list of installed profiles
@@ -299,9 +543,17 @@ int oyLowerStrcmpWrap_ (const void * a_, const void * b_)
  *                                     - see oyProfile_FromFile()
  *                                     - ::OY_ALLOW_DUPLICATES - do not filter
  *                                     duplicate profile ID's
+ *                                     - ::OY_PROBE - read only profile headers
+ *                                     and text tags for listing and
+ *                                     matching; probes are not cached and
+ *                                     without ID not filtered as duplicates
  *  @param         object              the optional object
  *  @return                            the found and selected profiles
  *
+ *  The first call reads all installed profiles. Files are read and their
+ *  ICC ID checked in parallel on the oyJob_s worker pool. The resulting
+ *  list order does not depend on the threads.
+ *
  *  @code
     // Put all ICC Display Class profiles in "profiles"
     icSignature profile_class = icSigDisplayClass;
@@ -324,8 +576,8 @@ int oyLowerStrcmpWrap_ (const void * a_, const void * b_)
     profiles = oyProfiles_Create( patterns, icc_profile_flags, 0 );
     oyProfiles_Release( &patterns );@endcode
  *
- *  @version Oyranos: 0.9.6
- *  @date    2014/08/31
+ *  @version Oyranos: 0.9.7
+ *  @date    2026/10/19
  *  @since   2008/06/20 (Oyranos: 0.1.8)
  */
 OYAPI oyProfiles_s * OYEXPORT
@@ -334,19 +586,15 @@ OYAPI oyProfiles_s * OYEXPORT
                                        oyObject_s          object)
 {
   oyProfiles_s * s = oyProfiles_New( object ),
-               * tmps = oyProfiles_New( object );
+               * list = NULL;
   const char * name = "profile cache from oyProfiles_Create()";
   int error = 0;
 
   oyProfile_s * tmp = 0, * pattern = 0;
   char  ** names = 0;
-#if !defined(HAVE_POSIX)
-  char *t;
-#endif
   uint32_t names_n = 0, i = 0, j = 0, n = 0,
            patterns_n = oyProfiles_Count(patterns);
-  int sorts = 0, count = 0;
-  const char ** sort = NULL;
+  int probe = flags & OY_PROBE;
 
   error = !s;
 
@@ -354,14 +602,32 @@ OYAPI oyProfiles_s * OYEXPORT
   {
     names = oyProfileListGet_ ( NULL, flags, &names_n );
 
-    if(!(flags & OY_ALLOW_DUPLICATES))
+    if(!(flags & OY_ALLOW_DUPLICATES) && !probe)
       flags |= OY_COMPUTE;
 
-    if(oyProfiles_Count( oy_profile_list_cache_ ) != (int)names_n)
+    if(probe && oyProfiles_Count( oy_profile_list_cache_ ) != (int)names_n)
     {
+      /* probes stay out of the profile list cache */
       oyProfiles_s * l = oyProfiles_New(0);
-      sorts = names_n;
-      sort = oyAllocateFunc_(sorts*sizeof(const char*)*2);
+      for(i = 0; i < names_n; ++i)
+      {
+        if(names[i] && oyStrcmp_(names[i], OY_PROFILE_NONE) != 0)
+        {
+          tmp = oyProfile_FromFile( names[i], flags, 0 );
+          if(tmp)
+            oyProfiles_MoveIn( l, &tmp, -1 );
+        }
+      }
+      list = oyProfiles_New( 0 );
+      oyProfilesSortByDescription_( list, l );
+      oyProfiles_Release(&l);
+    }
+    else if(oyProfiles_Count( oy_profile_list_cache_ ) != (int)names_n)
+    {
+      oyProfiles_s * l = oyProfiles_New(0),
+                   * tmps = oyProfiles_New( object );
+      oyPointer_s * scan_ptr = oyProfilesScan_( names, names_n, flags );
+      oyProfilesScan_s * scan = (oyProfilesScan_s*) oyPointer_GetPointer( scan_ptr );
       for(i = 0; i < names_n; ++i)
       {
         const char * name = names[i];
@@ -369,49 +635,44 @@ OYAPI oyProfiles_s * OYEXPORT
         {
           if(oyStrcmp_(name, OY_PROFILE_NONE) != 0)
           {
-            tmp = oyProfile_FromFile( name, OY_NO_CACHE_WRITE | flags, 0 );
+            oyProfileScan_s * item = scan ? &scan->items[i] : NULL;
+            tmp = NULL;
+            if(item && item->error == 0)
+            {
+              /* the ICC ID is verified; take the block without hashing again */
+              int l_error = 0;
+              oyProfile_s_ * p = oyProfile_FromMemMove_( item->size, &item->block,
+                                      (OY_NO_CACHE_WRITE | flags) & ~OY_COMPUTE,
+                                                         &l_error, 0 );
+              if(p && l_error <= 0)
+              {
+                p->file_name_ = oyStringCopy_( item->file_name, p->oy_->allocateFunc_ );
+                tmp = (oyProfile_s*) p;
+                oyProfile_GetID( tmp );
+              } else
+                oyProfile_Release( (oyProfile_s**)&p );
+            }
+            /* unverified IDs take the full path with repair and messages */
+            if(!tmp)
+              tmp = oyProfile_FromFile( name, OY_NO_CACHE_WRITE | flags, 0 );
             if(!tmp) continue;
-#if !defined(HAVE_POSIX)
-            t = 0;
-            oyStringAdd_(&t, oyProfile_GetText(tmp, oyNAME_DESCRIPTION), oyAllocateFunc_, 0);
-            n = strlen(t);
-            /* the following upper caseing is portable,
-             * still strcasecmp() might be faster? */
-            for(j = 0; j < n; ++j)
-              if(isalpha(t[j]))
-                t[j] = tolower(t[j]);
-            sort[count*2] = t;
-#else
-            sort[count*2] = oyProfile_GetText(tmp, oyNAME_DESCRIPTION);
-#endif
-            sort[count*2+1] = name;
             oyProfiles_MoveIn( l, &tmp, -1 );
-            ++count;
           }
         }
       }
-      sorts = count;
-      qsort( sort, sorts, sizeof(char**)*2, oyLowerStrcmpWrap_ );
-      for(i = 0; (int)i < sorts; ++i)
-      {
-        tmp = oyProfile_FromFile( sort[i*2+1], OY_NO_CACHE_WRITE | flags, 0 );
-        oyProfiles_MoveIn(tmps, &tmp, -1);
-#if !defined(HAVE_POSIX)
-        t = (char*)sort[i*2];
-        oyFree_m_(t);
-#endif
-      }
+      oyPointer_Release( &scan_ptr );
+      oyProfilesSortByDescription_( tmps, l );
       oyProfiles_Release(&l);
       oyProfiles_Release(&oy_profile_list_cache_);
       oyObject_SetNames( tmps->oy_, name,name,name );
       oy_profile_list_cache_ = tmps;
-      oyFree_m_(sort);
     }
-    else
-      oyProfiles_Release( &tmps );
 
-    n = oyProfiles_Count( oy_profile_list_cache_ );
-    if(oyProfiles_Count( oy_profile_list_cache_ ) != (int)names_n)
+    if(!list)
+      list = oyProfiles_Copy( oy_profile_list_cache_, 0 );
+
+    n = oyProfiles_Count( list );
+    if(n != names_n)
       WARNc2_S("updated oy_profile_list_cache_ differs: %d %d",n, names_n);
     oyStringListRelease_( &names, names_n, oyDeAllocateFunc_ ); names_n = 0;
 
@@ -419,7 +680,7 @@ OYAPI oyProfiles_s * OYEXPORT
     {
         int good = 1;
 
-        tmp = oyProfiles_Get( oy_profile_list_cache_, i );
+        tmp = oyProfiles_Get( list, i );
 
         if(patterns_n > 0)
         {
@@ -446,7 +707,10 @@ OYAPI oyProfiles_s * OYEXPORT
           for(j = 0; j < count; ++j)
           {
             oyProfile_s * b = oyProfiles_Get( s, j );
-            if(oyProfile_Equal(b, tmp))
+            /* probes without ID are not hashed */
+            if((!probe || (oyProfile_Hashed_( (oyProfile_s_*)b ) &&
+                           oyProfile_Hashed_( (oyProfile_s_*)tmp ))) &&
+               oyProfile_Equal(b, tmp))
               good = 0;
             oyProfile_Release( &b );
           }
@@ -459,6 +723,8 @@ OYAPI oyProfiles_s * OYEXPORT
     }
   }
 
+  oyProfiles_Release( &list );
+
   return s;
 }
 
@@ -798,7 +1064,7 @@ int              oyProfiles_DeviceRank ( oyProfiles_s    * list,
  *  @param[in,out] rank_list           list of rank levels for the profile list
  *
  *  @version Oyranos: 0.9.7
- *  @date    2017/01/05
+ *  @date    2026/10/19
  *  @since   2017/01/05 (Oyranos: 0.9.7)
  */
 OYAPI int OYEXPORT oyProfiles_Rank   ( oyProfiles_s      * list,
@@ -815,7 +1081,8 @@ OYAPI int OYEXPORT oyProfiles_Rank   ( oyProfiles_s      * list,
   oyProfile_s * p = 0;
   oyConfig_s * p_device = 0;
   oyConfig_s_ * d = (oyConfig_s_*)device;
-  oyOptions_s * old_db = 0;
+  oyOptions_s * db;
+  oyConfigMatch_s dm, pm;
 
   if(!list)
     return 0;
@@ -830,21 +1097,32 @@ OYAPI int OYEXPORT oyProfiles_Rank   ( oyProfiles_s      * list,
 
   error = !memset( rank_list, 0, sizeof(int32_t) * n );
 
-  /* oyConfig_Match assumes its options in device->db, so it is filled here.*/
-  if(!oyOptions_Count( d->db ))
-  {
-    old_db = d->db;
-    d->db = d->backend_core;
-  }
+  /* oyConfig_Match assumes its options in device->db; the device is the
+   * pattern for all profiles and thus projected once */
+  db = oyOptions_Count( d->db ) ? d->db : d->backend_core;
+  if(!error)
+    error = oyConfigMatch_Set_( &pm, db );
+  else
+    memset( &pm, 0, sizeof(pm) );
 
-  for(i = 0; i < n; ++i)
+  for(i = 0; i < n && !error; ++i)
   {
+    oyConfig_s_ * pd = (oyConfig_s_*)p_device;
+
     p = oyProfiles_Get( list, i );
 
     oyProfile_GetDevice( p, p_device );
     rank = 0;
 
-    error = oyConfig_Match( p_device, device, path_separator, key_separator, flags, &rank );
+    /* same as oyConfig_Match( p_device, device, ... ) */
+    error = pd ? oyConfigMatch_Set_( &dm, oyConfig_MatchOptions_( pd ) ) : 1;
+    if(!error)
+    {
+      rank = oyConfigMatch_Rank_( &dm, &pm,
+                                  pd->rank_map ? pd->rank_map : d->rank_map,
+                                  path_separator, key_separator, flags );
+      oyConfigMatch_Clear_( &dm );
+    }
     if(oyConfig_FindString( p_device, "OYRANOS_automatic_generated", "1" ) ||
        oyConfig_FindString( p_device, "OPENICC_automatic_generated", "1" ))
     {
@@ -866,9 +1144,7 @@ OYAPI int OYEXPORT oyProfiles_Rank   ( oyProfiles_s      * list,
   if(!error)
     error = oyStructList_Sort( s->list_, rank_list );
 
-  if(old_db)
-    d->db = old_db;
-
+  oyConfigMatch_Clear_( &pm );
   oyConfig_Release( &p_device );
 
   return error;
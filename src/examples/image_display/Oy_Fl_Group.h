@@ -16,10 +16,18 @@ void               oyShowConversion_ ( oyConversion_s    * conversion,
 
 extern int oy_debug_image_read_array_count;
 
+/* The group content is read back from a offscreen into in_buf and
+ * converted for display into off_buf. The conversion runs through a
+ * oyDisplayTiles_s cache, so unchanged group content is not converted
+ * again. The tiles are rendered synchronously, as fl_read_image() rewrites
+ * in_buf on each draw and workers would race with it. */
 class Oy_Fl_Group : public Fl_Group
 {
   Fl_Offscreen off;
   unsigned char * off_buf;
+  unsigned char * in_buf;
+  oyDisplayTiles_s * tiles;
+  oyRectangle_s * tiles_view;
   oyPixelAccess_s * ticket;
   int W,H;
   int e, px, py;
@@ -137,12 +145,19 @@ public:
 
       oy_debug_image_read_array_count = 0;
       if(image)
-        dirty = oyDrawScreenImage(conversion(), ticket, display_rectangle,
-                                old_display_rectangle,
-                                NULL, "X11",
-                                data_type_request,
-                                display, window, dirty,
-                                image );
+      {
+        if(!tiles)
+          tiles = oyDisplayTiles_New( conversion(), 64,
+                                      (W / 64 + 1) * (H / 64 + 1) );
+        oyRectangle_SetGeo( tiles_view, -px, -py,
+                            OY_MIN( W, oyImage_GetWidth( image ) ),
+                            OY_MIN( H, oyImage_GetHeight( image ) ) );
+        oyDrawScreenImageTiles( tiles, tiles_view, 0,0, OY_DISPLAY_TILES_SYNC,
+                                display_rectangle, old_display_rectangle,
+                                "X11", data_type_request,
+                                display, window, dirty, image );
+        dirty = 0;
+      }
       if(oy_debug_image_read_array_count)
         printf( "%s:%d WARNING: Ticket lost connection to DAG output image: %d\n",
                 __FILE__,__LINE__,oy_debug_image_read_array_count );
@@ -195,8 +210,12 @@ public:
         fl_delete_offscreen(off);
       if(off_buf)
         delete [] off_buf;
+      if(in_buf)
+        delete [] in_buf;
       off = fl_create_offscreen(W,H);
       off_buf = new unsigned char[W*H*4];
+      in_buf = new unsigned char[W*H*4];
+      memset( in_buf, 0, W*H*4 );
       setImage();
     } else if(!context)
       setImage();
@@ -206,15 +225,22 @@ public:
     position(0,0);
     Fl_Group::draw();
     position(X,Y);
-    dirty=1;
     fl_read_image(off_buf,0,0,W,H);
     fl_end_offscreen();
+    /* convert again only changed content */
+    if(memcmp( off_buf, in_buf, W*H*3 ) != 0)
+    {
+      memcpy( in_buf, off_buf, W*H*3 );
+      dirty=1;
+    }
 
     if(conversion())
     {
       oyImage_s * image = 0;
 
       drawPrepare( &image, oyUINT8, 0 );
+      oyDisplayTiles_Blit( tiles, tiles_view, off_buf,
+                           W * oyToChannels_m( oyImage_GetPixelLayout( image, oyLAYOUT ) ) );
 
       if(oy_debug > 2)
       printf("%s:%d draw() %s\n",
@@ -238,10 +264,11 @@ private:
 public:
   oyFilterNode_s * setImage( )
   {
+    oyDisplayTiles_Release( &tiles );
     oyImage_Release( &image );
     oyImage_Release( &image_display );
     image = oyImage_Create( W, H,
-                         off_buf ,
+                         in_buf ,
                          oyChannels_m(oyProfile_GetChannelsCount(editing)) |
                           oyUINT8,
                          editing,
@@ -292,6 +319,9 @@ public:
   {
     off = 0;
     off_buf = NULL;
+    in_buf = NULL;
+    tiles = NULL;
+    tiles_view = oyRectangle_NewWith( 0,0,0,0, 0 );
     ticket = NULL;
     context = NULL;
     old_display_rectangle = oyRectangle_NewWith( 0,0,0,0, 0 );
@@ -305,6 +335,10 @@ public:
   }
   ~Oy_Fl_Group( )
   {
+    oyDisplayTiles_Release( &tiles );
+    oyRectangle_Release( &tiles_view );
+    delete [] in_buf;
+    delete [] off_buf;
     oyConversion_Release( &context );
     oyRectangle_Release( &old_display_rectangle );
     oyPixelAccess_Release( &ticket );
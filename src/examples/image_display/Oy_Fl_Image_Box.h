@@ -81,7 +81,9 @@ private:
       channels = oyToChannels_m( pt );
 
       /* get the data and draw the image */
-      if(image)
+      if(image && tiles())
+        drawTiles( 0, 0, channels );
+      else if(image)
       {
         int iheight = oyImage_GetHeight( image ),
             iwidth = oyImage_GetWidth( image );
@@ -8,6 +8,7 @@
 
 #include "Oy_Fl_Double_Window.h"
 #include "Oy_Widget.h"
+#include "oyranos_display_helpers.h"
 
 #ifndef _DBG_FORMAT_
 #define _DBG_FORMAT_ "%s:%d %s() "
@@ -38,6 +39,31 @@ class Oy_Fl_Image_Widget : public Fl_Widget, public Oy_Widget
   double scale_;
   oyOptions_s * node_out_opts_;
   oyFilterNode_s * node_out_;
+  /* tiled rendering, see useTiles() */
+  int tile_size_;
+  oyDisplayTiles_s * tiles_;
+  int tiles_id_,                       /* conversion of tiles_ */
+      tiles_px_, tiles_py_,            /* last view position */
+      tiles_rendered_;
+  oyRectangle_s * tiles_view_;
+  unsigned char * tiles_buf_;
+  int tiles_buf_size_;
+  /* collect finished tiles from the FLTK loop and expose them */
+  static void tilesPoll_cb( void * data )
+  {
+    Oy_Fl_Image_Widget * w = (Oy_Fl_Image_Widget*) data;
+    int rendered = 0,
+        pending = oyDisplayTiles_Poll( w->tiles_ );
+
+    oyDisplayTiles_GetCounts( w->tiles_, &rendered, NULL, NULL );
+    if(rendered != w->tiles_rendered_)
+    {
+      w->tiles_rendered_ = rendered;
+      w->redraw();
+    }
+    if(pending > 0)
+      Fl::repeat_timeout( 0.02, tilesPoll_cb, data );
+  }
   void checkNodeOut()
   {
     oyFilterNode_s * node_out = oyConversion_GetNode( conversion(),OY_OUTPUT);
@@ -52,6 +78,44 @@ class Oy_Fl_Image_Widget : public Fl_Widget, public Oy_Widget
   }
 public:
   void resetScale( ) { scale_ = 1; }
+  /** render the output image asynchronously in tiles of tile_size pixels;
+   *  0 - render the visible area synchronously with oyDrawScreenImage()
+   *
+   *  The output image gets the full scaled size. Panning then shows cached
+   *  tiles and prefetches the next tiles in scroll direction. The tiles
+   *  are drawn by Oy_Fl_Image_Box only. */
+  void useTiles( int tile_size )
+  {
+    Fl::remove_timeout( tilesPoll_cb, this );
+    oyDisplayTiles_Release( &tiles_ );
+    tile_size_ = tile_size > 0 ? tile_size : 0;
+    dirty = 1;
+  }
+  oyDisplayTiles_s * tiles() { return tiles_; }
+  /* draw the ready tiles of the last view; @return missing tiles */
+  int drawTiles( int X, int Y, int channels )
+  {
+    double x,y, w,h;
+    int size, missing;
+
+    oyRectangle_GetGeo( tiles_view_, &x,&y, &w,&h );
+    size = (int)w * (int)h * channels;
+    if(!tiles_ || size <= 0)
+      return -1;
+    if(size > tiles_buf_size_)
+    {
+      delete [] tiles_buf_;
+      tiles_buf_ = new unsigned char[size];
+      tiles_buf_size_ = size;
+    }
+    /* neutral gray for not yet rendered tiles */
+    memset( tiles_buf_, 0x80, size );
+    missing = oyDisplayTiles_Blit( tiles_, tiles_view_, tiles_buf_,
+                                   (int)w * channels );
+    fl_draw_image( tiles_buf_, X, Y, (int)w, (int)h, channels,
+                   (int)w * channels );
+    return missing;
+  }
   double scale_changer;
   int px, py, mx, my;
   int handle(int event)
@@ -245,6 +309,9 @@ public:
         width_roi = W;
       if(height_roi > H)
         height_roi = H;
+      /* tiles address the whole scaled image */
+      int width_out = tile_size_ ? width_scale : width_roi,
+          height_out = tile_size_ ? height_scale : height_roi;
 
       /* Load the image before creating the oyPicelAccess_s object. */
       image_output = oyConversion_GetImage( conversion(), OY_OUTPUT );
@@ -261,15 +328,17 @@ public:
 
       /* update output image dimensions to fit scale */
       if(image_output &&
-         (width_output != width_roi ||
-          height_output != height_roi))
+         (width_output != width_out ||
+          height_output != height_out))
       {
+        /* waits for workers still rendering into the old geometry */
+        oyDisplayTiles_Release( &tiles_ );
         if(oy_debug > 2)
           printf(_DBG_FORMAT_"image_input [%d](%d) update image_output [%d](%d)",_DBG_ARGS_, oyStruct_GetId((oyStruct_s*)image_input),oyImage_GetWidth(image_input), oyStruct_GetId((oyStruct_s*)image_output),oyImage_GetWidth(image_output) );
         if(ticket())
         {
           oyImage_s * output_image = oyPixelAccess_GetOutputImage( ticket() );
-          oyImage_SetCritical( output_image, 0, NULL, NULL, width_roi, height_roi );
+          oyImage_SetCritical( output_image, 0, NULL, NULL, width_out, height_out );
           if(oy_debug > 2)
             printf(" output_image [%d](%d)", oyStruct_GetId((oyStruct_s*)output_image),oyImage_GetWidth(output_image) );
           oyImage_Release( &output_image );
@@ -337,7 +406,35 @@ public:
         window = NULL;
       }
 
-      if(image_output)
+      if(image_output && tile_size_)
+      {
+        int id = oyStruct_GetId( (oyStruct_s*) conversion() );
+        if(tiles_ && tiles_id_ != id)
+          oyDisplayTiles_Release( &tiles_ );
+        if(!tiles_)
+        {
+          /* the visible and the prefetched view */
+          int view_tiles = (W / tile_size_ + 2) * (H / tile_size_ + 2);
+          tiles_ = oyDisplayTiles_New( conversion(), tile_size_,
+                                       3 * view_tiles );
+          tiles_id_ = id;
+          tiles_px_ = px;
+          tiles_py_ = py;
+        }
+        oyRectangle_SetGeo( tiles_view_, -px, -py, width_roi, height_roi );
+        /* the view moves opposite to the image */
+        oyDrawScreenImageTiles( tiles_, tiles_view_,
+                                tiles_px_ - px, tiles_py_ - py, 0,
+                                display_rectangle, old_display_rectangle,
+                                "X11", data_type_request,
+                                display, window, dirty, image_output );
+        tiles_px_ = px;
+        tiles_py_ = py;
+        dirty = 0;
+        if(!Fl::has_timeout( tilesPoll_cb, this ))
+          Fl::add_timeout( 0.02, tilesPoll_cb, this );
+      }
+      else if(image_output)
         dirty = oyDrawScreenImage(conversion(), ticket(), display_rectangle,
                                 old_display_rectangle,
                                 old_roi_rectangle, "X11",
@@ -404,15 +501,28 @@ public:
   Oy_Fl_Image_Widget(int x, int y, int w, int h)
     : Fl_Widget(x,y,w,h),
       node_out_opts_(NULL),
-      node_out_(NULL)
+      node_out_(NULL),
+      tile_size_(0),
+      tiles_(NULL),
+      tiles_id_(0),
+      tiles_px_(0),
+      tiles_py_(0),
+      tiles_rendered_(0),
+      tiles_buf_(NULL),
+      tiles_buf_size_(0)
   {
     px=py=ox=oy=0;
     scale_changer = 1.2;
     scale_ = 1;
+    tiles_view_ = oyRectangle_NewWith( 0,0,0,0, 0 );
   };
 
   ~Oy_Fl_Image_Widget(void)
   {
+    Fl::remove_timeout( tilesPoll_cb, this );
+    oyDisplayTiles_Release( &tiles_ );
+    oyRectangle_Release( &tiles_view_ );
+    delete [] tiles_buf_;
     oyOptions_Release( &node_out_opts_ );
     oyFilterNode_Release( &node_out_ );
   };
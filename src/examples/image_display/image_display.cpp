@@ -90,6 +90,7 @@ main(int argc, char** argv)
 
   int gl_box = 0x01;
   int logo = 0x02;
+  int tile_size = 0;
   const char * icc_color_context = 0;
   int i;
   oyOptions_s * module_options = NULL;
@@ -149,6 +150,13 @@ main(int argc, char** argv)
       ++file_pos;
       ++file_pos;
     }
+    if(argc > 2 && strcmp(argv[i], "--tiles") == 0)
+    {
+      gl_box = 0;
+      tile_size = atoi( argv[i+1] );
+      ++file_pos;
+      ++file_pos;
+    }
     if(argc > 1 && strcmp(argv[i], "-s") == 0)
     {
       gl_box = 0x04;
@@ -167,6 +175,7 @@ main(int argc, char** argv)
     {
       printf("Usage: image_display [options] <image_file>\n"
              "\t--use-pixel|-p\tuse normal pixel copy\n"
+             "\t--tiles <size>\tuse pixel copy and render in tiles asynchronously\n"
              "\t--no-logo|-n\tskip Oyranos logo\n"
              "\t--icc-color-context <name>\tselect a ICC CMM\n"
              "\t--effect <name>\tselect a effect profile\n"
@@ -216,6 +225,7 @@ main(int argc, char** argv)
     {
       oy_box = dynamic_cast<Oy_Fl_Image_Box*> (oy_widget);
       icc = oy_box->setImage( file_name, module_options );
+      oy_box->useTiles( tile_size );
     }
   }
   setWindowMenue( win, oy_widget, icc  );
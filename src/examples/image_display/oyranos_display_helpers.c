@@ -2,7 +2,7 @@
  *  Oyranos is an open source Color Management System 
  * 
  *  @par Copyright:
- *            2009-2016 (C) Kai-Uwe Behrmann
+ *            2009-2026 (C) Kai-Uwe Behrmann
  *
  *  @author   Kai-Uwe Behrmann <ku.b@gmx.de>
  *  @par License:
@@ -239,57 +239,19 @@ oyConversion_s * oyConversion_FromImageForDisplay  (
 }
 
 
-/** Function oyDrawScreenImage
- *  @brief   generate a Oyranos image from a given context for display
- *
- *  The function asks the 'oydi' node to provide parameters to render a
- *  oyImage_s from a prepared oyConversion_s context.
- *
- *  @param[in]     context             the Oyranos graph
- *  @param[in,out] ticket              rendering context for tracking
- *                                     rectangles
- *  @param[in]     display_rectangle   absolute coordinates of visible image
- *                                     in relation to display
- *  @param[in,out] old_display_rectangle
- *                                     rembering of display_rectangle
- +  @param[in,out] old_roi_rectangle   remembering of ticket's ROI (optional)
- *  @param[in]     system_type         the system dependent type specification
- *                                     - "X11" is well supported
- *                                     - "oy-test" for internal tests
- *  @param[in]     data_type_request   oyUINT8 or oyUINT16
- *  @param[in]     display             the system display with system_type:
- *                                     - "X11": a Display object
- *  @param[in]     window              the system window with system_type:
- *                                     - "X11": a Window ID
- *  @param[in]     dirty               explicite redraw
- *  @param[out]    image               the image from graph to display
- *  @return                            0 - success, -1 - issue, >=  1 - error
- *
- *  @version Oyranos: 0.9.6
- *  @date    2016/09/22
- *  @since   2010/09/05 (Oyranos: 0.1.11)
- */
-int  oyDrawScreenImage               ( oyConversion_s    * context,
+/* tag the output image with the display coverage for the 'oydi' node;
+ * @return 0 - success, -1 - empty display_rectangle, >= 1 - error */
+static int oyDrawScreenImageTags_    ( oyImage_s         * image,
                                        oyPixelAccess_s   * ticket,
                                        oyRectangle_s     * display_rectangle,
-                                       oyRectangle_s     * old_display_rectangle,
-                                       oyRectangle_s     * old_roi_rectangle,
                                        const char        * system_type,
                                        oyDATATYPE_e        data_type_request,
                                        void              * display,
                                        void              * window,
-                                       int                 dirty,
-                                       oyImage_s         * image )
+                                       oyRectangle_s    ** disp_rectangle )
 {
-  int result = 0;
-
-    if(context)
-    {
       double X,Y,W,H;
       int channels = 0;
-      oyFilterNode_s * node_out = 0;
-      oyRectangle_s * disp_rectangle = 0,
-                    * ticket_roi = 0;
       oyOptions_s * image_tags = 0;
       oyDATATYPE_e data_type = oyUINT8;
       oyPixel_t pt = 0;
@@ -362,15 +324,74 @@ int  oyDrawScreenImage               ( oyConversion_s    * context,
                 oyOptions_FindString( image_tags, "filename", 0 ),
                 oyObject_GetName( image->oy_, oyNAME_NICK ),
                 oyDataTypeToText( data_type_request ) );
+        oyOptions_Release( &image_tags );
         return 1;
       }
 
 
       /* Inform about the images display coverage.  */
-      disp_rectangle = (oyRectangle_s*) oyOptions_GetType( image_tags, -1,
+      *disp_rectangle = (oyRectangle_s*) oyOptions_GetType( image_tags, -1,
                                     "display_rectangle", oyOBJECT_RECTANGLE_S );
-      oyRectangle_SetGeo( disp_rectangle, X,Y,W,H );
+      oyRectangle_SetGeo( *disp_rectangle, X,Y,W,H );
 
+      oyOptions_Release( &image_tags );
+      return 0;
+}
+
+/** Function oyDrawScreenImage
+ *  @brief   generate a Oyranos image from a given context for display
+ *
+ *  The function asks the 'oydi' node to provide parameters to render a
+ *  oyImage_s from a prepared oyConversion_s context.
+ *
+ *  @param[in]     context             the Oyranos graph
+ *  @param[in,out] ticket              rendering context for tracking
+ *                                     rectangles
+ *  @param[in]     display_rectangle   absolute coordinates of visible image
+ *                                     in relation to display
+ *  @param[in,out] old_display_rectangle
+ *                                     rembering of display_rectangle
+ +  @param[in,out] old_roi_rectangle   remembering of ticket's ROI (optional)
+ *  @param[in]     system_type         the system dependent type specification
+ *                                     - "X11" is well supported
+ *                                     - "oy-test" for internal tests
+ *  @param[in]     data_type_request   oyUINT8 or oyUINT16
+ *  @param[in]     display             the system display with system_type:
+ *                                     - "X11": a Display object
+ *  @param[in]     window              the system window with system_type:
+ *                                     - "X11": a Window ID
+ *  @param[in]     dirty               explicite redraw
+ *  @param[out]    image               the image from graph to display
+ *  @return                            0 - success, -1 - issue, >=  1 - error
+ *
+ *  @version Oyranos: 0.9.6
+ *  @date    2016/09/22
+ *  @since   2010/09/05 (Oyranos: 0.1.11)
+ */
+int  oyDrawScreenImage               ( oyConversion_s    * context,
+                                       oyPixelAccess_s   * ticket,
+                                       oyRectangle_s     * display_rectangle,
+                                       oyRectangle_s     * old_display_rectangle,
+                                       oyRectangle_s     * old_roi_rectangle,
+                                       const char        * system_type,
+                                       oyDATATYPE_e        data_type_request,
+                                       void              * display,
+                                       void              * window,
+                                       int                 dirty,
+                                       oyImage_s         * image )
+{
+  int result = 0;
+
+    if(context)
+    {
+      oyFilterNode_s * node_out = 0;
+      oyRectangle_s * disp_rectangle = 0,
+                    * ticket_roi = 0;
+      int error = oyDrawScreenImageTags_( image, ticket, display_rectangle,
+                                          system_type, data_type_request,
+                                          display, window, &disp_rectangle );
+      if(error)
+        return error;
 
       node_out = oyConversion_GetNode( context, OY_OUTPUT );
       ticket_roi = oyPixelAccess_GetArrayROI( ticket );
@@ -387,8 +408,8 @@ int  oyDrawScreenImage               ( oyConversion_s    * context,
            dirty > 0))
       {
 #ifdef DEBUG_
-        printf( "%s:%d new display rectangle: %s +%g+%g\n", __FILE__,__LINE__,
-                oyRectangle_Show(disp_rectangle), X, Y ),
+        printf( "%s:%d new display rectangle: %s\n", __FILE__,__LINE__,
+                oyRectangle_Show(disp_rectangle) );
 #endif
 
         /* convert the image data */
@@ -410,7 +431,6 @@ int  oyDrawScreenImage               ( oyConversion_s    * context,
       }
 
       oyFilterNode_Release( &node_out );
-      oyOptions_Release( &image_tags );
       oyRectangle_Release( &disp_rectangle );
       oyRectangle_Release( &ticket_roi );
     }
@@ -468,3 +488,776 @@ oyProfile_s * getEditingProfile      ( )
   return editing;
 }
 
+
+
+/* --- asynchronous tile rendering --- */
+
+#include <oyArray2d_s.h>
+#include <oyRectangle_s.h>
+#include <oyranos_threads.h>
+#include <stdlib.h>
+#if defined(HAVE_POSIX)
+#include <unistd.h>
+#endif
+
+typedef enum {
+  oyTILE_EMPTY,                        /**< free slot */
+  oyTILE_QUEUED,                       /**< waiting for a oyJob_s worker */
+  oyTILE_RENDERING,                    /**< inside oyConversion_RunPixels() */
+  oyTILE_READY                         /**< array can be shown */
+} oyTILE_e;
+
+typedef struct {
+  int           column;
+  int           row;
+  oyTILE_e      state;
+  int           wanted;                /**< generation of the last request */
+  unsigned long used;                  /**< LRU stamp */
+  oyArray2d_s * array;
+} oyDisplayTile_s;
+
+/** @struct  oyDisplayTiles_s
+ *  @brief   asynchronous tile cache for a display conversion
+ *
+ *  The output image of a conversion is split into square tiles. Each
+ *  oyDisplayTiles_Request() marks the tiles of the visible view and of
+ *  the view predicted from the scroll direction. Missing tiles are
+ *  rendered with own oyPixelAccess_s tickets inside oyJob_s workers.
+ *  A newer request makes the older tickets stale. Workers skip stale
+ *  tickets, which keeps panning responsive on large images.
+ *
+ *  The workers call oyConversion_RunPixels() concurrently on the one
+ *  conversion of the cache, each with a own ticket and array. This relies
+ *  on the filter contexts being prepared in oyDisplayTiles_New() and on
+ *  the nodes keeping per run state in the ticket. The managing thread
+ *  must not change node options or images of the conversion while tiles
+ *  are pending; call oyDisplayTiles_Invalidate() after such changes.
+ *
+ *  All fields are guarded by the oy_ lock.
+ */
+struct oyDisplayTiles_s {
+  oyObject_s       oy_;
+  oyConversion_s * context;
+  int              tile_size;
+  int              width;              /**< output image width */
+  int              height;
+  int              columns;
+  int              rows;
+  oyPixel_t        layout;
+  oyDisplayTile_s * cache;
+  int              cache_n;
+  int              generation;
+  int              epoch;              /**< counts oyDisplayTiles_Invalidate() */
+  unsigned long    clock;
+  int              pending;            /**< jobs, which did not yet return */
+  int              rendered;
+  int              cancelled;
+  int              hits;
+};
+
+/* oyJob_s::context; oyJob_Release() frees it with release() */
+typedef struct {
+  oyOBJECT_e           type_;
+  oyStruct_Copy_f      copy;
+  oyStruct_Release_f   release;
+  oyObject_s           oy_;
+  oyDisplayTiles_s   * tiles;
+  int                  slot;
+} oyDisplayTileJob_s;
+
+static int oyDisplayTileJob_Release_ ( oyStruct_s       ** job )
+{
+  if(job && *job)
+  {
+    free( *job );
+    *job = NULL;
+  }
+  return 0;
+}
+
+static int oyDisplayTiles_NoWork_    ( oyJob_s           * job OY_UNUSED )
+{ return 0; }
+
+/* render one tile into a new array; runs in any thread */
+static int oyDisplayTiles_Render_    ( oyDisplayTiles_s  * tiles,
+                                       int                 column,
+                                       int                 row,
+                                       oyArray2d_s      ** array )
+{
+  int x = column * tiles->tile_size,
+      y = row * tiles->tile_size,
+      w = OY_MIN( tiles->tile_size, tiles->width - x ),
+      h = OY_MIN( tiles->tile_size, tiles->height - y ),
+      error = 0;
+  oyArray2d_s * a = oyArray2d_Create( NULL, w * oyToChannels_m(tiles->layout),
+                                      h, oyToDataType_m(tiles->layout), NULL );
+  oyFilterNode_s * node_out = oyConversion_GetNode( tiles->context, OY_OUTPUT );
+  oyFilterPlug_s * plug = oyFilterNode_GetPlug( node_out, 0 );
+  oyPixelAccess_s * ticket = oyPixelAccess_Create( 0,0, plug,
+                                                   oyPIXEL_ACCESS_IMAGE, NULL );
+  oyRectangle_s * roi = oyRectangle_NewWith( 0,0, w,h, NULL );
+
+  if(!a || !ticket)
+    error = 1;
+
+  if(!error)
+  {
+    oyPixelAccess_SetArray( ticket, a, 0 );
+    /* the ROI is relative to the tile array width */
+    oyRectangle_Scale( roi, 1.0/w );
+    error = oyPixelAccess_ChangeRectangle( ticket, x/(double)tiles->width,
+                                           y/(double)tiles->width, roi );
+  }
+  if(error <= 0)
+    error = oyConversion_RunPixels( tiles->context, ticket );
+
+  oyRectangle_Release( &roi );
+  oyPixelAccess_Release( &ticket );
+  oyFilterPlug_Release( &plug );
+  oyFilterNode_Release( &node_out );
+
+  if(error > 0)
+    oyArray2d_Release( &a );
+  *array = a;
+
+  return error;
+}
+
+/* oyJob_s::work */
+static int oyDisplayTiles_Work_      ( oyJob_s           * job )
+{
+  oyDisplayTileJob_s * ctx = (oyDisplayTileJob_s*) job->context;
+  oyDisplayTiles_s * tiles = ctx->tiles;
+  oyDisplayTile_s * tile;
+  oyArray2d_s * a = NULL;
+  int column, row, epoch, error;
+
+  oyObject_Lock( tiles->oy_, __FILE__, __LINE__ );
+  tile = &tiles->cache[ctx->slot];
+  if(tile->state != oyTILE_QUEUED || tile->wanted != tiles->generation)
+  {
+    /* stale ticket from a older view */
+    if(tile->state == oyTILE_QUEUED)
+      tile->state = oyTILE_EMPTY;
+    ++tiles->cancelled;
+    --tiles->pending;
+    oyObject_UnLock( tiles->oy_, __FILE__, __LINE__ );
+    return -1;
+  }
+  tile->state = oyTILE_RENDERING;
+  column = tile->column;
+  row = tile->row;
+  epoch = tiles->epoch;
+  oyObject_UnLock( tiles->oy_, __FILE__, __LINE__ );
+
+  error = oyDisplayTiles_Render_( tiles, column, row, &a );
+
+  oyObject_Lock( tiles->oy_, __FILE__, __LINE__ );
+  /* the source changed during rendering */
+  if(epoch != tiles->epoch)
+    oyArray2d_Release( &a );
+  tile->array = a;
+  tile->state = a ? oyTILE_READY : oyTILE_EMPTY;
+  ++tiles->rendered;
+  --tiles->pending;
+  oyObject_UnLock( tiles->oy_, __FILE__, __LINE__ );
+
+  return error;
+}
+
+/* find or allocate the slot of a tile; call with lock held */
+static int oyDisplayTiles_Slot_      ( oyDisplayTiles_s  * tiles,
+                                       int                 column,
+                                       int                 row )
+{
+  int i, slot = -1;
+  unsigned long oldest = (unsigned long)-1;
+
+  for(i = 0; i < tiles->cache_n; ++i)
+    if(tiles->cache[i].state != oyTILE_EMPTY &&
+       tiles->cache[i].column == column && tiles->cache[i].row == row)
+      return i;
+
+  /* evict the least recently used tile outside the current request */
+  for(i = 0; i < tiles->cache_n; ++i)
+  {
+    oyDisplayTile_s * tile = &tiles->cache[i];
+    if(tile->state == oyTILE_EMPTY)
+    {
+      slot = i;
+      break;
+    }
+    if(tile->state == oyTILE_READY && tile->wanted != tiles->generation &&
+       tile->used < oldest)
+    {
+      oldest = tile->used;
+      slot = i;
+    }
+  }
+
+  if(slot >= 0)
+  {
+    oyDisplayTile_s * tile = &tiles->cache[slot];
+    oyArray2d_Release( &tile->array );
+    tile->column = column;
+    tile->row = row;
+    tile->state = oyTILE_EMPTY;
+  }
+
+  return slot;
+}
+
+/* mark the tiles covering view; returns visible tiles, which are not ready */
+static int oyDisplayTiles_Mark_      ( oyDisplayTiles_s  * tiles,
+                                       double              x,
+                                       double              y,
+                                       double              w,
+                                       double              h,
+                                       int               * queue,
+                                       int               * queue_n )
+{
+  int c0 = OY_MAX( 0, (int)(x / tiles->tile_size) ),
+      r0 = OY_MAX( 0, (int)(y / tiles->tile_size) ),
+      c1 = OY_MIN( tiles->columns - 1, (int)((x + w - 1) / tiles->tile_size) ),
+      r1 = OY_MIN( tiles->rows - 1, (int)((y + h - 1) / tiles->tile_size) ),
+      c, r, missing = 0;
+
+  for(r = r0; r <= r1; ++r)
+    for(c = c0; c <= c1; ++c)
+    {
+      int slot = oyDisplayTiles_Slot_( tiles, c, r );
+      oyDisplayTile_s * tile;
+
+      if(slot < 0)
+      {
+        ++missing;
+        continue;
+      }
+
+      tile = &tiles->cache[slot];
+      if(tile->wanted == tiles->generation)
+      {
+        /* already marked by this request */
+        if(tile->state != oyTILE_READY)
+          ++missing;
+        continue;
+      }
+      tile->wanted = tiles->generation;
+      tile->used = ++tiles->clock;
+      if(tile->state == oyTILE_READY)
+        ++tiles->hits;
+      else
+      {
+        ++missing;
+        if(tile->state == oyTILE_EMPTY)
+        {
+          tile->state = oyTILE_QUEUED;
+          queue[(*queue_n)++] = slot;
+        }
+      }
+    }
+
+  return missing;
+}
+
+static void oyDisplayTiles_Queue_    ( oyDisplayTiles_s  * tiles,
+                                       int                 slot )
+{
+  oyJob_s * job = oyJob_New( NULL );
+  oyDisplayTileJob_s * ctx = (oyDisplayTileJob_s*) calloc( 1, sizeof(oyDisplayTileJob_s) );
+
+  ctx->release = oyDisplayTileJob_Release_;
+  ctx->tiles = tiles;
+  ctx->slot = slot;
+  job->context = (oyStruct_s*) ctx;
+  job->work = oyDisplayTiles_Work_;
+  job->cb_progress = NULL;
+  oyJob_Add( &job, 0, 0 );
+}
+
+/** Function oyDisplayTiles_New
+ *  @brief   create a tile cache for a conversion
+ *
+ *  @param[in]     context             the prepared conversion; its output
+ *                                     image defines the tile grid
+ *  @param[in]     tile_size           edge length of the square tiles
+ *  @param[in]     cache_tiles         number of cached tiles
+ *  @return                            the tile cache or NULL
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2026/10/19
+ *  @since   2026/10/19 (Oyranos: 0.9.7)
+ */
+oyDisplayTiles_s * oyDisplayTiles_New( oyConversion_s    * context,
+                                       int                 tile_size,
+                                       int                 cache_tiles )
+{
+  oyDisplayTiles_s * tiles;
+  oyImage_s * image = oyConversion_GetImage( context, OY_OUTPUT );
+  oyFilterGraph_s * graph;
+
+  if(!image || tile_size <= 0 || cache_tiles <= 0)
+  {
+    oyImage_Release( &image );
+    return NULL;
+  }
+
+  tiles = (oyDisplayTiles_s*) calloc( 1, sizeof(oyDisplayTiles_s) );
+  tiles->cache = (oyDisplayTile_s*) calloc( cache_tiles, sizeof(oyDisplayTile_s) );
+  tiles->cache_n = cache_tiles;
+  tiles->context = oyConversion_Copy( context, NULL );
+  tiles->tile_size = tile_size;
+  tiles->width = oyImage_GetWidth( image );
+  tiles->height = oyImage_GetHeight( image );
+  tiles->columns = (tiles->width + tile_size - 1) / tile_size;
+  tiles->rows = (tiles->height + tile_size - 1) / tile_size;
+  tiles->layout = oyImage_GetPixelLayout( image, oyLAYOUT );
+  tiles->generation = 1;
+  oyImage_Release( &image );
+
+  /* prepare the contexts here, so workers only run pixels */
+  graph = oyConversion_GetGraph( context );
+  oyFilterGraph_PrepareContexts( graph, 0 );
+  oyFilterGraph_Release( &graph );
+
+  /* the job threads set up the locking functions on first use */
+  if(!oyThreadLockingReady())
+  {
+    oyJob_s * job = oyJob_New( NULL );
+    job->work = oyDisplayTiles_NoWork_;
+    job->cb_progress = NULL;
+    oyJob_Add( &job, 0, 0 );
+  }
+  tiles->oy_ = oyObject_New( "oyDisplayTiles_s" );
+
+  return tiles;
+}
+
+/** Function oyDisplayTiles_Release
+ *  @brief   cancel pending tiles and release the cache
+ *
+ *  Waits for running workers, as they access the cache.
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2026/10/19
+ *  @since   2026/10/19 (Oyranos: 0.9.7)
+ */
+void oyDisplayTiles_Release          ( oyDisplayTiles_s ** tiles )
+{
+  oyDisplayTiles_s * s;
+  int i;
+
+  if(!tiles || !*tiles)
+    return;
+
+  s = *tiles;
+  *tiles = NULL;
+
+  oyDisplayTiles_Cancel( s );
+  while(oyDisplayTiles_Wait( s, 1.0 ) > 0)
+    ;
+
+  for(i = 0; i < s->cache_n; ++i)
+    oyArray2d_Release( &s->cache[i].array );
+  free( s->cache );
+  oyConversion_Release( &s->context );
+  oyObject_Release( &s->oy_ );
+  free( s );
+}
+
+/** Function oyDisplayTiles_Request
+ *  @brief   request the tiles of a view
+ *
+ *  The tiles covering view are requested first. When dx or dy are not
+ *  zero, the next view in that scroll direction is requested as well for
+ *  prefetching. All tickets of older requests become stale and are
+ *  skipped by the workers, unless the new request covers them again.
+ *
+ *  @param[in]     tiles               the tile cache
+ *  @param[in]     view                the visible area in output image
+ *                                     pixels
+ *  @param[in]     dx                  horizontal scroll direction
+ *  @param[in]     dy                  vertical scroll direction
+ *  @param[in]     flags               OY_DISPLAY_TILES_SYNC - render
+ *                                     missing visible tiles before
+ *                                     returning
+ *  @return                            count of visible tiles not yet
+ *                                     ready; -1 on error
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2026/10/19
+ *  @since   2026/10/19 (Oyranos: 0.9.7)
+ */
+int  oyDisplayTiles_Request          ( oyDisplayTiles_s  * tiles,
+                                       oyRectangle_s     * view,
+                                       double              dx,
+                                       double              dy,
+                                       int                 flags )
+{
+  double x, y, w, h;
+  int * visible, * predicted, visible_n = 0, predicted_n = 0, missing, i;
+
+  if(!tiles || !view)
+    return -1;
+
+  oyRectangle_GetGeo( view, &x, &y, &w, &h );
+  if(w <= 0 || h <= 0)
+    return -1;
+
+  visible = (int*) calloc( 2 * tiles->cache_n, sizeof(int) );
+  predicted = visible + tiles->cache_n;
+
+  oyObject_Lock( tiles->oy_, __FILE__, __LINE__ );
+  ++tiles->generation;
+  missing = oyDisplayTiles_Mark_( tiles, x, y, w, h, visible, &visible_n );
+  if(dx != 0.0 || dy != 0.0)
+    oyDisplayTiles_Mark_( tiles, x + (dx > 0 ? w : dx < 0 ? -w : 0),
+                                 y + (dy > 0 ? h : dy < 0 ? -h : 0), w, h,
+                          predicted, &predicted_n );
+  if(flags & OY_DISPLAY_TILES_SYNC)
+    for(i = 0; i < visible_n; ++i)
+      tiles->cache[visible[i]].state = oyTILE_RENDERING;
+  tiles->pending += predicted_n;
+  if(!(flags & OY_DISPLAY_TILES_SYNC))
+    tiles->pending += visible_n;
+  oyObject_UnLock( tiles->oy_, __FILE__, __LINE__ );
+
+  /* the trds job queue runs the latest added job first */
+  for(i = 0; i < predicted_n; ++i)
+    oyDisplayTiles_Queue_( tiles, predicted[i] );
+
+  if(flags & OY_DISPLAY_TILES_SYNC)
+  {
+    for(i = 0; i < visible_n; ++i)
+    {
+      oyDisplayTile_s * tile = &tiles->cache[visible[i]];
+      oyArray2d_s * a = NULL;
+
+      oyDisplayTiles_Render_( tiles, tile->column, tile->row, &a );
+
+      oyObject_Lock( tiles->oy_, __FILE__, __LINE__ );
+      tile->array = a;
+      tile->state = a ? oyTILE_READY : oyTILE_EMPTY;
+      ++tiles->rendered;
+      if(a)
+        --missing;
+      oyObject_UnLock( tiles->oy_, __FILE__, __LINE__ );
+    }
+  } else
+    for(i = 0; i < visible_n; ++i)
+      oyDisplayTiles_Queue_( tiles, visible[i] );
+
+  free( visible );
+
+  return missing;
+}
+
+/** Function oyDisplayTiles_Get
+ *  @brief   get a ready tile
+ *
+ *  @return                            a array reference or NULL, if the tile
+ *                                     is not yet rendered
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2026/10/19
+ *  @since   2026/10/19 (Oyranos: 0.9.7)
+ */
+oyArray2d_s * oyDisplayTiles_Get     ( oyDisplayTiles_s  * tiles,
+                                       int                 column,
+                                       int                 row )
+{
+  oyArray2d_s * a = NULL;
+  int i;
+
+  if(!tiles)
+    return NULL;
+
+  oyObject_Lock( tiles->oy_, __FILE__, __LINE__ );
+  for(i = 0; i < tiles->cache_n; ++i)
+  {
+    oyDisplayTile_s * tile = &tiles->cache[i];
+    if(tile->state == oyTILE_READY &&
+       tile->column == column && tile->row == row)
+    {
+      tile->used = ++tiles->clock;
+      a = oyArray2d_Copy( tile->array, NULL );
+      break;
+    }
+  }
+  oyObject_UnLock( tiles->oy_, __FILE__, __LINE__ );
+
+  return a;
+}
+
+/** Function oyDisplayTiles_Cancel
+ *  @brief   make all queued tickets stale
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2026/10/19
+ *  @since   2026/10/19 (Oyranos: 0.9.7)
+ */
+void oyDisplayTiles_Cancel           ( oyDisplayTiles_s  * tiles )
+{
+  if(!tiles)
+    return;
+
+  oyObject_Lock( tiles->oy_, __FILE__, __LINE__ );
+  ++tiles->generation;
+  oyObject_UnLock( tiles->oy_, __FILE__, __LINE__ );
+}
+
+/** Function oyDisplayTiles_Invalidate
+ *  @brief   drop all rendered tiles
+ *
+ *  Call after the source pixels or the conversion changed. Queued
+ *  tickets become stale and tiles in rendering are discarded on return.
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2026/10/19
+ *  @since   2026/10/19 (Oyranos: 0.9.7)
+ */
+void oyDisplayTiles_Invalidate       ( oyDisplayTiles_s  * tiles )
+{
+  int i;
+
+  if(!tiles)
+    return;
+
+  oyObject_Lock( tiles->oy_, __FILE__, __LINE__ );
+  ++tiles->generation;
+  ++tiles->epoch;
+  for(i = 0; i < tiles->cache_n; ++i)
+  {
+    oyDisplayTile_s * tile = &tiles->cache[i];
+    if(tile->state == oyTILE_READY)
+    {
+      oyArray2d_Release( &tile->array );
+      tile->state = oyTILE_EMPTY;
+    }
+  }
+  oyObject_UnLock( tiles->oy_, __FILE__, __LINE__ );
+}
+
+/** Function oyDisplayTiles_Blit
+ *  @brief   copy the ready tiles of a view into a frame buffer
+ *
+ *  Pixels of not yet rendered tiles are left untouched.
+ *
+ *  @param[in]     tiles               the tile cache
+ *  @param[in]     view                the area in output image pixels;
+ *                                     its top left corner goes to buffer
+ *  @param[out]    buffer              interleaved pixels in the layout of
+ *                                     the conversion output image
+ *  @param[in]     stride              bytes per buffer line
+ *  @return                            count of tiles not yet ready
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2026/10/19
+ *  @since   2026/10/19 (Oyranos: 0.9.7)
+ */
+int  oyDisplayTiles_Blit             ( oyDisplayTiles_s  * tiles,
+                                       oyRectangle_s     * view,
+                                       oyPointer           buffer,
+                                       int                 stride )
+{
+  double x, y, w, h;
+  int c0, r0, c1, r1, c, r, missing = 0, pixel_size;
+
+  if(!tiles || !view || !buffer)
+    return -1;
+
+  oyRectangle_GetGeo( view, &x, &y, &w, &h );
+  if(w <= 0 || h <= 0)
+    return 0;
+
+  pixel_size = oyToChannels_m(tiles->layout) *
+               oyDataTypeGetSize( oyToDataType_m(tiles->layout) );
+  c0 = OY_MAX( 0, (int)(x / tiles->tile_size) );
+  r0 = OY_MAX( 0, (int)(y / tiles->tile_size) );
+  c1 = OY_MIN( tiles->columns - 1, (int)((x + w - 1) / tiles->tile_size) );
+  r1 = OY_MIN( tiles->rows - 1, (int)((y + h - 1) / tiles->tile_size) );
+
+  for(r = r0; r <= r1; ++r)
+    for(c = c0; c <= c1; ++c)
+    {
+      oyArray2d_s * a = oyDisplayTiles_Get( tiles, c, r );
+      unsigned char ** rows;
+      int tx = c * tiles->tile_size, ty = r * tiles->tile_size,
+          tw = OY_MIN( tiles->tile_size, tiles->width - tx ),
+          th = OY_MIN( tiles->tile_size, tiles->height - ty ),
+          /* intersection of tile and view in image pixels */
+          ix0 = OY_MAX( tx, (int)x ), iy0 = OY_MAX( ty, (int)y ),
+          ix1 = OY_MIN( tx + tw, (int)(x + w) ),
+          iy1 = OY_MIN( ty + th, (int)(y + h) ), j;
+
+      if(!a)
+      {
+        ++missing;
+        continue;
+      }
+
+      rows = (unsigned char**) oyArray2d_GetData( a );
+      for(j = iy0; j < iy1; ++j)
+        memcpy( (unsigned char*)buffer + (j - (int)y) * stride +
+                                         (ix0 - (int)x) * pixel_size,
+                rows[j - ty] + (ix0 - tx) * pixel_size,
+                (ix1 - ix0) * pixel_size );
+
+      oyArray2d_Release( &a );
+    }
+
+  return missing;
+}
+
+/** Function oyDisplayTiles_Poll
+ *  @brief   collect finished jobs from the managing thread
+ *
+ *  @return                            count of pending tiles
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2026/10/19
+ *  @since   2026/10/19 (Oyranos: 0.9.7)
+ */
+int  oyDisplayTiles_Poll             ( oyDisplayTiles_s  * tiles )
+{
+  int pending, i;
+
+  if(!tiles)
+    return 0;
+
+  oyObject_Lock( tiles->oy_, __FILE__, __LINE__ );
+  pending = tiles->pending;
+  oyObject_UnLock( tiles->oy_, __FILE__, __LINE__ );
+
+  /* release finished oyJob_s objects */
+  for(i = 0; i < tiles->cache_n; ++i)
+    oyJobResult();
+
+  return pending;
+}
+
+/** Function oyDisplayTiles_Wait
+ *  @brief   wait until no tile is pending
+ *
+ *  @param[in]     tiles               the tile cache
+ *  @param[in]     seconds             maximum time to wait
+ *  @return                            count of still pending tiles
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2026/10/19
+ *  @since   2026/10/19 (Oyranos: 0.9.7)
+ */
+int  oyDisplayTiles_Wait             ( oyDisplayTiles_s  * tiles,
+                                       double              seconds )
+{
+  int pending = oyDisplayTiles_Poll( tiles ),
+      ms = (int)(seconds * 1000);
+
+  while(pending > 0 && ms-- > 0)
+  {
+#if defined(HAVE_POSIX)
+    usleep( 1000 );
+#endif
+    pending = oyDisplayTiles_Poll( tiles );
+  }
+
+  return pending;
+}
+
+/** Function oyDisplayTiles_GetCounts
+ *  @brief   statistics for tuning
+ *
+ *  @param[in]     tiles               the tile cache
+ *  @param[out]    rendered            finished tile renderings
+ *  @param[out]    cancelled           skipped stale tickets
+ *  @param[out]    hits                requested tiles found ready
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2026/10/19
+ *  @since   2026/10/19 (Oyranos: 0.9.7)
+ */
+void oyDisplayTiles_GetCounts        ( oyDisplayTiles_s  * tiles,
+                                       int               * rendered,
+                                       int               * cancelled,
+                                       int               * hits )
+{
+  if(!tiles)
+    return;
+
+  oyObject_Lock( tiles->oy_, __FILE__, __LINE__ );
+  if(rendered) *rendered = tiles->rendered;
+  if(cancelled) *cancelled = tiles->cancelled;
+  if(hits) *hits = tiles->hits;
+  oyObject_UnLock( tiles->oy_, __FILE__, __LINE__ );
+}
+
+/** Function oyDrawScreenImageTiles
+ *  @brief   request the tiles of a view for display
+ *
+ *  The tiled counterpart of oyDrawScreenImage(). The output image is tagged
+ *  for the 'oydi' node the same way. The cached tiles are dropped, when
+ *  the display rectangle moved, as the node may then select a other
+ *  monitor profile, or on dirty. The pixels come from
+ *  oyDisplayTiles_Blit() or oyDisplayTiles_Get(). Without
+ *  OY_DISPLAY_TILES_SYNC in flags the caller shall call
+ *  oyDisplayTiles_Poll() from its event loop and draw again, while tiles
+ *  are missing.
+ *
+ *  @param[in]     tiles               the tile cache of the display conversion
+ *  @param[in]     view                the visible area in output image pixels
+ *  @param[in]     dx                  horizontal scroll direction
+ *  @param[in]     dy                  vertical scroll direction
+ *  @param[in]     flags               see oyDisplayTiles_Request()
+ *  @param[in]     display_rectangle   absolute coordinates of visible image
+ *                                     in relation to display
+ *  @param[in,out] old_display_rectangle
+ *                                     rembering of display_rectangle
+ *  @param[in]     system_type         see oyDrawScreenImage()
+ *  @param[in]     data_type_request   oyUINT8 or oyUINT16
+ *  @param[in]     display             the system display
+ *  @param[in]     window              the system window
+ *  @param[in]     dirty               explicite redraw
+ *  @param[in]     image               the output image of the conversion
+ *  @return                            count of visible tiles not yet
+ *                                     ready; -1 on error
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2026/10/19
+ *  @since   2026/10/19 (Oyranos: 0.9.7)
+ */
+int  oyDrawScreenImageTiles          ( oyDisplayTiles_s  * tiles,
+                                       oyRectangle_s     * view,
+                                       double              dx,
+                                       double              dy,
+                                       int                 flags,
+                                       oyRectangle_s     * display_rectangle,
+                                       oyRectangle_s     * old_display_rectangle,
+                                       const char        * system_type,
+                                       oyDATATYPE_e        data_type_request,
+                                       void              * display,
+                                       void              * window,
+                                       int                 dirty,
+                                       oyImage_s         * image )
+{
+  oyRectangle_s * disp_rectangle = 0;
+  int error;
+
+  if(!tiles)
+    return -1;
+
+  error = oyDrawScreenImageTags_( image, NULL, display_rectangle, system_type,
+                                  data_type_request, display, window,
+                                  &disp_rectangle );
+  if(error)
+    return -1;
+
+  if(!oyRectangle_IsEqual( disp_rectangle, old_display_rectangle ) ||
+     dirty > 0)
+  {
+    oyDisplayTiles_Invalidate( tiles );
+    oyRectangle_SetByRectangle( old_display_rectangle, disp_rectangle );
+  }
+  oyRectangle_Release( &disp_rectangle );
+
+  return oyDisplayTiles_Request( tiles, view, dx, dy, flags );
+}
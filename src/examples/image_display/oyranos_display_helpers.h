@@ -2,7 +2,7 @@
  *  Oyranos is an open source Color Management System 
  * 
  *  @par Copyright:
- *            2009-2012 (C) Kai-Uwe Behrmann
+ *            2009-2026 (C) Kai-Uwe Behrmann
  *
  *  @author   Kai-Uwe Behrmann <ku.b@gmx.de>
  *  @par License:
@@ -57,6 +57,48 @@ int  oyDrawScreenImage               ( oyConversion_s    * context,
                                        oyImage_s         * image );
 oyProfile_s * getEditingProfile      ( );
 
+/** @brief   asynchronous tile cache for a display conversion */
+typedef struct oyDisplayTiles_s oyDisplayTiles_s;
+#define OY_DISPLAY_TILES_SYNC 0x01     /**< render missing visible tiles in the calling thread */
+oyDisplayTiles_s * oyDisplayTiles_New( oyConversion_s    * context,
+                                       int                 tile_size,
+                                       int                 cache_tiles );
+void oyDisplayTiles_Release          ( oyDisplayTiles_s ** tiles );
+int  oyDisplayTiles_Request          ( oyDisplayTiles_s  * tiles,
+                                       oyRectangle_s     * view,
+                                       double              dx,
+                                       double              dy,
+                                       int                 flags );
+oyArray2d_s * oyDisplayTiles_Get     ( oyDisplayTiles_s  * tiles,
+                                       int                 column,
+                                       int                 row );
+void oyDisplayTiles_Cancel           ( oyDisplayTiles_s  * tiles );
+void oyDisplayTiles_Invalidate       ( oyDisplayTiles_s  * tiles );
+int  oyDisplayTiles_Blit             ( oyDisplayTiles_s  * tiles,
+                                       oyRectangle_s     * view,
+                                       oyPointer           buffer,
+                                       int                 stride );
+int  oyDisplayTiles_Poll             ( oyDisplayTiles_s  * tiles );
+int  oyDisplayTiles_Wait             ( oyDisplayTiles_s  * tiles,
+                                       double              seconds );
+void oyDisplayTiles_GetCounts        ( oyDisplayTiles_s  * tiles,
+                                       int               * rendered,
+                                       int               * cancelled,
+                                       int               * hits );
+int  oyDrawScreenImageTiles          ( oyDisplayTiles_s  * tiles,
+                                       oyRectangle_s     * view,
+                                       double              dx,
+                                       double              dy,
+                                       int                 flags,
+                                       oyRectangle_s     * display_rectangle,
+                                       oyRectangle_s     * old_display_rectangle,
+                                       const char        * system_type,
+                                       oyDATATYPE_e        data_type_request,
+                                       void              * display,
+                                       void              * window,
+                                       int                 dirty,
+                                       oyImage_s         * image );
+
 #ifdef XCM_HAVE_X11
 #include <X11/Xlib.h>
 #endif
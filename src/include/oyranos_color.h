@@ -124,6 +124,42 @@ const char * oyMat4show ( const float a[4] );
 const char * oyMat43show ( const float a[4][3] );
 const char * oyCIExyYTriple_Show( oyCIExyYTriple * triple );
 
+/** \addtogroup color_low
+ *  @{ */
+
+/** @brief Precomputed spectral integration weights
+ *
+ *  Create with oySpectralWeightsCreate() for one band layout.
+ */
+typedef struct {
+  int      start;                      /**< first band in nm */
+  int      lambda;                     /**< band step in nm */
+  int      bands;                      /**< number of bands */
+  int      stdobs;                     /**< standard observer; 2 or 10 */
+  double   white[3];                   /**< unscaled illuminant XYZ sums */
+  double * weights;                    /**< planar X, Y and Z weights; 3 * bands */
+} oySpectralWeights_s;
+
+/** @} */ /* color_low */
+
+oySpectralWeights_s * oySpectralWeightsCreate (
+                                       int                 start,
+                                       int                 lambda,
+                                       int                 bands,
+                                       int                 stdobs,
+                                       const float       * illu_300_830_5nm );
+void         oySpectralWeightsRelease( oySpectralWeights_s ** weights );
+int          oySpectralToXYZ         ( const oySpectralWeights_s * weights,
+                                       const double      * spectra,
+                                       int                 count,
+                                       int                 stride,
+                                       double            * XYZ );
+int          oySpectralToLab         ( const oySpectralWeights_s * weights,
+                                       const double      * spectra,
+                                       int                 count,
+                                       int                 stride,
+                                       double            * CIELab );
+
 #ifdef __cplusplus
 } /* extern "C" */
 #endif /* __cplusplus */
@@ -122,6 +122,16 @@
  *  @since 0.9.0
  */
 #define OY_DEBUG_SIGNALS               "OY_DEBUG_SIGNALS"
+/** @brief Oyranos profiling environment variable
+ *
+ *  Maps to ::oy_stats variable. Filter nodes count runs, pixels, time
+ *  and context cache use. Read the counters with oyConversion_GetStats().
+ *
+ *  @see @ref debug_vars
+ *
+ *  @since 0.9.7
+ */
+#define OY_STATS                       "OY_STATS"
 /** @brief Oyranos debug environment variable
  *
  *  Selects a prefered module to run the configuration engine with
@@ -3,7 +3,7 @@
  *  Oyranos is an open source Color Management System 
  *
  *  @par Copyright:
- *            2007-2019 (C) Kai-Uwe Behrmann
+ *            2007-2026 (C) Kai-Uwe Behrmann
  *
  *  @brief    ICC definitions
  *  @internal
@@ -265,6 +265,66 @@ typedef struct {
 #define icSigHPGamutDescTag 1735226433 /* gmtA */
 #endif
 
+/** @brief read only view of a ICC tag inside a profile block
+ *  @ingroup icc_low
+ *
+ *  The view points into the profile memory without copying. It is valid as
+ *  long as that memory stays unchanged. The tag data are big endian and
+ *  are decoded bounds checked by the oyICCTagView*() functions.
+ *
+ *  @version Oyranos: 0.9.7
+ *  @since   2026/10/19 (Oyranos: 0.9.7)
+ *  @date    2026/10/19
+ */
+typedef struct {
+  icTagSignature       sig;            /**< tag signature */
+  icTagTypeSignature   type;           /**< tag type signature */
+  const unsigned char * data;          /**< tag data inside the profile block */
+  size_t               size;           /**< tag size in bytes */
+} oyICCTagView_s;
+
+/** @brief read only view of a ICC color lookup table
+ *  @ingroup icc_low
+ *
+ *  Filled by oyICCTagViewGetLut() for mft1, mft2, mAB and mBA tags.
+ *
+ *  @version Oyranos: 0.9.7
+ *  @since   2026/10/19 (Oyranos: 0.9.7)
+ *  @date    2026/10/19
+ */
+typedef struct {
+  int                  channels_in;    /**< input channels */
+  int                  channels_out;   /**< output channels */
+  unsigned char        grid[16];       /**< grid points per input channel */
+  int                  precision;      /**< bytes per CLUT value: 1 or 2 big endian */
+  const unsigned char * clut;          /**< CLUT data or NULL */
+  size_t               clut_size;      /**< CLUT size in bytes */
+} oyICCLutView_s;
+
+int            oyICCTagViewFromMem   ( const void        * block,
+                                       size_t              size,
+                                       icTagSignature      sig,
+                                       oyICCTagView_s    * view );
+int            oyICCTagViewCount     ( const oyICCTagView_s * view );
+int            oyICCTagViewGetCurve  ( const oyICCTagView_s * view,
+                                       icUInt32Number      pos,
+                                       icUInt16Number    * value );
+int            oyICCTagViewGetParametric (
+                                       const oyICCTagView_s * view,
+                                       int               * function_type,
+                                       double              params[7] );
+int            oyICCTagViewGetXYZ    ( const oyICCTagView_s * view,
+                                       int                 pos,
+                                       double              XYZ[3] );
+int            oyICCTagViewGetString ( const oyICCTagView_s * view,
+                                       int                 pos,
+                                       char                locale[6],
+                                       const char       ** text,
+                                       size_t            * bytes,
+                                       int               * utf16be );
+int            oyICCTagViewGetLut    ( const oyICCTagView_s * view,
+                                       oyICCLutView_s    * lut );
+
 #ifdef __cplusplus
 } /* extern "C" */
 #endif /* __cplusplus */
@@ -0,0 +1,2 @@
+void oy_murmur3_128( const void *key, size_t length, uint32_t seed, unsigned char out[16] );
+
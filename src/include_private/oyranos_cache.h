@@ -3,7 +3,7 @@
  *  Oyranos is an open source Color Management System 
  *
  *  @par Copyright:
- *            2004-2017 (C) Kai-Uwe Behrmann
+ *            2004-2026 (C) Kai-Uwe Behrmann
  *
  *  @brief    private Oyranos cache API's
  *  @author   Kai-Uwe Behrmann <ku.b@gmx.de>
@@ -22,11 +22,13 @@
 #include "oyProfiles_s.h"
 #include "oyOptions_s.h"
 #include "oyStructList_s_.h"
+#include "oyHash_s.h"
 extern oyStructList_s_ * oy_profile_s_file_cache_;
 extern oyStructList_s  * oy_cmm_cache_;
 extern oyStructList_s  * oy_cmm_infos_;
 extern oyStructList_s  * oy_cmm_handles_;
 extern oyConfigs_s     * oy_monitors_cache_;
+extern oyStructList_s  * oy_device_index_cache_;
 extern oyProfiles_s    * oy_profile_list_cache_;
 extern oyOptions_s     * oy_db_cache_;
 extern oyOptions_s     * oy_config_options_dummy_;
@@ -35,4 +37,22 @@ int      oyObjectUsedByCache_        ( int                 id );
 int *    get_oy_db_cache_init_();
 void     oyDebugLevelCacheRelease();
 
+/** @internal
+ *  @brief shared cache entry types */
+typedef enum {
+  oySHARED_CACHE_PROFILE = 1,          /**< ICC profile block */
+  oySHARED_CACHE_DEVICE_LINK           /**< oyCMMapi4_s context blob */
+} oySHARED_CACHE_e;
+#define OY_SHARED_CACHE "OY_SHARED_CACHE"
+int      oySharedCacheGet_           ( oyHash_s          * entry,
+                                       oySHARED_CACHE_e    type,
+                                       size_t            * size,
+                                       oyPointer         * block,
+                                       oyAlloc_f           allocateFunc );
+int      oySharedCacheSet_           ( oyHash_s          * entry,
+                                       oySHARED_CACHE_e    type,
+                                       const void        * block,
+                                       size_t              size );
+void     oySharedCacheRelease_       ( void );
+
 #endif /* OYRANOS_CACHE_H */
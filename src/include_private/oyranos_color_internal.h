@@ -3,7 +3,7 @@
  *  Oyranos is an open source Color Management System 
  *
  *  @par Copyright:
- *            2019-2020 (C) Kai-Uwe Behrmann
+ *            2019-2026 (C) Kai-Uwe Behrmann
  *
  *  @internal
  *  @brief    color APIs and more
@@ -23,6 +23,8 @@ extern "C" {
 
 /* libOyranosConfig */
 extern float bb_100K[92][3];
+extern float cieXYZ_31_2[472][3];      /* 1931 2°; first line: start, step, count */
+extern float cieXYZ_64_10[471][3];     /* 1964 10°; 360-830nm */
 double oyEstimateTemperature         ( double              cie_a_,
                                        double              cie_b_,
                                        double            * dist );
@@ -3,7 +3,7 @@
  *  Oyranos is an open source Color Management System 
  *
  *  @par Copyright:
- *            2004-2015 (C) Kai-Uwe Behrmann
+ *            2004-2026 (C) Kai-Uwe Behrmann
  *
  *  @brief    Configuration DB functions
  *  @internal
@@ -34,6 +34,8 @@ extern oyDBSetString_f            oyDBSetString;
 extern oyDBSearchEmptyKeyname_f   oyDBSearchEmptyKeyname;
 extern oyDBEraseKey_f             oyDBEraseKey;
 
+int                oyDbGeneration    ( void );
+
 
 #ifdef __cplusplus
 } /* extern "C" */
@@ -50,6 +50,7 @@ extern int oy_debug_memory;
 #define OY_PRINT_POINTER "0x%tx"
 extern int oy_debug_objects;
 extern int oy_debug_signals;
+extern int oy_stats;
 extern const char * oy_backtrace;
 extern const char * oy_prefered_db_;
 
@@ -189,6 +190,14 @@ int            oyRampManipulateF64   ( double            * ramp1,
                                        double            * ramp_result,
                                        int                 ramp_size,
                                        double            (*manip_f)(double,double) );
+float          oyHalfToFloat         ( uint16_t            h );
+uint16_t       oyFloatToHalf         ( float               f );
+void           oyHalfToFloatLine     ( const uint16_t    * src,
+                                       float             * dst,
+                                       size_t              n );
+void           oyFloatToHalfLine     ( const float       * src,
+                                       uint16_t          * dst,
+                                       size_t              n );
 uint16_t oyByteSwapUInt16            ( uint16_t            v );
 uint32_t oyByteSwapUInt32            ( uint32_t            v );
 int      oyByteSwap                  ( void              * data,
@@ -203,8 +212,9 @@ int                oyMiscBlobGetMD5_ ( const void        * buffer,
 uint32_t           oyMiscBlobL3_     ( const void        * buffer,
                                        size_t              size );
 enum {
-  oyHASH_MD5  = 1,
-  oyHASH_L3   = 2
+  oyHASH_MD5  = 1,                     /**< 128-bit MD5, for IDs */
+  oyHASH_L3   = 2,                     /**< 32-bit lookup3 as decimal text */
+  oyHASH_FAST = 4                      /**< 128-bit MurmurHash3, default */
 };
 int                oyMiscBlobGetHash_( const void        * buffer,
                                        size_t              size,
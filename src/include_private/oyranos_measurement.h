@@ -0,0 +1,69 @@
+/** @file oyranos_measurement.h
+ *
+ *  Oyranos is an open source Color Management System
+ *
+ *  @par Copyright:
+ *            2026 (C) Kai-Uwe Behrmann
+ *
+ *  @brief    measurement file parsing
+ *  @internal
+ *  @author   Kai-Uwe Behrmann <ku.b@gmx.de>
+ *  @par License:
+ *            new BSD <http://www.opensource.org/licenses/BSD-3-Clause>
+ *  @since    2026/10/19
+ */
+
+#ifndef OYRANOS_MEASUREMENT_H
+#define OYRANOS_MEASUREMENT_H
+
+#include <stddef.h>
+#include "oyjl.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/** @brief measurement text formats */
+typedef enum {
+  oyMEASUREMENT_UNKNOWN,               /**< detect from text */
+  oyMEASUREMENT_CSV,                   /**< nm,patch1,patch2,... lines */
+  oyMEASUREMENT_CGATS,                 /**< CGATS.17 / IT8.7 */
+  oyMEASUREMENT_CXF                    /**< CxF3 XML */
+} oyMEASUREMENT_FORMAT_e;
+
+/** @brief parsed measurement table
+ *
+ *  All numeric fields are kept as one double block with columns values
+ *  per patch. The spectral bands are continuous inside each patch and
+ *  can be passed directly to oySpectralToXYZ() with stride = columns.
+ */
+typedef struct {
+  oyMEASUREMENT_FORMAT_e format;       /**< detected format */
+  int      count;                      /**< number of patches */
+  int      columns;                    /**< numeric values per patch */
+  char  ** column_names;               /**< columns field names */
+  double * values;                     /**< count * columns; NAN for missing */
+  char  ** names;                      /**< count patch names or NULL */
+  int      spectral;                   /**< first spectral column */
+  int      bands;                      /**< spectral columns; 0 - none */
+  double   start;                      /**< first band in nm */
+  double   lambda;                     /**< band step in nm */
+  char   * description;                /**< DESCRIPTOR */
+  char   * creator;                    /**< ORIGINATOR */
+  char   * date;                       /**< CREATED */
+  int      capacity;                   /**< @private allocated patches */
+} oyMeasurement_s;
+
+oyMeasurement_s * oyMeasurementParse ( const char        * text,
+                                       size_t              size,
+                                       oyMEASUREMENT_FORMAT_e format );
+int          oyMeasurementFindColumn ( oyMeasurement_s   * m,
+                                       const char        * field );
+oyjl_val     oyMeasurementToTree     ( oyMeasurement_s   * m );
+void         oyMeasurementRelease    ( oyMeasurement_s  ** m );
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif /* __cplusplus */
+
+#endif /* OYRANOS_MEASUREMENT_H */
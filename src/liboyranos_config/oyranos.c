@@ -3,7 +3,7 @@
  *  Oyranos is an open source Color Management System 
  *
  *  @par Copyright:
- *            2004-2015 (C) Kai-Uwe Behrmann
+ *            2004-2026 (C) Kai-Uwe Behrmann
  *
  *  @brief    public Oyranos API's
  *  @author   Kai-Uwe Behrmann <ku.b@gmx.de>
@@ -1172,6 +1172,7 @@ extern oyOption_t_ * oy_option_;
 void oyLibConfigRelease              ( int                 flags )
 {
   oyConfigs_Release( &oy_monitors_cache_ );
+  oyStructList_Release( &oy_device_index_cache_ );
 
   oyFinish_(flags);
 
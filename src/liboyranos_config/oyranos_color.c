@@ -3,7 +3,7 @@
  *  Oyranos is an open source Color Management System 
  *
  *  @par Copyright:
- *            2008-2020 (C) Kai-Uwe Behrmann
+ *            2008-2026 (C) Kai-Uwe Behrmann
  *
  *  @internal
  *  @brief    misc color APIs
@@ -19,8 +19,12 @@
 #include <string.h>
 
 #include "oyranos_color.h"
+#include "oyranos_color_internal.h"
+#include "oyranos_helper.h"
 #include "oyranos_helper_macros.h"
 #include "bb_100K.h"
+#include "ciexyz31_2.h" /* cieXYZ_31_2 1931 2° */
+#include "ciexyz64_1.h" /* cieXYZ_64_10 1964 10° */
 
 /** \addtogroup color Color
  *  @brief Color and Color Management APIs
@@ -474,6 +478,202 @@ const char * oyCIExyYTriple_Show( oyCIExyYTriple * triple )
 }
 
 
+/** @brief Precompute spectral integration weights
+ *
+ *  The illuminant and the color matching functions of the selected
+ *  standard observer are combined into one planar weight vector per
+ *  XYZ channel. Bands outside 360-830nm get a zero weight. The weights
+ *  are scaled to give a perfect reflector Y = 1.0.
+ *
+ *  @param[in]     start               first band in nm
+ *  @param[in]     lambda              band step in nm
+ *  @param[in]     bands               number of bands
+ *  @param[in]     stdobs              standard observer; 2 for 2°, or 10 for 10°
+ *  @param[in]     illu_300_830_5nm    illuminant spd 300-830nm lambda 5nm;
+ *                                     NULL for a equal energy illuminant
+ *  @return                            the weights; release with oySpectralWeightsRelease()
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2026/10/19
+ *  @since   2026/10/19 (Oyranos: 0.9.7)
+ */
+oySpectralWeights_s * oySpectralWeightsCreate (
+                                       int                 start,
+                                       int                 lambda,
+                                       int                 bands,
+                                       int                 stdobs,
+                                       const float       * illu_300_830_5nm )
+{
+  oySpectralWeights_s * w;
+  double * wx, * wy, * wz, scale;
+  int b;
+
+  if(lambda <= 0 || bands <= 0 || (stdobs != 2 && stdobs != 10))
+    return NULL;
+
+  w = (oySpectralWeights_s*) oyAllocateFunc_( sizeof(oySpectralWeights_s) );
+  if(!w) return NULL;
+  memset( w, 0, sizeof(oySpectralWeights_s) );
+  w->weights = (double*) oyAllocateFunc_( 3 * bands * sizeof(double) );
+  if(!w->weights) { oyDeAllocateFunc_( w ); return NULL; }
+  memset( w->weights, 0, 3 * bands * sizeof(double) );
+
+  w->start = start;
+  w->lambda = lambda;
+  w->bands = bands;
+  w->stdobs = stdobs;
+  wx = w->weights;
+  wy = wx + bands;
+  wz = wy + bands;
+
+  for(b = 0; b < bands; ++b)
+  {
+    int nm = start + b * lambda;
+    const float * cmf;
+    double illu = 1.0;
+
+    if(nm < 360 || nm > 830)
+      continue;
+
+    /* the 2° table starts with a header line */
+    cmf = stdobs == 2 ? cieXYZ_31_2[1 + nm - 360] : cieXYZ_64_10[nm - 360];
+
+    if(illu_300_830_5nm)
+    {
+      int i = (nm - 300) / 5, rest = (nm - 300) % 5;
+      illu = illu_300_830_5nm[i];
+      if(rest)
+        illu += (illu_300_830_5nm[i + 1] - illu) * rest / 5.0;
+      illu /= 100.0; /* D50 max ~103 */
+    }
+
+    wx[b] = illu * cmf[0];
+    wy[b] = illu * cmf[1];
+    wz[b] = illu * cmf[2];
+    w->white[0] += wx[b];
+    w->white[1] += wy[b];
+    w->white[2] += wz[b];
+  }
+
+  scale = w->white[1] != 0.0 ? 1.0 / w->white[1] : 0.0;
+  for(b = 0; b < 3 * bands; ++b)
+    w->weights[b] *= scale;
+
+  return w;
+}
+
+/** @brief Release spectral weights
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2026/10/19
+ *  @since   2026/10/19 (Oyranos: 0.9.7)
+ */
+void         oySpectralWeightsRelease( oySpectralWeights_s ** weights )
+{
+  if(!weights || !*weights)
+    return;
+
+  oyDeAllocateFunc_( (*weights)->weights );
+  oyDeAllocateFunc_( *weights );
+  *weights = NULL;
+}
+
+/** @brief Integrate spectra to XYZ
+ *
+ *  Each spectrum is reduced to XYZ by three dot products with the
+ *  precomputed weights. The samples are spread over threads and the
+ *  dot products are vectorised.
+ *
+ *  @param[in]     weights             from oySpectralWeightsCreate()
+ *  @param[in]     spectra             count spectra with weights->bands values each
+ *  @param[in]     count               number of spectra
+ *  @param[in]     stride              doubles from one spectrum to the next; 0 - weights->bands
+ *  @param[out]    XYZ                 count XYZ triples; perfect reflector Y = 1.0
+ *  @return                            number of spectra with NaN values, or -1 for error
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2026/10/19
+ *  @since   2026/10/19 (Oyranos: 0.9.7)
+ */
+int          oySpectralToXYZ         ( const oySpectralWeights_s * weights,
+                                       const double      * spectra,
+                                       int                 count,
+                                       int                 stride,
+                                       double            * XYZ )
+{
+  const double * wx, * wy, * wz;
+  int bands, i, nan_count = 0;
+
+  if(!weights || !spectra || !XYZ || count < 0)
+    return -1;
+
+  bands = weights->bands;
+  if(!stride)
+    stride = bands;
+  wx = weights->weights;
+  wy = wx + bands;
+  wz = wy + bands;
+
+#if defined(USE_OPENMP)
+#pragma omp parallel for reduction(+:nan_count) if(count > 256)
+#endif
+  for(i = 0; i < count; ++i)
+  {
+    const double * s = spectra + (size_t)i * stride;
+    double X = 0.0, Y = 0.0, Z = 0.0;
+    int b;
+
+#if defined(USE_OPENMP)
+#pragma omp simd reduction(+:X,Y,Z)
+#endif
+    for(b = 0; b < bands; ++b)
+    {
+      X += s[b] * wx[b];
+      Y += s[b] * wy[b];
+      Z += s[b] * wz[b];
+    }
+
+    if(isnan(X + Y + Z))
+      ++nan_count;
+    XYZ[i*3 + 0] = X;
+    XYZ[i*3 + 1] = Y;
+    XYZ[i*3 + 2] = Z;
+  }
+
+  return nan_count;
+}
+
+/** @brief Integrate spectra to CIE*Lab
+ *
+ *  Same as oySpectralToXYZ() followed by oyXYZ2Lab() with D50 white.
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2026/10/19
+ *  @since   2026/10/19 (Oyranos: 0.9.7)
+ */
+int          oySpectralToLab         ( const oySpectralWeights_s * weights,
+                                       const double      * spectra,
+                                       int                 count,
+                                       int                 stride,
+                                       double            * CIELab )
+{
+  int i, nan_count = oySpectralToXYZ( weights, spectra, count, stride, CIELab );
+
+  if(nan_count < 0)
+    return nan_count;
+
+#if defined(USE_OPENMP)
+#pragma omp parallel for if(count > 256)
+#endif
+  for(i = 0; i < count; ++i)
+  {
+    double XYZ[3] = { CIELab[i*3 + 0], CIELab[i*3 + 1], CIELab[i*3 + 2] };
+    oyXYZ2Lab( XYZ, &CIELab[i*3] );
+  }
+
+  return nan_count;
+}
+
 /** @} *//* color_low */
 
 
@@ -3,7 +3,7 @@
  *  Oyranos is an open source Color Management System 
  *
  *  @par Copyright:
- *            2004-2015 (C) Kai-Uwe Behrmann
+ *            2004-2026 (C) Kai-Uwe Behrmann
  *
  *  @brief    elektra dependent functions
  *  @internal
@@ -108,6 +108,18 @@ static const oyDbAPI_s * oy_db_handling_api = NULL;
 static int oy_db_handling_ready_ = 0;
 const char * oy_prefered_db_ = "//" OY_TYPE_STD "/db_handler.elDB";
 
+/* counts writes through oyDBSetString() and oyDBEraseKey() */
+static int oy_db_generation_ = 0;
+static oyDBSetString_f oy_db_set_string_ = NULL;
+static oyDBEraseKey_f oy_db_erase_key_ = NULL;
+#if defined(__GNUC__)
+#define oyDbGenerationInc_m() __atomic_add_fetch( &oy_db_generation_, 1, __ATOMIC_ACQ_REL )
+#define oyDbGenerationGet_m() __atomic_load_n( &oy_db_generation_, __ATOMIC_ACQUIRE )
+#else
+#define oyDbGenerationInc_m() ++oy_db_generation_
+#define oyDbGenerationGet_m() oy_db_generation_
+#endif
+
 /* private helper */
 
 oyDB_s * oyDB_newFromInit            ( const char        * top_key_name,
@@ -128,6 +140,40 @@ int                oyDbHandlingReady ( void )
   return oy_db_handling_ready_;
 }
 
+/** @internal
+ *  @brief the DB write generation
+ *  @ingroup objects_value
+ *
+ *  The number changes with each write or erase through the DB API of this
+ *  process and with each oyDbHandlingReset(). Caches of DB content can
+ *  compare it to detect own modifications. Changes from other processes
+ *  are not seen.
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2026/10/19
+ *  @since   2026/10/19 (Oyranos: 0.9.7)
+ */
+int                oyDbGeneration    ( void )
+{
+  return oyDbGenerationGet_m();
+}
+static int         oyDBSetStringCount_(const char        * keyName,
+                                       oySCOPE_e           scope,
+                                       const char        * value,
+                                       const char        * comment )
+{
+  int error = oy_db_set_string_( keyName, scope, value, comment );
+  oyDbGenerationInc_m();
+  return error;
+}
+static int         oyDBEraseKeyCount_( const char        * key_name,
+                                       oySCOPE_e           scope )
+{
+  int error = oy_db_erase_key_( key_name, scope );
+  oyDbGenerationInc_m();
+  return error;
+}
+
 /** @brief set DB functions for persistent settings
  *  @ingroup objects_value
  *
@@ -153,9 +199,11 @@ int                oyDbHandlingSet   ( const oyDbAPI_s   * db_api )
               oyDB_getStrings = db_api->getStrings;
              oyDB_getKeyNames = db_api->getKeyNames;
      oyDB_getKeyNamesOneLevel = db_api->getKeyNamesOneLevel;
-                oyDBSetString = db_api->setString;
+            oy_db_set_string_ = db_api->setString;
+                oyDBSetString = db_api->setString ? oyDBSetStringCount_ : NULL;
        oyDBSearchEmptyKeyname = db_api->searchEmptyKeyname;
-                 oyDBEraseKey = db_api->eraseKey;
+             oy_db_erase_key_ = db_api->eraseKey;
+                 oyDBEraseKey = db_api->eraseKey ? oyDBEraseKeyCount_ : NULL;
 
     oy_db_handling_ready_ = 1;
     oy_db_handling_api = db_api;
@@ -333,4 +381,7 @@ void               oyDbHandlingReset ( void )
                 oyDBSetString = oyDBSetStringInit;
        oyDBSearchEmptyKeyname = oyDBSearchEmptyKeynameInit;
                  oyDBEraseKey = oyDBEraseKeyInit;
+            oy_db_set_string_ = NULL;
+             oy_db_erase_key_ = NULL;
+  oyDbGenerationInc_m();
 }
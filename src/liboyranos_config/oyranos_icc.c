@@ -3,7 +3,7 @@
  *  Oyranos is an open source Color Management System 
  *
  *  @par Copyright:
- *            2004-2012 (C) Kai-Uwe Behrmann
+ *            2004-2026 (C) Kai-Uwe Behrmann
  *
  *  @internal
  *  @brief    misc ICC support APIs
@@ -930,6 +930,377 @@ icValue_to_icUInt32Number_m( oyValueProfCSig, icProfileClassSignature )
 icValue_to_icUInt32Number_m( oyValueTagSig, icTagSignature )
 
 
+/* big endian readers; views may point to unaligned tag data */
+#define oyICCView16_m(p) ((icUInt16Number)(((p)[0] << 8) | (p)[1]))
+#define oyICCView32_m(p) ((icUInt32Number)(((icUInt32Number)(p)[0] << 24) | \
+                                           ((icUInt32Number)(p)[1] << 16) | \
+                                           ((icUInt32Number)(p)[2] << 8) | \
+                                            (icUInt32Number)(p)[3]))
+#define oyICCViewS15_m(p) ((double)(icInt32Number)oyICCView32_m(p) / 65536.0)
+
+/** Function: oyICCTagViewFromMem
+ *  @brief find a tag inside a ICC profile block
+ *
+ *  The tag table and the tag boundaries are checked against the block
+ *  size. Nothing is allocated or copied.
+ *
+ *  @param[in]     block               ICC profile memory
+ *  @param[in]     size                size of block
+ *  @param[in]     sig                 the tag signature
+ *  @param[out]    view                the tag view
+ *  @return                            0 - success, -1 - not found, 1 - error
+ *
+ *  @version Oyranos: 0.9.7
+ *  @since   2026/10/19 (Oyranos: 0.9.7)
+ *  @date    2026/10/19
+ */
+int            oyICCTagViewFromMem   ( const void        * block,
+                                       size_t              size,
+                                       icTagSignature      sig,
+                                       oyICCTagView_s    * view )
+{
+  const unsigned char * data = (const unsigned char *) block;
+  icUInt32Number count, i;
+
+  if(!data || !view || size < 132)
+    return 1;
+
+  memset( view, 0, sizeof(oyICCTagView_s) );
+
+  count = oyICCView32_m( &data[128] );
+  if(count > (size - 132) / 12)
+    return 1;
+
+  for(i = 0; i < count; ++i)
+  {
+    const unsigned char * entry = &data[132 + i * 12];
+    icUInt32Number offset, tag_size;
+
+    if(oyICCView32_m( entry ) != (icUInt32Number)sig)
+      continue;
+
+    offset = oyICCView32_m( &entry[4] );
+    tag_size = oyICCView32_m( &entry[8] );
+    if(tag_size < 8 || offset > size || tag_size > size - offset)
+      return 1;
+
+    view->sig = sig;
+    view->type = (icTagTypeSignature) oyICCView32_m( &data[offset] );
+    view->data = &data[offset];
+    view->size = tag_size;
+    return 0;
+  }
+
+  return -1;
+}
+
+/** Function: oyICCTagViewCount
+ *  @brief number of elements in a tag view
+ *
+ *  @return                            curv: entries; XYZ: numbers;
+ *                                     mluc: records; desc, text, para: 1;
+ *                                     other types: 0; -1 - corrupted
+ *
+ *  @version Oyranos: 0.9.7
+ *  @since   2026/10/19 (Oyranos: 0.9.7)
+ *  @date    2026/10/19
+ */
+int            oyICCTagViewCount     ( const oyICCTagView_s * view )
+{
+  icUInt32Number n;
+
+  if(!view || !view->data || view->size < 8)
+    return -1;
+
+  switch((unsigned int)view->type)
+  {
+    case icSigCurveType:
+      if(view->size < 12)
+        return -1;
+      n = oyICCView32_m( &view->data[8] );
+      if(n > (view->size - 12) / 2)
+        return -1;
+      return (int)n;
+    case icSigXYZType:
+      return (int)((view->size - 8) / 12);
+    case icSigMultiLocalizedUnicodeType:
+      if(view->size < 16 || oyICCView32_m( &view->data[12] ) != 12)
+        return -1;
+      n = oyICCView32_m( &view->data[8] );
+      if(n > (view->size - 16) / 12)
+        return -1;
+      return (int)n;
+    case icSigTextDescriptionType:
+    case icSigTextType:
+    case icSigParametricCurveType:
+      return 1;
+    default:
+      return 0;
+  }
+}
+
+/** Function: oyICCTagViewGetCurve
+ *  @brief get a curv tag entry
+ *
+ *  @param[in]     view                a curv tag view
+ *  @param[in]     pos                 entry position
+ *  @param[out]    value               the entry
+ *  @return                            0 - success, 1 - error
+ *
+ *  @version Oyranos: 0.9.7
+ *  @since   2026/10/19 (Oyranos: 0.9.7)
+ *  @date    2026/10/19
+ */
+int            oyICCTagViewGetCurve  ( const oyICCTagView_s * view,
+                                       icUInt32Number      pos,
+                                       icUInt16Number    * value )
+{
+  int n = oyICCTagViewCount( view );
+
+  if(!value || n < 0 || view->type != icSigCurveType || pos >= (icUInt32Number)n)
+    return 1;
+
+  *value = oyICCView16_m( &view->data[12 + pos * 2] );
+  return 0;
+}
+
+/** Function: oyICCTagViewGetParametric
+ *  @brief get parametric curve values
+ *
+ *  Supported are para tags and curv tags with zero or one entry. The later
+ *  are reported as function type 0 with the gamma in params[0].
+ *
+ *  @param[in]     view                a para or curv tag view
+ *  @param[out]    function_type       ICC parametric function type 0-4
+ *  @param[out]    params              the parameters
+ *  @return                            number of params, -1 - error
+ *
+ *  @version Oyranos: 0.9.7
+ *  @since   2026/10/19 (Oyranos: 0.9.7)
+ *  @date    2026/10/19
+ */
+int            oyICCTagViewGetParametric (
+                                       const oyICCTagView_s * view,
+                                       int               * function_type,
+                                       double              params[7] )
+{
+  static const int params_n[5] = {1,3,4,5,7};
+  int type, i;
+
+  if(!view || !view->data || !function_type || !params)
+    return -1;
+
+  if(view->type == icSigCurveType)
+  {
+    int n = oyICCTagViewCount( view );
+    if(n < 0 || n > 1)
+      return -1;
+    *function_type = 0;
+    /* no entry means identity; one entry is a u8Fixed8Number gamma */
+    params[0] = n ? oyICCView16_m( &view->data[12] ) / 256.0 : 1.0;
+    return 1;
+  }
+
+  if(view->type != icSigParametricCurveType || view->size < 12)
+    return -1;
+
+  type = oyICCView16_m( &view->data[8] );
+  if(type > 4 || view->size < 12 + (size_t)params_n[type] * 4)
+    return -1;
+
+  *function_type = type;
+  for(i = 0; i < params_n[type]; ++i)
+    params[i] = oyICCViewS15_m( &view->data[12 + i * 4] );
+
+  return params_n[type];
+}
+
+/** Function: oyICCTagViewGetXYZ
+ *  @brief get a XYZ number from a XYZ tag view
+ *
+ *  @param[in]     view                a XYZ tag view
+ *  @param[in]     pos                 number position
+ *  @param[out]    XYZ                 the values
+ *  @return                            0 - success, 1 - error
+ *
+ *  @version Oyranos: 0.9.7
+ *  @since   2026/10/19 (Oyranos: 0.9.7)
+ *  @date    2026/10/19
+ */
+int            oyICCTagViewGetXYZ    ( const oyICCTagView_s * view,
+                                       int                 pos,
+                                       double              XYZ[3] )
+{
+  int n = oyICCTagViewCount( view ), i;
+
+  if(!XYZ || n < 0 || view->type != icSigXYZType || pos < 0 || pos >= n)
+    return 1;
+
+  for(i = 0; i < 3; ++i)
+    XYZ[i] = oyICCViewS15_m( &view->data[8 + pos * 12 + i * 4] );
+
+  return 0;
+}
+
+/** Function: oyICCTagViewGetString
+ *  @brief get a string from a text tag view
+ *
+ *  Supported are mluc, desc and text tags. The string is not copied and
+ *  is not guaranteed to be null terminated. mluc strings are UTF-16 big
+ *  endian. desc and text strings are 7-bit ASCII.
+ *
+ *  @param[in]     view                a text tag view
+ *  @param[in]     pos                 mluc record position; 0 otherwise
+ *  @param[out]    locale              optional language_country; e.g. "en_US"
+ *  @param[out]    text                the string inside the tag
+ *  @param[out]    bytes               string size in bytes
+ *  @param[out]    utf16be             optional; 1 for UTF-16 big endian
+ *  @return                            0 - success, 1 - error
+ *
+ *  @version Oyranos: 0.9.7
+ *  @since   2026/10/19 (Oyranos: 0.9.7)
+ *  @date    2026/10/19
+ */
+int            oyICCTagViewGetString ( const oyICCTagView_s * view,
+                                       int                 pos,
+                                       char                locale[6],
+                                       const char       ** text,
+                                       size_t            * bytes,
+                                       int               * utf16be )
+{
+  int n = oyICCTagViewCount( view );
+  icUInt32Number len = 0, offset = 0;
+
+  if(!text || !bytes || n < 0 || pos < 0 || pos >= n)
+    return 1;
+
+  if(locale) locale[0] = 0;
+  if(utf16be) *utf16be = 0;
+
+  switch((unsigned int)view->type)
+  {
+    case icSigMultiLocalizedUnicodeType:
+    {
+      const unsigned char * record = &view->data[16 + pos * 12];
+      len = oyICCView32_m( &record[4] );
+      offset = oyICCView32_m( &record[8] );
+      if(locale)
+      {
+        locale[0] = record[0]; locale[1] = record[1]; locale[2] = '_';
+        locale[3] = record[2]; locale[4] = record[3]; locale[5] = 0;
+      }
+      if(utf16be) *utf16be = 1;
+    }
+    break;
+    case icSigTextDescriptionType:
+      if(view->size < 12)
+        return 1;
+      len = oyICCView32_m( &view->data[8] );
+      offset = 12;
+      /* the count includes the terminating zero */
+      if(len && len <= view->size - offset && view->data[offset + len - 1] == 0)
+        --len;
+    break;
+    case icSigTextType:
+      offset = 8;
+      len = (icUInt32Number)(view->size - 8);
+      while(len && view->data[offset + len - 1] == 0)
+        --len;
+    break;
+    default:
+      return 1;
+  }
+
+  if(offset > view->size || len > view->size - offset)
+    return 1;
+
+  *text = (const char*) &view->data[offset];
+  *bytes = len;
+  return 0;
+}
+
+/** Function: oyICCTagViewGetLut
+ *  @brief get the color lookup table from a tag view
+ *
+ *  Supported are mft1, mft2, mAB and mBA tags. mAB and mBA tags without
+ *  CLUT give a lut->clut of NULL.
+ *
+ *  @param[in]     view                a lut tag view
+ *  @param[out]    lut                 the CLUT view
+ *  @return                            0 - success, 1 - error
+ *
+ *  @version Oyranos: 0.9.7
+ *  @since   2026/10/19 (Oyranos: 0.9.7)
+ *  @date    2026/10/19
+ */
+int            oyICCTagViewGetLut    ( const oyICCTagView_s * view,
+                                       oyICCLutView_s    * lut )
+{
+  const unsigned char * data;
+  size_t offset = 0, points = 1;
+  int i;
+
+  if(!view || !view->data || !lut || view->size < 32)
+    return 1;
+
+  memset( lut, 0, sizeof(oyICCLutView_s) );
+  data = view->data;
+  lut->channels_in = data[8];
+  lut->channels_out = data[9];
+  if(lut->channels_in < 1 || lut->channels_in > 15 || lut->channels_out < 1)
+    return 1;
+
+  switch((unsigned int)view->type)
+  {
+    case icSigLut8Type:
+    case icSigLut16Type:
+      for(i = 0; i < lut->channels_in; ++i)
+        lut->grid[i] = data[10];
+      if(view->type == icSigLut8Type)
+      {
+        lut->precision = 1;
+        offset = 48 + (size_t)lut->channels_in * 256;
+      } else
+      {
+        if(view->size < 52)
+          return 1;
+        lut->precision = 2;
+        offset = 52 + (size_t)lut->channels_in * oyICCView16_m( &data[48] ) * 2;
+      }
+    break;
+    case icSigLutAtoBType:
+    case icSigLutBtoAType:
+      offset = oyICCView32_m( &data[24] );
+      if(!offset)
+        return 0;
+      if(offset > view->size || view->size - offset < 20)
+        return 1;
+      memcpy( lut->grid, &data[offset], 16 );
+      lut->precision = data[offset + 16];
+      if(lut->precision != 1 && lut->precision != 2)
+        return 1;
+      offset += 20;
+    break;
+    default:
+      return 1;
+  }
+
+  for(i = 0; i < lut->channels_in; ++i)
+  {
+    if(!lut->grid[i] || points > view->size / lut->grid[i])
+      return 1;
+    points *= lut->grid[i];
+  }
+  points *= (size_t)lut->channels_out * lut->precision;
+
+  if(offset > view->size || points > view->size - offset)
+    return 1;
+
+  lut->clut = &data[offset];
+  lut->clut_size = points;
+  return 0;
+}
+
 
 /** @} *//* icc_low */
 
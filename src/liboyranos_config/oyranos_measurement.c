@@ -0,0 +1,921 @@
+/** @file oyranos_measurement.c
+ *
+ *  Oyranos is an open source Color Management System
+ *
+ *  @par Copyright:
+ *            2026 (C) Kai-Uwe Behrmann
+ *
+ *  @internal
+ *  @brief    CGATS, CxF and CSV measurement parsing
+ *  @author   Kai-Uwe Behrmann <ku.b@gmx.de>
+ *  @par License:
+ *            new BSD <http://www.opensource.org/licenses/BSD-3-Clause>
+ *  @since    2026/10/19
+ */
+
+#include <ctype.h>
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "oyranos_measurement.h"
+
+/** \addtogroup color_low
+ *  @{ *//* color_low */
+
+static const double oy_pow10_[23] = {
+  1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+  1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22 };
+
+/* locale independent number parsing, reads not beyond limit;
+ * *end == text for no number */
+static double oyMeasurementParseDouble_( const char * text,
+                                       const char        * limit,
+                                       const char       ** end )
+{
+  const char * p = text;
+  uint64_t mantissa = 0;
+  int digits = 0, exp10 = 0, negative = 0, any = 0;
+  double d;
+
+#define oyIS_DIGIT_m(p) ((p) < limit && *(p) >= '0' && *(p) <= '9')
+  if(p < limit && *p == '-') { negative = 1; ++p; }
+  else if(p < limit && *p == '+') ++p;
+
+  while(oyIS_DIGIT_m(p))
+  {
+    if(digits < 19)
+    {
+      mantissa = mantissa * 10 + (uint64_t)(*p - '0');
+      if(mantissa) ++digits;
+    } else
+      ++exp10;
+    ++p; any = 1;
+  }
+  if(p < limit && *p == '.')
+  {
+    ++p;
+    while(oyIS_DIGIT_m(p))
+    {
+      if(digits < 19)
+      {
+        mantissa = mantissa * 10 + (uint64_t)(*p - '0');
+        if(mantissa) ++digits;
+        --exp10;
+      }
+      ++p; any = 1;
+    }
+  }
+  if(!any)
+  {
+    *end = text;
+    return NAN;
+  }
+  if(p < limit && (*p == 'e' || *p == 'E'))
+  {
+    const char * e = p + 1;
+    int e_negative = 0, e_value = 0;
+    if(e < limit && *e == '-') { e_negative = 1; ++e; }
+    else if(e < limit && *e == '+') ++e;
+    if(oyIS_DIGIT_m(e))
+    {
+      while(oyIS_DIGIT_m(e))
+      {
+        if(e_value < 10000) e_value = e_value * 10 + (*e - '0');
+        ++e;
+      }
+      exp10 += e_negative ? -e_value : e_value;
+      p = e;
+    }
+  }
+#undef oyIS_DIGIT_m
+  *end = p;
+
+  d = (double) mantissa;
+  if(exp10 < 0)
+  {
+    if(exp10 >= -22) d /= oy_pow10_[-exp10];
+    else             d *= pow( 10.0, exp10 );
+  } else if(exp10 > 0)
+  {
+    if(exp10 <= 22)  d *= oy_pow10_[exp10];
+    else             d *= pow( 10.0, exp10 );
+  }
+
+  return negative ? -d : d;
+}
+
+static char * oyMeasurementStrndup_  ( const char        * text,
+                                       size_t              len )
+{
+  char * t = (char*) malloc( len + 1 );
+  if(!t) return NULL;
+  memcpy( t, text, len );
+  t[len] = '\000';
+  return t;
+}
+
+/* next white space separated token; quotes are removed */
+static const char * oyMeasurementToken_( const char       ** text,
+                                       const char        * end,
+                                       int                 stop_at_newline,
+                                       size_t            * len )
+{
+  const char * p = *text, * t;
+
+  while(p < end && (*p == ' ' || *p == '\t' || *p == '\r' ||
+                    (!stop_at_newline && *p == '\n')))
+    ++p;
+  if(p >= end || *p == '\n')
+  {
+    *text = p;
+    return NULL;
+  }
+
+  if(*p == '"')
+  {
+    t = ++p;
+    while(p < end && *p != '"' && *p != '\n') ++p;
+    *len = (size_t)(p - t);
+    if(p < end && *p == '"') ++p;
+  } else
+  {
+    t = p;
+    while(p < end && !isspace((unsigned char)*p)) ++p;
+    *len = (size_t)(p - t);
+  }
+  *text = p;
+
+  return t;
+}
+
+static const char * oyMeasurementNextLine_( const char * p, const char * end )
+{
+  p = (const char*) memchr( p, '\n', (size_t)(end - p) );
+  return p ? p + 1 : end;
+}
+
+#define oyTOKEN_IS(t,l,s) ((l) == sizeof(s) - 1 && memcmp( t, s, sizeof(s) - 1 ) == 0)
+
+static int   oyMeasurementReserve_   ( oyMeasurement_s   * m,
+                                       int                 count )
+{
+  int capacity = m->capacity ? m->capacity : 64;
+  double * values;
+  char ** names;
+
+  if(count <= m->capacity)
+    return 0;
+
+  while(capacity < count)
+    capacity *= 2;
+
+  values = (double*) realloc( m->values, sizeof(double) * (size_t)capacity * (size_t)(m->columns ? m->columns : 1) );
+  if(!values) return 1;
+  m->values = values;
+
+  names = (char**) realloc( m->names, sizeof(char*) * (size_t)capacity );
+  if(!names) return 1;
+  memset( names + m->capacity, 0, sizeof(char*) * (size_t)(capacity - m->capacity) );
+  m->names = names;
+
+  m->capacity = capacity;
+  return 0;
+}
+
+/* SPECTRAL_NM380, SPECTRAL_NM_380, SPECTRAL_380, nm380 -> 380 */
+static double oyMeasurementFieldNm_  ( const char        * field )
+{
+  const char * p = field, * end, * field_end;
+  double nm;
+
+  if(!field)
+    return -1.0;
+  field_end = field + strlen( field );
+
+#define oyHAS_PREFIX_m(p,s) ((size_t)(field_end - (p)) >= sizeof(s) - 1 && memcmp( p, s, sizeof(s) - 1 ) == 0)
+  if(oyHAS_PREFIX_m( p, "SPECTRAL_" ))
+    p += 9;
+  else if(!oyHAS_PREFIX_m( p, "nm" ))
+    return -1.0;
+  if(oyHAS_PREFIX_m( p, "NM" ) || oyHAS_PREFIX_m( p, "nm" ))
+    p += 2;
+#undef oyHAS_PREFIX_m
+  if(p < field_end && *p == '_')
+    ++p;
+
+  nm = oyMeasurementParseDouble_( p, field_end, &end );
+  if(end == p || end != field_end)
+    return -1.0;
+
+  return nm;
+}
+
+static void  oyMeasurementSetLayout_ ( oyMeasurement_s   * m )
+{
+  int i;
+  double last = -1.0;
+
+  m->bands = 0;
+  for(i = 0; i < m->columns; ++i)
+  {
+    double nm = oyMeasurementFieldNm_( m->column_names[i] );
+    if(nm < 0.0)
+    {
+      if(m->bands) break;
+      continue;
+    }
+    if(m->bands == 0)
+    {
+      m->spectral = i;
+      m->start = nm;
+    } else if(m->bands == 1)
+      m->lambda = nm - last;
+    else if(fabs(nm - last - m->lambda) > 0.001)
+      break;
+    last = nm;
+    ++m->bands;
+  }
+  if(m->bands == 1)
+    m->lambda = 1.0;
+}
+
+static int   oyMeasurementParseCgats_( oyMeasurement_s   * m,
+                                       const char        * p,
+                                       const char        * end )
+{
+  const char * t;
+  size_t len;
+  int fields_n = 0, * field_column = NULL, name_field = -1, id_field = -1;
+  char ** fields = NULL;
+  int error = 0;
+
+  while(p < end && !error)
+  {
+    const char * line = p;
+
+    t = oyMeasurementToken_( &p, end, 1, &len );
+    if(!t || t[0] == '#')
+    {
+      p = oyMeasurementNextLine_( line, end );
+      continue;
+    }
+
+    if(oyTOKEN_IS( t, len, "DESCRIPTOR" ) ||
+       oyTOKEN_IS( t, len, "ORIGINATOR" ) ||
+       oyTOKEN_IS( t, len, "CREATED" ))
+    {
+      char ** s = t[0] == 'D' ? &m->description : t[0] == 'O' ? &m->creator : &m->date;
+      t = oyMeasurementToken_( &p, end, 1, &len );
+      if(t && !*s)
+        *s = oyMeasurementStrndup_( t, len );
+    }
+    else if(oyTOKEN_IS( t, len, "NUMBER_OF_SETS" ))
+    {
+      const char * n_end;
+      t = oyMeasurementToken_( &p, end, 1, &len );
+      if(t && m->columns)
+      {
+        double n = oyMeasurementParseDouble_( t, t + len, &n_end );
+        if(n > 0 && n < 1e8)
+          error = oyMeasurementReserve_( m, (int)n );
+      } else if(t)
+      {
+        /* keep the hint until the data format is known */
+        double n = oyMeasurementParseDouble_( t, t + len, &n_end );
+        if(n > 0 && n < 1e8)
+          m->capacity = -(int)n;
+      }
+    }
+    else if(oyTOKEN_IS( t, len, "BEGIN_DATA_FORMAT" ))
+    {
+      int fields_max = 0, i;
+      /* a table has one data format; the state below is set only once */
+      if(field_column || fields_n)
+      {
+        error = 1;
+        break;
+      }
+      while((t = oyMeasurementToken_( &p, end, 0, &len )) != NULL &&
+            !oyTOKEN_IS( t, len, "END_DATA_FORMAT" ))
+      {
+        if(fields_n >= fields_max)
+        {
+          char ** f;
+          fields_max = fields_max ? fields_max * 2 : 64;
+          f = (char**) realloc( fields, sizeof(char*) * (size_t)fields_max );
+          if(!f) { error = 1; break; }
+          fields = f;
+        }
+        fields[fields_n++] = oyMeasurementStrndup_( t, len );
+      }
+      if(error || !fields_n) break;
+
+      field_column = (int*) calloc( (size_t)fields_n, sizeof(int) );
+      m->column_names = (char**) calloc( (size_t)fields_n + 1, sizeof(char*) );
+      if(!field_column || !m->column_names) { error = 1; break; }
+      for(i = 0; i < fields_n; ++i)
+      {
+        field_column[i] = -1;
+        if(strcmp( fields[i], "SAMPLE_NAME" ) == 0)
+          name_field = i;
+        else if(strcmp( fields[i], "SAMPLE_ID" ) == 0)
+          id_field = i;
+        else
+        {
+          field_column[i] = m->columns;
+          m->column_names[m->columns++] = fields[i];
+          fields[i] = NULL;
+        }
+      }
+      if(name_field < 0)
+        name_field = id_field;
+      oyMeasurementSetLayout_( m );
+      if(m->capacity < 0)
+      {
+        int n = -m->capacity;
+        m->capacity = 0;
+        error = oyMeasurementReserve_( m, n );
+      }
+    }
+    else if(oyTOKEN_IS( t, len, "BEGIN_DATA" ) && field_column)
+    {
+      int field = 0, row = 0;
+      double * values = NULL;
+
+      while((t = oyMeasurementToken_( &p, end, 0, &len )) != NULL &&
+            !oyTOKEN_IS( t, len, "END_DATA" ))
+      {
+        int column = field_column[field];
+        if(field == 0)
+        {
+          if(oyMeasurementReserve_( m, row + 1 )) { error = 1; break; }
+          values = &m->values[(size_t)row * (size_t)m->columns];
+        }
+        if(column >= 0)
+        {
+          const char * v_end;
+          double d = oyMeasurementParseDouble_( t, t + len, &v_end );
+          values[column] = v_end == t + len ? d : NAN;
+        } else if(field == name_field)
+          m->names[row] = oyMeasurementStrndup_( t, len );
+
+        if(++field == fields_n)
+        {
+          field = 0;
+          ++row;
+        }
+      }
+      /* incomplete last row */
+      if(field)
+      {
+        for( ; field < fields_n; ++field)
+          if(field_column[field] >= 0)
+            values[field_column[field]] = NAN;
+        ++row;
+      }
+      m->count = row;
+      /* only the first table is read */
+      break;
+    }
+
+    p = oyMeasurementNextLine_( p, end );
+  }
+
+  if(fields)
+  {
+    int i;
+    for(i = 0; i < fields_n; ++i)
+      if(fields[i]) free( fields[i] );
+    free( fields );
+  }
+  if(field_column) free( field_column );
+  if(m->capacity < 0) m->capacity = 0;
+
+  return error || !m->columns;
+}
+
+static int   oyMeasurementIsNumber_  ( const char        * p )
+{
+  return (*p >= '0' && *p <= '9') || *p == '-' || *p == '+' || *p == '.';
+}
+
+/* nm,patch1,patch2,... per line; one column per patch */
+static int   oyMeasurementParseCsv_  ( oyMeasurement_s   * m,
+                                       const char        * p,
+                                       const char        * end )
+{
+  const char * header = NULL, * line;
+  int patches = 0, bands = 0, bands_max = 0, i, j;
+  double * rows = NULL, * nm = NULL;
+  int error = 0;
+
+  /* comments and the column names */
+  while(p < end && !oyMeasurementIsNumber_( p ))
+  {
+    header = p;
+    p = oyMeasurementNextLine_( p, end );
+  }
+  if(p >= end)
+    return 1;
+
+  line = p;
+  while(line < end && *line != '\n')
+    if(*line++ == ',') ++patches;
+  if(patches < 1)
+    return 1;
+
+  while(p < end && oyMeasurementIsNumber_( p ))
+  {
+    const char * v_end;
+    double * row;
+
+    if(bands >= bands_max)
+    {
+      double * r, * n;
+      bands_max = bands_max ? bands_max * 2 : 64;
+      r = (double*) realloc( rows, sizeof(double) * (size_t)bands_max * (size_t)patches );
+      n = r ? (double*) realloc( nm, sizeof(double) * (size_t)bands_max ) : NULL;
+      if(r) rows = r;
+      if(n) nm = n;
+      if(!r || !n) { error = 1; break; }
+    }
+    row = &rows[(size_t)bands * (size_t)patches];
+
+    nm[bands] = oyMeasurementParseDouble_( p, end, &v_end );
+    p = v_end;
+    for(i = 0; i < patches; ++i)
+    {
+      while(p < end && *p != ',' && *p != '\n') ++p;
+      if(p < end && *p == ',')
+      {
+        ++p;
+        while(p < end && (*p == ' ' || *p == '\t')) ++p;
+        row[i] = oyMeasurementParseDouble_( p, end, &v_end );
+        p = v_end;
+      } else
+        row[i] = NAN;
+    }
+    ++bands;
+    p = oyMeasurementNextLine_( p, end );
+  }
+
+  if(!error && bands)
+  {
+    m->columns = bands;
+    m->column_names = (char**) calloc( (size_t)bands + 1, sizeof(char*) );
+    error = !m->column_names || oyMeasurementReserve_( m, patches );
+  }
+  if(!error && bands)
+  {
+    for(j = 0; j < bands; ++j)
+    {
+      char t[32];
+      snprintf( t, sizeof(t), "SPECTRAL_NM%g", nm[j] );
+      m->column_names[j] = oyMeasurementStrndup_( t, strlen(t) );
+    }
+    /* patch major */
+    for(i = 0; i < patches; ++i)
+      for(j = 0; j < bands; ++j)
+        m->values[(size_t)i * (size_t)bands + (size_t)j] = rows[(size_t)j * (size_t)patches + (size_t)i];
+    m->count = patches;
+    m->spectral = 0;
+    m->bands = bands;
+    m->start = nm[0];
+    m->lambda = bands > 1 ? nm[1] - nm[0] : 1.0;
+
+    if(header)
+    {
+      const char * h = header, * h_end = oyMeasurementNextLine_( header, end );
+      int n = -1;
+      while(h < h_end)
+      {
+        const char * s = h;
+        while(h < h_end && *h != ',' && *h != '\n' && *h != '\r') ++h;
+        if(n >= 0 && n < patches)
+        {
+          while(s < h && (*s == ' ' || *s == '"')) ++s;
+          j = (int)(h - s);
+          while(j && (s[j-1] == ' ' || s[j-1] == '"')) --j;
+          m->names[n] = oyMeasurementStrndup_( s, (size_t)j );
+        }
+        ++n;
+        if(h < h_end && *h == ',') ++h;
+        else break;
+      }
+    }
+  }
+
+  if(rows) free( rows );
+  if(nm) free( nm );
+
+  return error || !bands;
+}
+
+/* find the next element by its local name, namespace prefixes are ignored */
+static const char * oyMeasurementXmlTag_( const char    * p,
+                                       const char        * end,
+                                       const char        * tag,
+                                       const char       ** tag_end )
+{
+  size_t len = strlen( tag );
+
+  while(p < end && (p = (const char*) memchr( p, '<', (size_t)(end - p) )) != NULL)
+  {
+    const char * n = p + 1, * name_end = n, * colon;
+
+    if(n >= end)
+      break;
+    if(*n == '/' || *n == '?' || *n == '!')
+    {
+      ++p;
+      continue;
+    }
+    while(name_end < end && !isspace((unsigned char)*name_end) &&
+          *name_end != '>' && *name_end != '/')
+      ++name_end;
+    colon = (const char*) memchr( n, ':', (size_t)(name_end - n) );
+    if(colon) n = colon + 1;
+    if((size_t)(name_end - n) == len && memcmp( n, tag, len ) == 0)
+    {
+      *tag_end = (const char*) memchr( name_end, '>', (size_t)(end - name_end) );
+      return *tag_end ? p : NULL;
+    }
+    ++p;
+  }
+
+  return NULL;
+}
+
+static const char * oyMeasurementXmlAttr_( const char   * tag,
+                                       const char        * tag_end,
+                                       const char        * attr,
+                                       size_t            * len )
+{
+  size_t alen = strlen( attr );
+  const char * p;
+
+  for(p = tag + 1; p + alen + 2 < tag_end; ++p)
+    if(isspace((unsigned char)p[-1]) && memcmp( p, attr, alen ) == 0 &&
+       p[alen] == '=' && (p[alen+1] == '"' || p[alen+1] == '\''))
+    {
+      const char * s = p + alen + 2,
+                 * e = (const char*) memchr( s, p[alen+1], (size_t)(tag_end - s) );
+      if(!e) return NULL;
+      *len = (size_t)(e - s);
+      return s;
+    }
+
+  return NULL;
+}
+
+static int   oyMeasurementParseCxf_  ( oyMeasurement_s   * m,
+                                       const char        * p,
+                                       const char        * end )
+{
+  const char * tag, * tag_end, * a, * v_end;
+  size_t len;
+  int row = 0, j, error = 0, have_range = 0;
+
+  /* spectral layout */
+  tag = oyMeasurementXmlTag_( p, end, "WavelengthRange", &tag_end );
+  if(tag)
+  {
+    have_range = 1;
+    if((a = oyMeasurementXmlAttr_( tag, tag_end, "StartWL", &len )) != NULL)
+      m->start = oyMeasurementParseDouble_( a, a + len, &v_end );
+    if((a = oyMeasurementXmlAttr_( tag, tag_end, "Increment", &len )) != NULL)
+      m->lambda = oyMeasurementParseDouble_( a, a + len, &v_end );
+  }
+  tag = oyMeasurementXmlTag_( p, end, "ReflectanceSpectrum", &tag_end );
+  if(tag)
+  {
+    const char * s = tag_end + 1;
+    if(!have_range &&
+       (a = oyMeasurementXmlAttr_( tag, tag_end, "StartWL", &len )) != NULL)
+      m->start = oyMeasurementParseDouble_( a, a + len, &v_end );
+    while(s < end && *s != '<')
+    {
+      while(s < end && isspace((unsigned char)*s)) ++s;
+      if(s >= end || *s == '<') break;
+      oyMeasurementParseDouble_( s, end, &v_end );
+      if(v_end == s) break;
+      s = v_end;
+      ++m->bands;
+    }
+  }
+  if(m->lambda <= 0.0)
+    m->lambda = 10.0;
+
+  m->columns = m->bands;
+  m->column_names = (char**) calloc( (size_t)m->columns + 1, sizeof(char*) );
+  if(!m->column_names) return 1;
+  for(j = 0; j < m->columns; ++j)
+  {
+    char t[32];
+    snprintf( t, sizeof(t), "SPECTRAL_NM%g", m->start + j * m->lambda );
+    m->column_names[j] = oyMeasurementStrndup_( t, strlen(t) );
+  }
+
+  p = oyMeasurementXmlTag_( p, end, "Object", &tag_end );
+  while(p && !error)
+  {
+    const char * next_end = NULL,
+               * next = oyMeasurementXmlTag_( tag_end, end, "Object", &next_end ),
+               * object_end = next ? next : end;
+    double * values;
+
+    if(oyMeasurementReserve_( m, row + 1 )) { error = 1; break; }
+    values = &m->values[(size_t)row * (size_t)m->columns];
+
+    if((a = oyMeasurementXmlAttr_( p, tag_end, "Name", &len )) != NULL)
+      m->names[row] = oyMeasurementStrndup_( a, len );
+
+    j = 0;
+    tag = oyMeasurementXmlTag_( tag_end, object_end, "ReflectanceSpectrum", &v_end );
+    if(tag)
+    {
+      const char * s = v_end + 1;
+      for( ; j < m->columns; ++j)
+      {
+        while(s < object_end && isspace((unsigned char)*s)) ++s;
+        if(s >= object_end || *s == '<') break;
+        values[j] = oyMeasurementParseDouble_( s, object_end, &v_end );
+        if(v_end == s) break;
+        s = v_end;
+      }
+    }
+    for( ; j < m->columns; ++j)
+      values[j] = NAN;
+
+    ++row;
+    p = next;
+    tag_end = next_end;
+  }
+  m->count = row;
+
+  return error || !row;
+}
+
+/** @brief Parse a measurement file
+ *
+ *  The text is read in one pass directly into the numeric
+ *  oyMeasurement_s::values block. No tree is built; use
+ *  oyMeasurementToTree() for the Named Color Collection form.
+ *
+ *  CGATS: all fields besides SAMPLE_ID and SAMPLE_NAME become columns.
+ *  SPECTRAL_NMxxx fields set the spectral layout. Only the first table
+ *  is read.
+ *  CSV: the first column holds the wavelength in nm and each further
+ *  column a patch, as written by spectro photometer software.
+ *  CxF: the ReflectanceSpectrum of each Object is read.
+ *
+ *  @param[in]     text                measurement text
+ *  @param[in]     size                text size; 0 - use strlen()
+ *  @param[in]     format              oyMEASUREMENT_UNKNOWN for detection
+ *  @return                            the table or NULL
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2026/10/19
+ *  @since   2026/10/19 (Oyranos: 0.9.7)
+ */
+oyMeasurement_s * oyMeasurementParse ( const char        * text,
+                                       size_t              size,
+                                       oyMEASUREMENT_FORMAT_e format )
+{
+  oyMeasurement_s * m;
+  const char * p = text, * end;
+  int error = 0;
+
+  if(!text) return NULL;
+  if(!size) size = strlen( text );
+  end = text + size;
+
+  /* UTF-8 BOM */
+  if(size >= 3 && memcmp( p, "\xEF\xBB\xBF", 3 ) == 0)
+    p += 3;
+  while(p < end && isspace((unsigned char)*p)) ++p;
+  if(p >= end) return NULL;
+
+  if(format == oyMEASUREMENT_UNKNOWN)
+  {
+    size_t n = (size_t)(end - p) < 4096 ? (size_t)(end - p) : 4096;
+    if(*p == '<')
+      format = oyMEASUREMENT_CXF;
+    else if((n >= 5 && memcmp( p, "CGATS", 5 ) == 0) ||
+            (n >= 3 && memcmp( p, "IT8", 3 ) == 0) ||
+            (n >= 12 && memcmp( p, "LGOROWLENGTH", 12 ) == 0))
+      format = oyMEASUREMENT_CGATS;
+    else
+    {
+      const char * s;
+      format = oyMEASUREMENT_CSV;
+      for(s = p; s + 17 <= p + n; ++s)
+        if(*s == 'B' && memcmp( s, "BEGIN_DATA_FORMAT", 17 ) == 0)
+        {
+          format = oyMEASUREMENT_CGATS;
+          break;
+        }
+    }
+  }
+
+  m = (oyMeasurement_s*) calloc( 1, sizeof(oyMeasurement_s) );
+  if(!m) return NULL;
+  m->format = format;
+
+  switch(format)
+  {
+    case oyMEASUREMENT_CGATS: error = oyMeasurementParseCgats_( m, p, end ); break;
+    case oyMEASUREMENT_CSV:   error = oyMeasurementParseCsv_( m, p, end ); break;
+    case oyMEASUREMENT_CXF:   error = oyMeasurementParseCxf_( m, p, end ); break;
+    default: error = 1;
+  }
+
+  if(error || !m->count)
+    oyMeasurementRelease( &m );
+
+  return m;
+}
+
+/** @brief Find a column by its field name
+ *
+ *  @param[in]     m                   the table
+ *  @param[in]     field               e.g. "LAB_L" or "SPECTRAL_NM380"
+ *  @return                            column index or -1
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2026/10/19
+ *  @since   2026/10/19 (Oyranos: 0.9.7)
+ */
+int          oyMeasurementFindColumn ( oyMeasurement_s   * m,
+                                       const char        * field )
+{
+  int i;
+
+  if(!m || !field) return -1;
+
+  for(i = 0; i < m->columns; ++i)
+    if(m->column_names[i] && strcmp( m->column_names[i], field ) == 0)
+      return i;
+
+  return -1;
+}
+
+/* oyjlValueSetDouble() without switching the locale for each value */
+static void  oyMeasurementSetNumber_ ( oyjl_val            v,
+                                       double              d )
+{
+  char t[32], * c;
+
+  snprintf( t, sizeof(t), "%g", d );
+  if((c = strchr( t, ',' )) != NULL)
+    *c = '.';
+  v->type = oyjl_t_number;
+  v->u.number.d = d;
+  v->u.number.r = oyMeasurementStrndup_( t, strlen(t) );
+  v->u.number.flags = OYJL_NUMBER_DOUBLE_VALID;
+  if(isfinite( d ) && fabs( d ) < 9e18)
+  {
+    v->u.number.i = (long long) d;
+    if((double)v->u.number.i == d)
+      v->u.number.flags |= OYJL_NUMBER_INT_VALID;
+  }
+}
+
+static int   oyMeasurementToTreeColor_( oyjl_val           specT,
+                                       oyMeasurement_s   * m,
+                                       const char        * key,
+                                       const char       ** fields,
+                                       const double      * scale,
+                                       const double      * offset )
+{
+  int column[4], n = 0, i, j;
+
+  for(n = 0; n < 4 && fields[n]; ++n)
+    if((column[n] = oyMeasurementFindColumn( m, fields[n] )) < 0)
+      return 0;
+
+  for(i = 0; i < m->count; ++i)
+    for(j = 0; j < n; ++j)
+      oyjlTreeSetDoubleF( specT, OYJL_CREATE_NEW,
+                          m->values[(size_t)i * (size_t)m->columns + (size_t)column[j]] * scale[j] + offset[j],
+                          "collection/[0]/colors/[%d]/%s/[0]/data/[%d]", i, key, j );
+
+  return n;
+}
+
+/** @brief Build a Named Color Collection tree
+ *
+ *  The tree has the ncc1 layout as used by oyranos-profile-graph.
+ *  The spectral arrays are filled in one go.
+ *
+ *  @param[in]     m                   the table
+ *  @return                            new tree; release with oyjlTreeFree()
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2026/10/19
+ *  @since   2026/10/19 (Oyranos: 0.9.7)
+ */
+oyjl_val     oyMeasurementToTree     ( oyMeasurement_s   * m )
+{
+  oyjl_val specT;
+  int i, j;
+
+  if(!m) return NULL;
+
+  specT = oyjlTreeNew( "" );
+  oyjlTreeSetStringF( specT, OYJL_CREATE_NEW, "ncc1", "type" );
+  oyjlTreeSetStringF( specT, OYJL_CREATE_NEW, "Named Color Collection v1", "comment" );
+  if(m->description)
+    oyjlTreeSetStringF( specT, OYJL_CREATE_NEW, m->description, "description" );
+  if(m->creator)
+    oyjlTreeSetStringF( specT, OYJL_CREATE_NEW, m->creator, "creator" );
+  if(m->date)
+    oyjlTreeSetStringF( specT, OYJL_CREATE_NEW, m->date, "date" );
+
+  for(i = 0; i < m->count; ++i)
+  {
+    oyjlTreeSetStringF( specT, OYJL_CREATE_NEW, m->names[i] ? m->names[i] : "",
+                        "collection/[0]/colors/[%d]/name", i );
+    if(m->bands)
+    {
+      const double * values = &m->values[(size_t)i * (size_t)m->columns + (size_t)m->spectral];
+      oyjl_val data = oyjlTreeGetValueF( specT, OYJL_CREATE_NEW,
+                                         "collection/[0]/colors/[%d]/spectral/[0]/data", i );
+      if(!data) continue;
+      oyjlValueClear( data );
+      data->type = oyjl_t_array;
+      data->u.array.values = (oyjl_val*) calloc( (size_t)m->bands + 1, sizeof(oyjl_val) );
+      if(!data->u.array.values) continue;
+      for(j = 0; j < m->bands; ++j)
+      {
+        oyjl_val v = (oyjl_val) calloc( 1, sizeof(*v) );
+        if(!v) break;
+        oyMeasurementSetNumber_( v, values[j] );
+        data->u.array.values[j] = v;
+        data->u.array.len = (size_t)j + 1;
+      }
+    }
+  }
+
+  if(m->bands)
+  {
+    double endNM = m->start + m->lambda * (m->bands - 1);
+    oyjlTreeSetDoubleF( specT, OYJL_CREATE_NEW, m->start, "collection/[0]/spectral/[0]/startNM" );
+    oyjlTreeSetDoubleF( specT, OYJL_CREATE_NEW, endNM, "collection/[0]/spectral/[0]/endNM" );
+    oyjlTreeSetDoubleF( specT, OYJL_CREATE_NEW, m->lambda, "collection/[0]/spectral/[0]/lambda" );
+    oyjlTreeSetDoubleF( specT, OYJL_CREATE_NEW, m->bands, "collection/[0]/spectral/[0]/steps" );
+  }
+
+  /* same scaling as for CxF */
+  {
+    const char * xyz[] = {"XYZ_X","XYZ_Y","XYZ_Z",NULL},
+               * lab[] = {"LAB_L","LAB_A","LAB_B",NULL},
+               * cmyk[] = {"CMYK_C","CMYK_M","CMYK_Y","CMYK_K"};
+    const double percent[] = {0.01,0.01,0.01,0.01}, zero[] = {0,0,0,0},
+                 lab_scale[] = {0.01,1.0/255.0,1.0/255.0}, lab_offset[] = {0,0.5,0.5};
+    oyMeasurementToTreeColor_( specT, m, "xyz", xyz, percent, zero );
+    oyMeasurementToTreeColor_( specT, m, "lab", lab, lab_scale, lab_offset );
+    oyMeasurementToTreeColor_( specT, m, "cmyk", cmyk, percent, zero );
+  }
+
+  return specT;
+}
+
+/** @brief Release a measurement table
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2026/10/19
+ *  @since   2026/10/19 (Oyranos: 0.9.7)
+ */
+void         oyMeasurementRelease    ( oyMeasurement_s  ** m )
+{
+  oyMeasurement_s * s;
+  int i;
+
+  if(!m || !*m) return;
+  s = *m;
+
+  if(s->column_names)
+  {
+    for(i = 0; i < s->columns; ++i)
+      if(s->column_names[i]) free( s->column_names[i] );
+    free( s->column_names );
+  }
+  if(s->names)
+  {
+    for(i = 0; i < s->capacity; ++i)
+      if(s->names[i]) free( s->names[i] );
+    free( s->names );
+  }
+  if(s->values) free( s->values );
+  if(s->description) free( s->description );
+  if(s->creator) free( s->creator );
+  if(s->date) free( s->date );
+  free( s );
+  *m = NULL;
+}
+
+/** @} *//* color_low */
@@ -231,6 +231,7 @@ void     oyAlphaFinish_              ( int                 unused OY_UNUSED )
 
   oyStructList_Release( &oy_cmm_handles_ );
   oyStructList_Release_( &oy_profile_s_file_cache_ );
+  oySharedCacheRelease_();
   oyOptions_Release( &oy_db_cache_ );
   oyOptions_Release( &oy_config_options_dummy_ );
 
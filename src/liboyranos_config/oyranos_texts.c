@@ -3,7 +3,7 @@
  *  Oyranos is an open source Color Management System 
  *
  *  @par Copyright:
- *            2004-2017 (C) Kai-Uwe Behrmann
+ *            2004-2026 (C) Kai-Uwe Behrmann
  *
  *  @brief    pure text handling functions
  *  @internal
@@ -2374,6 +2374,7 @@ int          oyGetPersistentStrings  ( const char        * top_key_name )
   {
     oyOptions_Release( &oy_db_cache_ );
     oyConfigs_Release( &oy_monitors_cache_ );
+    oyStructList_Release( &oy_device_index_cache_ );
     oy_db_cache_init_ = 0;
   }
   else
@@ -0,0 +1,109 @@
+/*
+-------------------------------------------------------------------------------
+murmur3.c, MurmurHash3 x64_128 by Austin Appleby, 2011, Public Domain.
+
+MurmurHash3 was written by Austin Appleby, and is placed in the public
+domain. The author hereby disclaims copyright to this source code.
+
+This is a C port of the x64_128 variant of MurmurHash3.cpp from the
+SMHasher project. It produces a non cryptographic 128-bit hash and is
+used inside Oyranos for in memory cache keys, where a MD5 digest is not
+needed. Blocks are read with memcpy() to stay alignment safe. The result
+is host endian and shall not be stored or compared across machines.
+-------------------------------------------------------------------------------
+*/
+
+#include <string.h>     /* memcpy */
+#include "oyranos_types.h"     /* defines uint32_t etc */
+#include "murmur3.h"
+
+static inline uint64_t oy_rotl64 ( uint64_t x, int8_t r )
+{
+  return (x << r) | (x >> (64 - r));
+}
+
+static inline uint64_t oy_fmix64 ( uint64_t k )
+{
+  k ^= k >> 33;
+  k *= 0xff51afd7ed558ccdULL;
+  k ^= k >> 33;
+  k *= 0xc4ceb9fe1a85ec53ULL;
+  k ^= k >> 33;
+
+  return k;
+}
+
+void oy_murmur3_128( const void *key, size_t length, uint32_t seed,
+                     unsigned char out[16] )
+{
+  const uint8_t * data = (const uint8_t*)key;
+  const size_t nblocks = length / 16;
+  size_t i;
+
+  uint64_t h1 = seed;
+  uint64_t h2 = seed;
+
+  const uint64_t c1 = 0x87c37b91114253d5ULL;
+  const uint64_t c2 = 0x4cf5ad432745937fULL;
+
+  const uint8_t * tail;
+  uint64_t k1 = 0;
+  uint64_t k2 = 0;
+
+  /*----------------------------------------------------------- body */
+  for(i = 0; i < nblocks; i++)
+  {
+    memcpy( &k1, data + i*16, 8 );
+    memcpy( &k2, data + i*16 + 8, 8 );
+
+    k1 *= c1; k1  = oy_rotl64(k1,31); k1 *= c2; h1 ^= k1;
+
+    h1 = oy_rotl64(h1,27); h1 += h2; h1 = h1*5+0x52dce729;
+
+    k2 *= c2; k2  = oy_rotl64(k2,33); k2 *= c1; h2 ^= k2;
+
+    h2 = oy_rotl64(h2,31); h2 += h1; h2 = h2*5+0x38495ab5;
+  }
+
+  /*----------------------------------------------------------- tail */
+  tail = data + nblocks*16;
+  k1 = 0;
+  k2 = 0;
+
+  switch(length & 15)
+  {
+  case 15: k2 ^= ((uint64_t)tail[14]) << 48; /* fall through */
+  case 14: k2 ^= ((uint64_t)tail[13]) << 40; /* fall through */
+  case 13: k2 ^= ((uint64_t)tail[12]) << 32; /* fall through */
+  case 12: k2 ^= ((uint64_t)tail[11]) << 24; /* fall through */
+  case 11: k2 ^= ((uint64_t)tail[10]) << 16; /* fall through */
+  case 10: k2 ^= ((uint64_t)tail[ 9]) << 8;  /* fall through */
+  case  9: k2 ^= ((uint64_t)tail[ 8]) << 0;
+           k2 *= c2; k2  = oy_rotl64(k2,33); k2 *= c1; h2 ^= k2;
+           /* fall through */
+  case  8: k1 ^= ((uint64_t)tail[ 7]) << 56; /* fall through */
+  case  7: k1 ^= ((uint64_t)tail[ 6]) << 48; /* fall through */
+  case  6: k1 ^= ((uint64_t)tail[ 5]) << 40; /* fall through */
+  case  5: k1 ^= ((uint64_t)tail[ 4]) << 32; /* fall through */
+  case  4: k1 ^= ((uint64_t)tail[ 3]) << 24; /* fall through */
+  case  3: k1 ^= ((uint64_t)tail[ 2]) << 16; /* fall through */
+  case  2: k1 ^= ((uint64_t)tail[ 1]) << 8;  /* fall through */
+  case  1: k1 ^= ((uint64_t)tail[ 0]) << 0;
+           k1 *= c1; k1  = oy_rotl64(k1,31); k1 *= c2; h1 ^= k1;
+  }
+
+  /*----------------------------------------------------------- finalization */
+  h1 ^= (uint64_t)length; h2 ^= (uint64_t)length;
+
+  h1 += h2;
+  h2 += h1;
+
+  h1 = oy_fmix64(h1);
+  h2 = oy_fmix64(h2);
+
+  h1 += h2;
+  h2 += h1;
+
+  memcpy( out, &h1, 8 );
+  memcpy( out + 8, &h2, 8 );
+}
@@ -20,6 +20,7 @@
 
 #include "md5.h"
 #include "lookup3.h" /* oy_hashlittle */
+#include "murmur3.h" /* oy_murmur3_128 */
 
 
 #include <stdio.h>
@@ -52,6 +53,13 @@ signed int oy_debug_objects = -1;
  *  @see @ref debug_vars
  */
 int oy_debug_signals = 0;
+/** @brief    Aktivate filter node counters
+ *
+ *  Maps to ::OY_STATS environment variable.
+ *
+ *  @see oyConversion_GetStats()
+ */
+int oy_stats = 0;
 const char * oy_backtrace = 0;
 #ifndef NO_OPT
 #define OY_USE_ALLOCATE_FUNC_POOL_ 0
@@ -292,13 +300,18 @@ void* oyAllocateWrapFunc_       (size_t        size,
 /** @internal
  *  @brief hash calculation
  *
+ *  Zero flags select oyHASH_FAST, a 128-bit non cryptographic hash for
+ *  in memory cache keys. It is much cheaper than MD5 on long hash texts.
+ *  Use oyHASH_MD5 explicitly for anything stored or compared with
+ *  ICC profile IDs.
+ *
  *  @param[in]     buffer              some buffer
  *  @param[in]     size                size of buffer
- *  @param[in]     flags               zero or oyHASH_MD5 or oyHASH_L3
+ *  @param[in]     flags               zero, oyHASH_FAST, oyHASH_MD5 or oyHASH_L3
  *  @param[out]    digest              result in OY_HASH_SIZE * 2 bytes
  *
  *  @version Oyranos: 0.9.7
- *  @date    2022/05/26
+ *  @date    2026/10/19
  *  @since   2013/03/13 (Oyranos: 0.9.5)
  */
 int                oyMiscBlobGetHash_( const void        * buffer,
@@ -321,9 +334,15 @@ int                oyMiscBlobGetHash_( const void        * buffer,
       sprintf( (char*) digest, "%d", dig );
     }
     else
+    if(flags & oyHASH_MD5)
     {
       error = oyMiscBlobGetMD5_( buffer, size, digest );
     }
+    else
+    {
+      memset( digest, 0, OY_HASH_SIZE * 2 );
+      oy_murmur3_128( buffer, size, 0, digest );
+    }
 
     if(oy_debug >= 4)
     {
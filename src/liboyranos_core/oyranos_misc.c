@@ -14,8 +14,13 @@
  */
 
 #include <math.h>
+#include <string.h>   /* memcpy */
 #include "oyranos_types.h"
 
+#if defined(__F16C__)
+#include <immintrin.h> /* _mm256_cvtph_ps _mm256_cvtps_ph */
+#endif
+
 float        oyLinInterpolateRampU16c( uint16_t          * ramp,
                                        int                 ramp_size,
                                        int                 ramp_channel,
@@ -177,3 +182,159 @@ int            oyRampManipulateF64   ( double            * ramp1,
   return error;
 }
 
+
+/** @brief convert one IEEE 754 half float to float
+ *
+ *  Handles zeros, subnormals, infinity and NaN.
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2026/10/19
+ *  @since   2026/10/19 (Oyranos: 0.9.7)
+ */
+float          oyHalfToFloat         ( uint16_t            h )
+{
+  uint32_t sign = (uint32_t)(h & 0x8000) << 16,
+           exponent = (h >> 10) & 0x1f,
+           mantissa = h & 0x3ff,
+           bits;
+  float f;
+
+  if(exponent == 0)
+  {
+    if(mantissa == 0)
+      bits = sign;
+    else
+    {
+      /* subnormal: normalise the mantissa */
+      exponent = 127 - 15 + 1;
+      while(!(mantissa & 0x400))
+      {
+        mantissa <<= 1;
+        --exponent;
+      }
+      mantissa &= 0x3ff;
+      bits = sign | (exponent << 23) | (mantissa << 13);
+    }
+  } else if(exponent == 0x1f)
+    bits = sign | 0x7f800000 | (mantissa << 13);
+  else
+    bits = sign | ((exponent + 127 - 15) << 23) | (mantissa << 13);
+
+  memcpy( &f, &bits, 4 );
+  return f;
+}
+
+/** @brief convert one float to IEEE 754 half float
+ *
+ *  Rounds to nearest even, like the F16C instructions do. Values out of
+ *  the half range become infinity, tiny values become subnormals or zero.
+ *  In contrast the OY_FLOAT2HALF macro truncates and is only valid for
+ *  normal numbers.
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2026/10/19
+ *  @since   2026/10/19 (Oyranos: 0.9.7)
+ */
+uint16_t       oyFloatToHalf         ( float               f )
+{
+  uint32_t bits, sign, mantissa, rest;
+  int32_t exponent;
+  uint16_t h;
+
+  memcpy( &bits, &f, 4 );
+  sign = (bits >> 16) & 0x8000;
+  exponent = (int32_t)((bits >> 23) & 0xff) - 127 + 15;
+  mantissa = bits & 0x7fffff;
+
+  if(((bits >> 23) & 0xff) == 0xff) /* Inf or NaN */
+    return sign | 0x7c00 | (mantissa ? 0x200 | (mantissa >> 13) : 0);
+
+  if(exponent >= 0x1f) /* overflow */
+    return sign | 0x7c00;
+
+  if(exponent <= 0) /* subnormal or zero */
+  {
+    int shift;
+    uint32_t halfway;
+
+    if(exponent < -10)
+      return sign;
+
+    mantissa |= 0x800000;
+    shift = 14 - exponent;
+    h = mantissa >> shift;
+    rest = mantissa & ((1u << shift) - 1);
+    halfway = 1u << (shift - 1);
+    if(rest > halfway || (rest == halfway && (h & 1)))
+      ++h;
+    return sign | h;
+  }
+
+  h = sign | (exponent << 10) | (mantissa >> 13);
+  rest = mantissa & 0x1fff;
+  /* a carry flows into the exponent and gives the correct result */
+  if(rest > 0x1000 || (rest == 0x1000 && (h & 1)))
+    ++h;
+
+  return h;
+}
+
+/** @brief convert a line of half floats to floats
+ *
+ *  Uses F16C instructions, if the compiler targets them (-mf16c or
+ *  -march=native), otherwise a scalar loop. Source and destination must
+ *  not overlap.
+ *
+ *  @param[in]     src                 half float samples
+ *  @param[out]    dst                 float samples
+ *  @param[in]     n                   number of samples
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2026/10/19
+ *  @since   2026/10/19 (Oyranos: 0.9.7)
+ */
+void           oyHalfToFloatLine     ( const uint16_t    * src,
+                                       float             * dst,
+                                       size_t              n )
+{
+  size_t i = 0;
+
+#if defined(__F16C__)
+  for( ; i + 8 <= n; i += 8)
+    _mm256_storeu_ps( &dst[i],
+                      _mm256_cvtph_ps( _mm_loadu_si128( (const __m128i*)&src[i] ) ) );
+#endif
+
+  for( ; i < n; ++i)
+    dst[i] = oyHalfToFloat( src[i] );
+}
+
+/** @brief convert a line of floats to half floats
+ *
+ *  The counter part of oyHalfToFloatLine(). Rounds to nearest even.
+ *  Source and destination must not overlap.
+ *
+ *  @param[in]     src                 float samples
+ *  @param[out]    dst                 half float samples
+ *  @param[in]     n                   number of samples
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2026/10/19
+ *  @since   2026/10/19 (Oyranos: 0.9.7)
+ */
+void           oyFloatToHalfLine     ( const float       * src,
+                                       uint16_t          * dst,
+                                       size_t              n )
+{
+  size_t i = 0;
+
+#if defined(__F16C__)
+  for( ; i + 8 <= n; i += 8)
+    _mm_storeu_si128( (__m128i*)&dst[i],
+                      _mm256_cvtps_ph( _mm256_loadu_ps( &src[i] ),
+                                       _MM_FROUND_TO_NEAREST_INT ) );
+#endif
+
+  for( ; i < n; ++i)
+    dst[i] = oyFloatToHalf( src[i] );
+}
@@ -66,6 +66,9 @@ void oyInit_()
   if(getenv(OY_DEBUG_SIGNALS))
     oy_debug_signals = atoi(getenv(OY_DEBUG_SIGNALS));
 
+  if(getenv(OY_STATS))
+    oy_stats = atoi(getenv(OY_STATS));
+
   if(getenv(OY_BACKTRACE))
   {
     oy_backtrace = getenv(OY_BACKTRACE);
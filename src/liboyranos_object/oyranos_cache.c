@@ -3,7 +3,7 @@
  *  Oyranos is an open source Color Management System 
  *
  *  @par Copyright:
- *            2004-2017 (C) Kai-Uwe Behrmann
+ *            2004-2026 (C) Kai-Uwe Behrmann
  *
  *  @brief    private Oyranos cache API's
  *  @author   Kai-Uwe Behrmann <ku.b@gmx.de>
@@ -18,7 +18,22 @@
 #include "oyObject_s_.h"
 #include "oyProfiles_s_.h"
 #include "oyOptions_s_.h"
+#include "oyranos_debug.h"
+#include "oyranos_helper.h"
+#include "oyranos_i18n.h"
 
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#if defined(HAVE_POSIX) && defined(__GNUC__) && !defined(_WIN32)
+#define OY_SHARED_CACHE_MAP 1
+#include <fcntl.h>
+#include <sched.h>
+#include <sys/file.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
 
 
 /** @internal
@@ -122,6 +137,16 @@ oyOptions_s * oy_db_cache_ = NULL;
  *  @date  05.2018 (API 0.9.7)
  */
 oyConfigs_s * oy_monitors_cache_ = NULL;
+/** @internal
+ *  @brief internal device to DB configuration indexes
+ *
+ *  One oyHash_s entry per device registration, see oyConfig_GetDB().
+ *  Can be reset with NULL arg to oyGetPersistentStrings().
+ *
+ *  @since Oyranos: version 0.9.7
+ *  @date  2026/10/19 (API 0.9.7)
+ */
+oyStructList_s * oy_device_index_cache_ = NULL;
 
 
 int      oyObjectUsedByStructList_   ( int                 id,
@@ -164,3 +189,354 @@ int      oyObjectUsedByCache_        ( int                 id )
 
   return 0;
 }
+
+
+/** @internal
+ *  @brief cross process cache for profile blocks and device links
+ *
+ *  The cache is switched on by setting the OY_SHARED_CACHE environment
+ *  variable to a file path. All processes on one host using the same
+ *  path map the same file. It keeps a header, a fixed open addressing slot
+ *  table and a append only data area. Entries are immutable once published.
+ *
+ *  Readers need no locks. A slot is published by a release store to its
+ *  state after the data and the slot fields are written. Readers do a
+ *  acquire load of the state and compare the full oyHash_s key.
+ *  Writers are serialised by flock() across processes and by a spin lock
+ *  inside the process. flock() does not exclude holders of the same open
+ *  file description, which fork() shares. So a forked child reopens the
+ *  file before its first write. There is no eviction. A full cache simply refuses new
+ *  entries and the callers keep using the in process caches like
+ *  oy_profile_s_file_cache_ and oy_cmm_cache_.
+ *
+ *  @since 2026/10/19 (Oyranos: 0.9.7)
+ */
+#define OY_SHARED_CACHE_MAGIC "oyShmC1"
+#define OY_SHARED_CACHE_SLOTS 8192
+#define OY_SHARED_CACHE_SIZE  (64*1024*1024)
+#define OY_SHARED_CACHE_KEY   (2*OY_HASH_SIZE)
+typedef struct {
+  char     magic[8];
+  uint32_t version;
+  uint32_t slots;
+  uint64_t size;
+  uint64_t data_top;                   /* first free byte; writer only */
+  uint64_t data_start;
+  char     reserved[24];
+} oySharedCacheHeader_s;
+typedef struct {
+  uint32_t state;                      /* 0 - empty; 1 - published */
+  uint32_t type;
+  uint64_t offset;
+  uint64_t size;
+  unsigned char key[OY_SHARED_CACHE_KEY];
+} oySharedCacheSlot_s;
+
+#ifdef OY_SHARED_CACHE_MAP
+static int    oy_shared_cache_state_ = 0; /* 0 - unchecked; 1 - mapped; -1 - off */
+static int    oy_shared_cache_fd_ = -1;
+static pid_t  oy_shared_cache_pid_ = 0;  /* owner of oy_shared_cache_fd_ */
+static char * oy_shared_cache_path_ = NULL;
+static char * oy_shared_cache_map_ = NULL;
+static size_t oy_shared_cache_map_size_ = 0;
+static char   oy_shared_cache_lock_ = 0;
+
+static void  oySharedCacheLock_      ( void )
+{
+  while(__atomic_test_and_set( &oy_shared_cache_lock_, __ATOMIC_ACQUIRE ))
+    sched_yield();
+}
+static void  oySharedCacheUnlock_    ( void )
+{
+  __atomic_clear( &oy_shared_cache_lock_, __ATOMIC_RELEASE );
+}
+
+/* needs oySharedCacheLock_() */
+static int   oySharedCacheOpen_      ( void )
+{
+  const char * path = getenv(OY_SHARED_CACHE);
+  oySharedCacheHeader_s * h;
+  struct stat st;
+  size_t size = OY_SHARED_CACHE_SIZE;
+  int fd;
+
+  oy_shared_cache_state_ = -1;
+  if(!path || !path[0])
+    return 1;
+
+  fd = open( path, O_RDWR | O_CREAT, 0600 );
+  if(fd < 0)
+  {
+    WARNc2_S( "%s: %s", _("Could not open"), path );
+    return 1;
+  }
+
+  flock( fd, LOCK_EX );
+  if(fstat( fd, &st ) == 0 && st.st_size == 0)
+  {
+    oySharedCacheHeader_s init;
+    memset( &init, 0, sizeof(init) );
+    memcpy( init.magic, OY_SHARED_CACHE_MAGIC, 8 );
+    init.version = 1;
+    init.slots = OY_SHARED_CACHE_SLOTS;
+    init.size = size;
+    init.data_start = sizeof(init) + OY_SHARED_CACHE_SLOTS * sizeof(oySharedCacheSlot_s);
+    init.data_top = init.data_start;
+    if(ftruncate( fd, size ) != 0 ||
+       pwrite( fd, &init, sizeof(init), 0 ) != (ssize_t)sizeof(init))
+      size = 0;
+  } else
+    size = st.st_size;
+  flock( fd, LOCK_UN );
+
+  if(size >= sizeof(oySharedCacheHeader_s))
+    oy_shared_cache_map_ = mmap( NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0 );
+  if(!oy_shared_cache_map_ || oy_shared_cache_map_ == MAP_FAILED)
+  {
+    oy_shared_cache_map_ = NULL;
+    close( fd );
+    return 1;
+  }
+
+  h = (oySharedCacheHeader_s*) oy_shared_cache_map_;
+  if(memcmp( h->magic, OY_SHARED_CACHE_MAGIC, 8 ) != 0 || h->version != 1 ||
+     h->size != size ||
+     h->data_start != sizeof(*h) + h->slots * sizeof(oySharedCacheSlot_s) ||
+     h->data_start > size)
+  {
+    WARNc2_S( "%s: %s", _("Can not use"), path );
+    munmap( oy_shared_cache_map_, size );
+    oy_shared_cache_map_ = NULL;
+    close( fd );
+    return 1;
+  }
+
+  oy_shared_cache_fd_ = fd;
+  oy_shared_cache_pid_ = getpid();
+  oy_shared_cache_path_ = oyStringCopy( path, oyAllocateFunc_ );
+  oy_shared_cache_map_size_ = size;
+  oy_shared_cache_state_ = 1;
+  return 0;
+}
+
+/* a own open file description for flock(); needs oySharedCacheLock_() */
+static int   oySharedCacheWriteFd_   ( void )
+{
+  pid_t pid = getpid();
+
+  if(oy_shared_cache_pid_ != pid)
+  {
+    int fd = oy_shared_cache_path_ ? open( oy_shared_cache_path_, O_RDWR ) : -1;
+    if(fd < 0)
+      return -1;
+    /* the inherited descriptor stays open in the parent */
+    close( oy_shared_cache_fd_ );
+    oy_shared_cache_fd_ = fd;
+    oy_shared_cache_pid_ = pid;
+  }
+
+  return oy_shared_cache_fd_;
+}
+
+static oySharedCacheHeader_s * oySharedCacheMap_ ( void )
+{
+  int state = __atomic_load_n( &oy_shared_cache_state_, __ATOMIC_ACQUIRE );
+  if(state == 0)
+  {
+    oySharedCacheLock_();
+    if(oy_shared_cache_state_ == 0)
+      oySharedCacheOpen_();
+    state = oy_shared_cache_state_;
+    oySharedCacheUnlock_();
+  }
+  return state == 1 ? (oySharedCacheHeader_s*) oy_shared_cache_map_ : NULL;
+}
+
+static const unsigned char * oySharedCacheKey_ ( oyHash_s * entry )
+{
+  if(!entry || !entry->oy_ || !entry->oy_->hash_ptr_)
+    return NULL;
+  return entry->oy_->hash_ptr_;
+}
+
+/* Find the slot for key. Returns the first empty slot on a miss. */
+static oySharedCacheSlot_s * oySharedCacheFind_ (
+                                       oySharedCacheHeader_s * h,
+                                       const unsigned char * key,
+                                       oySHARED_CACHE_e    type,
+                                       int               * found )
+{
+  oySharedCacheSlot_s * slots = (oySharedCacheSlot_s*)(h + 1);
+  uint64_t k[4];
+  uint32_t i, n = h->slots, pos;
+
+  memcpy( k, key, sizeof(k) );
+  pos = (uint32_t)((k[0] ^ k[2] ^ (k[1] >> 7) ^ type) % n);
+  *found = 0;
+
+  for(i = 0; i < n; ++i)
+  {
+    oySharedCacheSlot_s * slot = &slots[(pos + i) % n];
+    uint32_t state = __atomic_load_n( &slot->state, __ATOMIC_ACQUIRE );
+    if(state == 0)
+      return slot;
+    if(slot->type == (uint32_t)type &&
+       memcmp( slot->key, key, OY_SHARED_CACHE_KEY ) == 0)
+    {
+      *found = 1;
+      return slot;
+    }
+  }
+
+  return NULL;
+}
+#endif /* OY_SHARED_CACHE_MAP */
+
+/** @internal
+ *  @brief look up a block in the cross process cache
+ *
+ *  @param[in]     entry               the in process cache entry; its hash is the key
+ *  @param[in]     type                the kind of data
+ *  @param[out]    size                the block size
+ *  @param[out]    block               a copy allocated with allocateFunc
+ *  @param[in]     allocateFunc        the user allocator
+ *  @return                            0 - found; -1 - not found or off; 1 - error
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2026/10/19
+ *  @since   2026/10/19 (Oyranos: 0.9.7)
+ */
+int      oySharedCacheGet_           ( oyHash_s          * entry,
+                                       oySHARED_CACHE_e    type,
+                                       size_t            * size,
+                                       oyPointer         * block,
+                                       oyAlloc_f           allocateFunc )
+{
+#ifdef OY_SHARED_CACHE_MAP
+  oySharedCacheHeader_s * h = oySharedCacheMap_();
+  const unsigned char * key = oySharedCacheKey_( entry );
+  oySharedCacheSlot_s * slot;
+  int found = 0;
+  char * data;
+
+  if(!h || !key || !size || !block)
+    return -1;
+
+  slot = oySharedCacheFind_( h, key, type, &found );
+  if(!found)
+    return -1;
+
+  if(slot->offset < h->data_start ||
+     slot->offset + slot->size > oy_shared_cache_map_size_)
+    return 1;
+
+  data = oyAllocateWrapFunc_( slot->size, allocateFunc );
+  if(!data)
+    return 1;
+  memcpy( data, oy_shared_cache_map_ + slot->offset, slot->size );
+  *block = data;
+  *size = slot->size;
+  return 0;
+#else
+  (void)entry; (void)type; (void)size; (void)block; (void)allocateFunc;
+  return -1;
+#endif
+}
+
+/** @internal
+ *  @brief publish a block in the cross process cache
+ *
+ *  Already present entries are kept. A full cache is no error.
+ *
+ *  @param[in]     entry               the in process cache entry; its hash is the key
+ *  @param[in]     type                the kind of data
+ *  @param[in]     block               the data to copy
+ *  @param[in]     size                the block size
+ *  @return                            0 - stored or present; -1 - off or full
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2026/10/19
+ *  @since   2026/10/19 (Oyranos: 0.9.7)
+ */
+int      oySharedCacheSet_           ( oyHash_s          * entry,
+                                       oySHARED_CACHE_e    type,
+                                       const void        * block,
+                                       size_t              size )
+{
+#ifdef OY_SHARED_CACHE_MAP
+  oySharedCacheHeader_s * h = oySharedCacheMap_();
+  const unsigned char * key = oySharedCacheKey_( entry );
+  oySharedCacheSlot_s * slot;
+  int found = 0, error = -1, fd;
+  uint64_t top;
+
+  if(!h || !key || !block || !size)
+    return -1;
+
+  slot = oySharedCacheFind_( h, key, type, &found );
+  if(found)
+    return 0;
+
+  oySharedCacheLock_();
+  fd = oySharedCacheWriteFd_();
+  if(fd < 0)
+  {
+    oySharedCacheUnlock_();
+    return -1;
+  }
+  flock( fd, LOCK_EX );
+
+  /* an other writer might have been faster */
+  slot = oySharedCacheFind_( h, key, type, &found );
+  top = (h->data_top + 15) & ~(uint64_t)15;
+  if(found)
+    error = 0;
+  else if(slot && top + size <= h->size)
+  {
+    memcpy( oy_shared_cache_map_ + top, block, size );
+    slot->type = type;
+    slot->offset = top;
+    slot->size = size;
+    memcpy( slot->key, key, OY_SHARED_CACHE_KEY );
+    __atomic_store_n( &slot->state, 1, __ATOMIC_RELEASE );
+    h->data_top = top + size;
+    error = 0;
+  }
+
+  flock( fd, LOCK_UN );
+  oySharedCacheUnlock_();
+
+  return error;
+#else
+  (void)entry; (void)type; (void)block; (void)size;
+  return -1;
+#endif
+}
+
+/** @internal
+ *  @brief unmap the cross process cache
+ *
+ *  The next access reads OY_SHARED_CACHE again.
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2026/10/19
+ *  @since   2026/10/19 (Oyranos: 0.9.7)
+ */
+void     oySharedCacheRelease_       ( void )
+{
+#ifdef OY_SHARED_CACHE_MAP
+  oySharedCacheLock_();
+  if(oy_shared_cache_map_)
+    munmap( oy_shared_cache_map_, oy_shared_cache_map_size_ );
+  if(oy_shared_cache_fd_ >= 0)
+    close( oy_shared_cache_fd_ );
+  oy_shared_cache_map_ = NULL;
+  oy_shared_cache_map_size_ = 0;
+  oy_shared_cache_fd_ = -1;
+  oy_shared_cache_pid_ = 0;
+  if(oy_shared_cache_path_)
+    oyFree_m_( oy_shared_cache_path_ );
+  __atomic_store_n( &oy_shared_cache_state_, 0, __ATOMIC_RELEASE );
+  oySharedCacheUnlock_();
+#endif
+}
@@ -1577,7 +1577,7 @@ oyConnectorImaging_s_ l2cms_cmmIccSocket_connector = {
   oyFilterSocket_MatchImagingPlug, /* filterSocket_MatchPlug */
   0, /* is_plug == oyFilterPlug_s */
   l2cms_cmmIcc_data_types, /* data_types */
-  3, /* data_types_n; elements in data_types array */
+  5, /* data_types_n; elements in data_types array */
   1, /* max_color_offset */
   1, /* min_channels_count; */
   16, /* max_channels_count; */
@@ -1607,7 +1607,7 @@ oyConnectorImaging_s_ l2cms_cmmIccPlug_connector = {
   oyFilterSocket_MatchImagingPlug, /* filterSocket_MatchPlug */
   1, /* is_plug == oyFilterPlug_s */
   l2cms_cmmIcc_data_types, /* data_types */
-  3, /* data_types_n; elements in data_types array */
+  5, /* data_types_n; elements in data_types array */
   1, /* max_color_offset */
   1, /* min_channels_count; */
   16, /* max_channels_count; */
@@ -102,8 +102,288 @@ struct oyDB_s {
 
   /* private members */
   openiccDB_s * db;
+  struct oiDBSnapshot_s * snapshot;    /* shared parsed DB or NULL */
 };
 
+/* --- parsed DB snapshot --- */
+
+/* libOpenICC parses the whole JSON DB on each openiccDB_NewFrom() call.
+ * oyDB_newFrom() is called for nearly each settings, device and rank map
+ * lookup. So the parsed DB is kept process wide per scope and shared
+ * read only between all handles. It is rebuilt when a DB file changed,
+ * as seen by stat() or by inotify on Linux, and after each write through
+ * this module. The lock guards only the snapshot table; parsing happens
+ * outside of it. A forked child creates its own inotify instance, as the
+ * inherited one shares its event queue with the parent. */
+
+#include <sys/stat.h>
+#include <sched.h>                     /* sched_yield() */
+#if defined(__linux__)
+#include <sys/inotify.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+#define OI_DB_SNAPSHOT_FILES 2
+typedef struct oiDBSnapshot_s {
+  openiccSCOPE_e scope;
+  openiccDB_s  * db;                   /* parsed read only DB */
+  int            ref;                  /* handles using db */
+  int            stale;                /* not anymore the current snapshot */
+  char         * files[OI_DB_SNAPSHOT_FILES];
+  struct stat    st[OI_DB_SNAPSHOT_FILES]; /* st_ino == 0 - missing file */
+  int            wd[OI_DB_SNAPSHOT_FILES]; /* inotify watch descriptors */
+  int            watched;              /* all files are covered by inotify */
+  char         * env;                  /* XDG variables the paths came from */
+} oiDBSnapshot_s;
+
+/* indexed by openiccSCOPE_USER_SYS, openiccSCOPE_USER, openiccSCOPE_SYSTEM */
+static oiDBSnapshot_s * oi_db_snapshot_[3] = {NULL,NULL,NULL};
+static char oi_db_snapshot_lock_ = 0;
+static unsigned oi_db_snapshot_gen_ = 0; /* counts oiDBSnapshotInvalidate_() */
+static int oi_db_inotify_ = -2;        /* -2 - not yet tried, -1 - none */
+#if defined(__linux__)
+static pid_t oi_db_inotify_pid_ = 0;   /* process owning oi_db_inotify_ */
+#endif
+
+/* short critical sections only; never held while parsing */
+static void oiDBSnapshotLock_        ( void )
+{
+  while(__atomic_test_and_set( &oi_db_snapshot_lock_, __ATOMIC_ACQUIRE ))
+    sched_yield();
+}
+static void oiDBSnapshotUnLock_      ( void )
+{
+  __atomic_clear( &oi_db_snapshot_lock_, __ATOMIC_RELEASE );
+}
+
+static void oiDBSnapshotFree_        ( oiDBSnapshot_s   ** snap )
+{
+  oiDBSnapshot_s * s = *snap;
+  int i;
+  /* inotify watches are per directory and shared by all snapshots */
+  for(i = 0; i < OI_DB_SNAPSHOT_FILES; ++i)
+    if(s->files[i]) free( s->files[i] );
+  if(s->env) free( s->env );
+  openiccDB_Release( &s->db );
+  free( s );
+  *snap = NULL;
+}
+
+/* mark all snapshots stale; call with lock held */
+static void oiDBSnapshotInvalidate_  ( void )
+{
+  int i;
+  ++oi_db_snapshot_gen_;
+  for(i = 0; i < 3; ++i)
+  {
+    oiDBSnapshot_s * s = oi_db_snapshot_[i];
+    if(!s) continue;
+    oi_db_snapshot_[i] = NULL;
+    s->stale = 1;
+    if(s->ref == 0)
+      oiDBSnapshotFree_( &s );
+  }
+}
+
+#if defined(__linux__)
+/* @return 1 - some watched DB file changed */
+static int oiDBSnapshotDrainINotify_ ( void )
+{
+  char buf[4096] __attribute__ ((aligned(__alignof__(struct inotify_event))));
+  int changed = 0;
+  ssize_t len;
+  while((len = read( oi_db_inotify_, buf, sizeof(buf) )) > 0)
+    changed = 1;
+  return changed;
+}
+
+/* (re-)create the inotify instance for this process; call with lock held
+ * @return 1 - the instance was inherited from the parent process */
+static int oiDBSnapshotINotifyInit_  ( void )
+{
+  pid_t pid = getpid();
+  int forked = 0;
+  if(oi_db_inotify_pid_ != pid)
+  {
+    /* events of an inherited instance are consumed by whichever process
+     * reads first; the watches of old snapshots refer to that instance */
+    forked = oi_db_inotify_ != -2;
+    if(oi_db_inotify_ >= 0)
+      close( oi_db_inotify_ );
+    oi_db_inotify_ = inotify_init1( IN_NONBLOCK | IN_CLOEXEC );
+    oi_db_inotify_pid_ = pid;
+  }
+  return forked;
+}
+#endif
+
+/* the DB paths depend on these variables; see xdg_bds() */
+static char * oiDBSnapshotEnv_       ( void )
+{
+  const char * vars[] = {"XDG_CONF_HOME","XDG_CONFIG_DIRS","HOME","APPDATA",NULL};
+  char * env = NULL;
+  int i;
+  for(i = 0; vars[i]; ++i)
+  {
+    const char * v = getenv( vars[i] );
+    oyjlStringAdd( &env, malloc, free, "%s;", v ? v : "" );
+  }
+  return env;
+}
+
+/* compare file states; @return 1 - same as in snapshot */
+static int oiDBSnapshotIsCurrent_    ( oiDBSnapshot_s    * s )
+{
+  int i;
+  for(i = 0; i < OI_DB_SNAPSHOT_FILES; ++i)
+  {
+    struct stat st;
+    const char * file = s->files[i];
+    if(!file) continue;
+    memset( &st, 0, sizeof(st) );
+    if(stat( file, &st ) != 0)
+      st.st_ino = 0;
+    if(st.st_ino != s->st[i].st_ino ||
+       st.st_size != s->st[i].st_size ||
+       st.st_mtime != s->st[i].st_mtime
+#if defined(__linux__)
+       || st.st_mtim.tv_nsec != s->st[i].st_mtim.tv_nsec
+#endif
+      )
+      return 0;
+  }
+  return 1;
+}
+
+static oiDBSnapshot_s * oiDBSnapshotNew_ ( openiccSCOPE_e scope )
+{
+  oiDBSnapshot_s * s = calloc( 1, sizeof(oiDBSnapshot_s) );
+  int i;
+  if(!s) return NULL;
+
+  s->scope = scope;
+  s->env = oiDBSnapshotEnv_();
+  s->watched = 1;
+  if(scope == openiccSCOPE_USER_SYS || scope == openiccSCOPE_USER)
+    s->files[0] = openiccDBGetJSONFile( openiccSCOPE_USER );
+  if(scope == openiccSCOPE_USER_SYS || scope == openiccSCOPE_SYSTEM)
+    s->files[1] = openiccDBGetJSONFile( openiccSCOPE_SYSTEM );
+
+  /* take the file states before parsing to see changes during the read */
+  for(i = 0; i < OI_DB_SNAPSHOT_FILES; ++i)
+  {
+    s->wd[i] = -1;
+    if(!s->files[i]) continue;
+    if(stat( s->files[i], &s->st[i] ) != 0)
+      memset( &s->st[i], 0, sizeof(struct stat) );
+#if defined(__linux__)
+    /* oi_db_inotify_ is set up by oiDBSnapshotGet_() */
+    if(oi_db_inotify_ >= 0)
+    {
+      /* watch the directory to see newly created and replaced files */
+      char * dir = oyjlStringCopy( s->files[i], malloc ),
+           * slash = dir ? strrchr( dir, '/' ) : NULL;
+      if(slash) *slash = '\000';
+      if(dir)
+        s->wd[i] = inotify_add_watch( oi_db_inotify_, dir,
+                                      IN_CLOSE_WRITE | IN_MOVED_TO | IN_CREATE |
+                                      IN_DELETE | IN_MODIFY );
+      free( dir );
+    }
+    if(s->wd[i] < 0)
+#endif
+      s->watched = 0;
+  }
+
+  /* the top key is not used for reading the DB files */
+  s->db = openiccDB_NewFrom( "", scope );
+  if(!s->db)
+    oiDBSnapshotFree_( &s );
+
+  return s;
+}
+
+/* obtain a referenced snapshot; @return NULL for unsupported scopes */
+static oiDBSnapshot_s * oiDBSnapshotGet_ ( oySCOPE_e     scope )
+{
+  oiDBSnapshot_s * s = NULL;
+  int changed = -1;
+  unsigned gen;
+
+  if(scope != oySCOPE_USER_SYS && scope != oySCOPE_USER &&
+     scope != oySCOPE_SYSTEM)
+    return NULL;
+
+  oiDBSnapshotLock_();
+#if defined(__linux__)
+  if(oiDBSnapshotINotifyInit_())
+    oiDBSnapshotInvalidate_();
+  else if(oi_db_inotify_ >= 0)
+  {
+    changed = oiDBSnapshotDrainINotify_();
+    if(changed)
+      oiDBSnapshotInvalidate_();
+  }
+#endif
+  s = oi_db_snapshot_[scope];
+  if(s)
+  {
+    char * env = oiDBSnapshotEnv_();
+    int current = env && strcmp( env, s->env ) == 0;
+    free( env );
+    /* without inotify events stat() is the only source of truth */
+    if(current && (changed != 0 || !s->watched))
+      current = oiDBSnapshotIsCurrent_( s );
+    if(!current)
+    {
+      oiDBSnapshotInvalidate_();
+      s = NULL;
+    }
+  }
+  if(s)
+    ++s->ref;
+  gen = oi_db_snapshot_gen_;
+  oiDBSnapshotUnLock_();
+
+  if(s)
+    return s;
+
+  /* parse without the lock; concurrent callers may parse the same DB */
+  s = oiDBSnapshotNew_( (openiccSCOPE_e) scope );
+  if(!s)
+    return NULL;
+  s->ref = 1;
+
+  oiDBSnapshotLock_();
+  if(gen != oi_db_snapshot_gen_)
+    /* written or invalidated meanwhile; serve this caller only */
+    s->stale = 1;
+  else if(oi_db_snapshot_[scope])
+  {
+    /* another thread was faster; prefer its snapshot */
+    oiDBSnapshot_s * other = oi_db_snapshot_[scope];
+    ++other->ref;
+    oiDBSnapshotFree_( &s );
+    s = other;
+  } else
+    oi_db_snapshot_[scope] = s;
+  oiDBSnapshotUnLock_();
+
+  return s;
+}
+
+static void oiDBSnapshotRelease_     ( oiDBSnapshot_s   ** snap )
+{
+  oiDBSnapshot_s * s = *snap;
+  oiDBSnapshotLock_();
+  --s->ref;
+  if(s->ref == 0 && s->stale)
+    oiDBSnapshotFree_( &s );
+  oiDBSnapshotUnLock_();
+  *snap = NULL;
+}
+
 oyDB_s * oiDB_newFrom                ( const char        * top_key_name,
                                        oySCOPE_e           scope,
                                        oyAlloc_f           allocFunc,
@@ -115,7 +395,11 @@ oyDB_s * oiDB_newFrom                ( const char        * top_key_name,
     memset( db,0, sizeof(oyDB_s) );
 
     sprintf( db->type, CMM_NICK );
-    db->db = openiccDB_NewFrom( top_key_name, (openiccSCOPE_e) scope );
+    db->snapshot = oiDBSnapshotGet_( scope );
+    if(db->snapshot)
+      db->db = db->snapshot->db;
+    else
+      db->db = openiccDB_NewFrom( top_key_name, (openiccSCOPE_e) scope );
     if(!db->db)
     {
       oiDB_msg( oyMSG_ERROR, 0, OY_DBG_FORMAT_ "creation of DB object failed", OY_DBG_ARGS_ );
@@ -143,7 +427,12 @@ void     oiDB_release                ( oyDB_s           ** db )
     if(s->top_key_name) { deAlloc(s->top_key_name); s->top_key_name = NULL; }
     memset( s->type, 0, 8 );
 
-    openiccDB_Release( &s->db );
+    if(s->snapshot)
+    {
+      oiDBSnapshotRelease_( &s->snapshot );
+      s->db = NULL;
+    } else
+      openiccDB_Release( &s->db );
 
     deAlloc( s );
     *db = NULL;
@@ -251,6 +540,9 @@ int oiDBSetString                    ( const char        * key_name,
   char * oi = oiOyranosToOpenicc( key_name, 0 );
   int error = openiccDBSetString( oi, (openiccSCOPE_e)scope, value, comment );
   if(oi) oyFree_m_(oi);
+  oiDBSnapshotLock_();
+  oiDBSnapshotInvalidate_();
+  oiDBSnapshotUnLock_();
   return error;
 }
 char*    oiDBSearchEmptyKeyname        ( const char      * key_parent_name,
@@ -269,6 +561,9 @@ int      oiDBEraseKey                ( const char        * key_name,
   char * oi = oiOyranosToOpenicc( key_name, 0 );
   int error = openiccDBSetString( oi, (openiccSCOPE_e)scope, NULL, "delete" );
   if(oi) oyFree_m_(oi);
+  oiDBSnapshotLock_();
+  oiDBSnapshotInvalidate_();
+  oiDBSnapshotUnLock_();
   return error;
 }
 
@@ -322,7 +617,15 @@ int                oiDBInit       ( oyStruct_s        * filter OY_UNUSED )
   int error = 0;
   return error;
 }
-int                oiDBReset      ( oyStruct_s        * filter OY_UNUSED ) { int error = 0; openiccLibRelease(); return error; }
+int                oiDBReset      ( oyStruct_s        * filter OY_UNUSED )
+{
+  int error = 0;
+  oiDBSnapshotLock_();
+  oiDBSnapshotInvalidate_();
+  oiDBSnapshotUnLock_();
+  openiccLibRelease();
+  return error;
+}
 
 const char*oiDBopeniccStaticMessageFunc (
                                        oyPointer           obj,
@@ -193,6 +193,11 @@ int  oyraInit                        ( oyStruct_s        * module_info OY_UNUSED
   m = oyraApi7ImageExposeCreate();
   oyCMMapi_SetNext( a, m ); a = m;
 
+  m = oyraApi4ImageLayoutCreate();
+  oyCMMapi_SetNext( a, m ); a = m;
+  m = oyraApi7ImageLayoutCreate();
+  oyCMMapi_SetNext( a, m ); a = m;
+
   m = oyraApi4ImageScaleCreate();
   oyCMMapi_SetNext( a, m ); a = m;
   m = oyraApi7ImageScaleCreate();
@@ -34,6 +34,13 @@
 #include <omp.h>
 #endif
 
+/* hint the compiler to vectorise the following sample loop */
+#if defined(_OPENMP) && defined(USE_OPENMP)
+#define OYRA_SIMD _Pragma("omp simd")
+#else
+#define OYRA_SIMD
+#endif
+
 /* --- internal definitions --- */
 
 #define CMM_NICK "oyra"
@@ -68,6 +75,17 @@ oyWIDGET_EVENT_e   oyraWidgetEvent   ( oyOptions_s       * options,
                                        oyStruct_s        * event );
 int      oyraFilterPlug_ImageRootRun ( oyFilterPlug_s    * requestor_plug,
                                        oyPixelAccess_s   * ticket );
+void     oyraLineToFloat             ( const uint8_t     * src,
+                                       oyDATATYPE_e        type,
+                                       int                 byteswap,
+                                       float             * dst,
+                                       size_t              count,
+                                       uint8_t           * tmp );
+void     oyraLineFromFloat           ( const float       * src,
+                                       oyDATATYPE_e        type,
+                                       int                 byteswap,
+                                       uint8_t           * dst,
+                                       size_t              count );
 
 extern oyDATATYPE_e  oyra_image_data_types[7];
 
@@ -91,6 +109,8 @@ oyCMMapi_s * oyraApi4ImageChannelCreate(void);
 oyCMMapi_s * oyraApi7ImageChannelCreate(void);
 oyCMMapi_s * oyraApi4ImageExposeCreate(void);
 oyCMMapi_s * oyraApi7ImageExposeCreate(void);
+oyCMMapi_s * oyraApi4ImageLayoutCreate(void);
+oyCMMapi_s * oyraApi7ImageLayoutCreate(void);
 extern oyCMMapi10_s_  oyra_api10_profile_graph2d_SaturationLine;
 
 #endif /* OYRANOS_CMM_OYRA_H */
@@ -44,6 +44,226 @@
 
 /* OY_IMAGE_CHANNEL_REGISTRATION ----------------------------------------------*/
 
+#define OYRA_CHANNEL_MAX ('z'-'a'+1)
+
+typedef struct oyraChannelMap_s oyraChannelMap_s;
+typedef void (*oyraChannelLine_f)    ( const uint8_t     * src,
+                                       uint8_t           * dst,
+                                       int                 n,
+                                       const oyraChannelMap_s * map );
+/* a channel map and its line kernel, selected once per run */
+struct oyraChannelMap_s {
+  int count;                           /**< written channels */
+  int channels_in;                     /**< source pixel stride */
+  int channels_out;                    /**< destination pixel stride */
+  int pos[OYRA_CHANNEL_MAX];           /**< source channel, -1 for fill */
+  double fill[OYRA_CHANNEL_MAX];       /**< fill values in the kernel output type */
+  oyraChannelLine_f line;              /**< the shuffle kernel */
+  oyDATATYPE_e type_in;                /**< source data type */
+  oyDATATYPE_e type_out;               /**< destination data type */
+  int byteswap_in;                     /**< source is not in host byte order */
+  int byteswap_out;                    /**< destination is not in host byte order */
+  int via_float;                       /**< convert through a float line */
+};
+
+/* Each output pixel is gathered completely before it is written. That
+ * keeps the kernels valid for in place shuffling with equal strides. */
+#define OYRA_CHANNEL_LINE( name, in_type, out_type, CONVERT, C ) \
+static void  name                    ( const uint8_t     * src_, \
+                                       uint8_t           * dst_, \
+                                       int                 n, \
+                                       const oyraChannelMap_s * map ) \
+{ \
+  const in_type * src = (const in_type*) src_; \
+  out_type * dst = (out_type*) dst_; \
+  const out_type * fill = (const out_type*) map->fill; \
+  int x, i, cin = map->channels_in, cout = map->channels_out, \
+      p[C], use_fill[C]; \
+  /* gather a valid sample for fill channels too, keeping the loop branch free */ \
+  for(i = 0; i < C; ++i) \
+  { \
+    use_fill[i] = map->pos[i] < 0; \
+    p[i] = use_fill[i] ? 0 : map->pos[i]; \
+  } \
+  OYRA_SIMD \
+  for(x = 0; x < n; ++x) \
+  { \
+    out_type v[C]; \
+    for(i = 0; i < C; ++i) \
+      v[i] = CONVERT( src[x*cin + p[i]] ); \
+    for(i = 0; i < C; ++i) \
+      dst[x*cout + i] = v[i]; \
+  } \
+  for(i = 0; i < C; ++i) \
+    if(use_fill[i]) \
+    { \
+      out_type f = fill[i]; \
+      OYRA_SIMD \
+      for(x = 0; x < n; ++x) \
+        dst[x*cout + i] = f; \
+    } \
+}
+
+/* kernels for one, three and four written channels plus a generic one */
+#define OYRA_CHANNEL_KERNELS( name, in_type, out_type, CONVERT ) \
+OYRA_CHANNEL_LINE( name ## 1_, in_type, out_type, CONVERT, 1 ) \
+OYRA_CHANNEL_LINE( name ## 3_, in_type, out_type, CONVERT, 3 ) \
+OYRA_CHANNEL_LINE( name ## 4_, in_type, out_type, CONVERT, 4 ) \
+static void  name ## N_              ( const uint8_t     * src_, \
+                                       uint8_t           * dst_, \
+                                       int                 n, \
+                                       const oyraChannelMap_s * map ) \
+{ \
+  const in_type * src = (const in_type*) src_; \
+  out_type * dst = (out_type*) dst_; \
+  const out_type * fill = (const out_type*) map->fill; \
+  const int * pos = map->pos; \
+  int x, i, cin = map->channels_in, cout = map->channels_out, \
+      count = map->count; \
+  for(x = 0; x < n; ++x) \
+  { \
+    out_type v[OYRA_CHANNEL_MAX]; \
+    for(i = 0; i < count; ++i) \
+      v[i] = pos[i] < 0 ? fill[i] : CONVERT( src[x*cin + pos[i]] ); \
+    for(i = 0; i < count; ++i) \
+      dst[x*cout + i] = v[i]; \
+  } \
+} \
+static const oyraChannelLine_f name ## s_[5] = { NULL, name ## 1_, NULL, \
+                                                 name ## 3_, name ## 4_ };
+
+#define OYRA_CHANNEL_COPY( v )      (v)
+#define OYRA_CHANNEL_U8_TO_U16( v ) ((uint16_t)((v) * 257))
+#define OYRA_CHANNEL_U16_TO_U8( v ) ((uint8_t)(((uint32_t)(v) * 255 + 32895) >> 16))
+#define OYRA_CHANNEL_U8_TO_F( v )   ((v) * (1.0f/255.0f))
+#define OYRA_CHANNEL_U16_TO_F( v )  ((v) * (1.0f/65535.0f))
+#define OYRA_CHANNEL_F_TO_U8( v )   ((uint8_t)((v) <= 0.0f ? 0.0f : (v) >= 1.0f ? 255.0f : (v) * 255.0f + 0.5f))
+#define OYRA_CHANNEL_F_TO_U16( v )  ((uint16_t)((v) <= 0.0f ? 0.0f : (v) >= 1.0f ? 65535.0f : (v) * 65535.0f + 0.5f))
+
+/* moving samples without conversion only depends on the sample size */
+OYRA_CHANNEL_KERNELS( oyraChannelCopy8, uint8_t, uint8_t, OYRA_CHANNEL_COPY )
+OYRA_CHANNEL_KERNELS( oyraChannelCopy16, uint16_t, uint16_t, OYRA_CHANNEL_COPY )
+OYRA_CHANNEL_KERNELS( oyraChannelCopy32, uint32_t, uint32_t, OYRA_CHANNEL_COPY )
+OYRA_CHANNEL_KERNELS( oyraChannelCopy64, uint64_t, uint64_t, OYRA_CHANNEL_COPY )
+/* fused data type changes */
+OYRA_CHANNEL_KERNELS( oyraChannelU8ToU16, uint8_t, uint16_t, OYRA_CHANNEL_U8_TO_U16 )
+OYRA_CHANNEL_KERNELS( oyraChannelU16ToU8, uint16_t, uint8_t, OYRA_CHANNEL_U16_TO_U8 )
+OYRA_CHANNEL_KERNELS( oyraChannelU8ToF, uint8_t, float, OYRA_CHANNEL_U8_TO_F )
+OYRA_CHANNEL_KERNELS( oyraChannelU16ToF, uint16_t, float, OYRA_CHANNEL_U16_TO_F )
+OYRA_CHANNEL_KERNELS( oyraChannelFToU8, float, uint8_t, OYRA_CHANNEL_F_TO_U8 )
+OYRA_CHANNEL_KERNELS( oyraChannelFToU16, float, uint16_t, OYRA_CHANNEL_F_TO_U16 )
+
+static oyraChannelLine_f oyraChannelSelect_ ( const oyraChannelLine_f * kernels,
+                                       oyraChannelLine_f   generic,
+                                       int                 count )
+{
+  if(count < 5 && kernels[count])
+    return kernels[count];
+  return generic;
+}
+
+/* select the kernel and encode the fill values for it */
+static void  oyraChannelMapSetup_    ( oyraChannelMap_s  * map,
+                                       const double      * fill )
+{
+  oyDATATYPE_e in = map->type_in,
+               out = map->type_out,
+               kernel_out = out;
+  int i, count = map->count,
+      swap = map->byteswap_in != map->byteswap_out;
+
+  map->via_float = 0;
+  map->line = NULL;
+
+  if(in == out && !swap)
+    switch(oyDataTypeGetSize( in ))
+    {
+      case 1: map->line = oyraChannelSelect_( oyraChannelCopy8s_, oyraChannelCopy8N_, count ); break;
+      case 2: map->line = oyraChannelSelect_( oyraChannelCopy16s_, oyraChannelCopy16N_, count ); break;
+      case 4: map->line = oyraChannelSelect_( oyraChannelCopy32s_, oyraChannelCopy32N_, count ); break;
+      case 8: map->line = oyraChannelSelect_( oyraChannelCopy64s_, oyraChannelCopy64N_, count ); break;
+    }
+  else if(!map->byteswap_in && !map->byteswap_out)
+  {
+    if(in == oyUINT8 && out == oyUINT16)
+      map->line = oyraChannelSelect_( oyraChannelU8ToU16s_, oyraChannelU8ToU16N_, count );
+    else if(in == oyUINT16 && out == oyUINT8)
+      map->line = oyraChannelSelect_( oyraChannelU16ToU8s_, oyraChannelU16ToU8N_, count );
+    else if(in == oyUINT8 && out == oyFLOAT)
+      map->line = oyraChannelSelect_( oyraChannelU8ToFs_, oyraChannelU8ToFN_, count );
+    else if(in == oyUINT16 && out == oyFLOAT)
+      map->line = oyraChannelSelect_( oyraChannelU16ToFs_, oyraChannelU16ToFN_, count );
+    else if(in == oyFLOAT && out == oyUINT8)
+      map->line = oyraChannelSelect_( oyraChannelFToU8s_, oyraChannelFToU8N_, count );
+    else if(in == oyFLOAT && out == oyUINT16)
+      map->line = oyraChannelSelect_( oyraChannelFToU16s_, oyraChannelFToU16N_, count );
+  }
+
+  /* all other combinations shuffle normalised float lines */
+  if(!map->line)
+  {
+    map->via_float = 1;
+    kernel_out = oyFLOAT;
+    map->line = oyraChannelSelect_( oyraChannelCopy32s_, oyraChannelCopy32N_, count );
+  }
+
+  for(i = 0; i < count; ++i)
+  {
+    double v = fill[i];
+    switch(kernel_out)
+    {
+      case oyUINT8:  ((uint8_t*)map->fill)[i] = OY_ROUND( v * 255 ); break;
+      case oyUINT16: ((uint16_t*)map->fill)[i] = OY_ROUND( v * 65535 ); break;
+      case oyUINT32: ((uint32_t*)map->fill)[i] = (uint32_t) OY_ROUND( v * UINT32_MAX ); break;
+      case oyHALF:   ((uint16_t*)map->fill)[i] = oyFloatToHalf( v ); break;
+      case oyFLOAT:  ((float*)map->fill)[i] = v; break;
+      case oyDOUBLE: map->fill[i] = v; break;
+    }
+  }
+}
+
+/* bytes needed by oyraChannelLine_() for n pixels */
+static size_t oyraChannelLineBufferSize_( const oyraChannelMap_s * map,
+                                       int                 n )
+{
+  int channels = OY_MAX( map->channels_in, map->channels_out );
+  if(!map->via_float)
+    return 0;
+  return (size_t)n * (sizeof(float) * (map->channels_in + map->channels_out) +
+                      sizeof(double) * channels);
+}
+
+/* shuffle one line */
+static void  oyraChannelLine_        ( const uint8_t     * src,
+                                       uint8_t           * dst,
+                                       int                 n,
+                                       const oyraChannelMap_s * map,
+                                       uint8_t           * tmp )
+{
+  if(!map->via_float)
+  {
+    map->line( src, dst, n, map );
+    return;
+  }
+
+  {
+    float * flt_in = (float*) tmp,
+          * flt_out = flt_in + n * map->channels_in;
+    uint8_t * swap = (uint8_t*)(flt_out + n * map->channels_out);
+    size_t count_out = (size_t)n * map->channels_out;
+
+    oyraLineToFloat( src, map->type_in, map->byteswap_in, flt_in,
+                     (size_t)n * map->channels_in, swap );
+    /* keep unwritten destination channels */
+    if(map->count < map->channels_out)
+      oyraLineToFloat( dst, map->type_out, map->byteswap_out, flt_out,
+                       count_out, swap );
+    map->line( (const uint8_t*)flt_in, (uint8_t*)flt_out, n, map );
+    oyraLineFromFloat( flt_out, map->type_out, map->byteswap_out, dst,
+                       count_out );
+  }
+}
+
 
 /** @brief   implement oyCMMFilter_GetNext_f()
  *
@@ -68,8 +288,12 @@
  *  Note: changing the channel count might require a new ICC profile for the
  *  output image. Please setup the graph accordingly.
  *
- *  @version Oyranos: 0.9.6
- *  @date    2016/04/04
+ *  A shuffle kernel is selected once per run by the channel count and the
+ *  data types. A input image with a different pixel layout is read through
+ *  a own ticket and the data type is changed while shuffling.
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2026/10/19
  *  @since   2016/04/04 (Oyranos: 0.9.6)
  */
 int      oyraFilter_ImageChannelRun  ( oyFilterPlug_s    * requestor_plug,
@@ -154,14 +378,16 @@ int      oyraFilter_ImageChannelRun  ( oyFilterPlug_s    * requestor_plug,
     if(channels_json && strlen(channels_json) > 2)
     {
       oyImage_s * output_image = oyPixelAccess_GetOutputImage( ticket );
+      oyImage_s * image_input = oyFilterPlug_ResolveImage( plug, socket, ticket );
       oyArray2d_s * a_dest = oyPixelAccess_GetArray( ticket );
-      int layout_src = oyImage_GetPixelLayout( image, oyLAYOUT );
+      int layout_src = oyImage_GetPixelLayout( image_input ? image_input : image,
+                                               oyLAYOUT );
       int layout_dst = oyImage_GetPixelLayout( output_image, oyLAYOUT );
       int channels_src = oyToChannels_m( layout_src );
       int channels_dst = oyToChannels_m( layout_dst );
       int ticket_array_pix_width;
       int count = oyjlValueCount( json ), i;
-      const int max_channels = 'z'-'a'+1;
+      const int max_channels = OYRA_CHANNEL_MAX;
       double  channel[max_channels+1];
       int channel_pos[max_channels+1];
 
@@ -207,123 +433,119 @@ int      oyraFilter_ImageChannelRun  ( oyFilterPlug_s    * requestor_plug,
 
       if(!error)
       {
-        int w,h,x,y, start_x,start_y, max_value = -1;
+        int w,h,y, start_x,start_y;
         oyRectangle_s * ticket_roi = oyPixelAccess_GetArrayROI( ticket );
         oyRectangle_s_  roi_= {oyOBJECT_RECTANGLE_S,0,0,0, 0,0,0,0};
         oyRectangle_s * roi = (oyRectangle_s*)&roi_;
-        oyArray2d_s * array_out;
-        uint8_t ** array_out_data;
+        oyPixelAccess_s * new_ticket = NULL;
+        oyArray2d_s * array_in = NULL,
+                    * array_out;
+        uint8_t ** array_in_data,
+                ** array_out_data;
         /* get pixel layout infos for copying */
-        oyDATATYPE_e data_type_out = oyToDataType_m( layout_dst );
-        int bps_out = oyDataTypeGetSize( data_type_out );
+        oyDATATYPE_e data_type_in = oyToDataType_m( layout_src ),
+                     data_type_out = oyToDataType_m( layout_dst );
+        int bps_in = oyDataTypeGetSize( data_type_in ),
+            bps_out = oyDataTypeGetSize( data_type_out );
+        oyraChannelMap_s map;
+        uint8_t * tmp = NULL;
+        size_t stride;
+        int threads_n =
+#if defined(_OPENMP) && defined(USE_OPENMP)
+                        omp_get_max_threads();
+#else
+                        1;
+#endif
 
-        /* get the source pixels */
-        result = oyFilterNode_Run( input_node, plug, ticket );
+        /* select the kernel once for all pixels */
+        memset( &map, 0, sizeof(map) );
+        map.count = count;
+        map.type_in = data_type_in;
+        map.type_out = data_type_out;
+        map.byteswap_in = bps_in > 1 && oyToByteswap_m( layout_src );
+        map.byteswap_out = bps_out > 1 && oyToByteswap_m( layout_dst );
+        for(i = 0; i < count; ++i)
+          map.pos[i] = channel_pos[i];
 
-        /* get the channel buffers */
         array_out = oyPixelAccess_GetArray( ticket );
-        array_out_data = oyArray2d_GetData( array_out );
-        w = oyArray2d_GetWidth( array_out ) / channels_dst;
-        h = oyArray2d_GetHeight( array_out );
-        switch(data_type_out)
+
+        if(layout_src == layout_dst)
+        {
+          /* shuffle in place */
+          result = oyFilterNode_Run( input_node, plug, ticket );
+          array_in = oyArray2d_Copy( array_out, 0 );
+          map.channels_in = channels_dst;
+        } else
         {
-        case oyUINT8:
-             max_value = 255;
-             break;
-        case oyUINT16:
-             max_value = 65535;
-             break;
-        case oyUINT32:
-             max_value = UINT32_MAX;
-             break;
-        case oyHALF:
-        case oyFLOAT:
-        case oyDOUBLE:
-             max_value = 1.0;
-             break;
+          /* obtain the source pixels in their own layout, like the layout node */
+          oyArray2d_s * a;
+          w = oyArray2d_GetDataGeo1( array_out, 2 ) / channels_dst;
+          h = oyArray2d_GetDataGeo1( array_out, 3 );
+
+          new_ticket = oyPixelAccess_Copy( ticket, ticket->oy_ );
+          oyPixelAccess_SetOutputImage( new_ticket, image_input );
+          oyPixelAccess_SetArray( new_ticket, 0, 0 );
+          a = oyArray2d_Create( NULL, w * channels_src, h, data_type_in,
+                                ticket->oy_ );
+          oyPixelAccess_SetArray( new_ticket, a, 0 );
+          oyArray2d_Release( &a );
+          oyPixelAccess_SynchroniseROI( new_ticket, ticket );
+
+          result = oyFilterNode_Run( input_node, plug, new_ticket );
+          array_in = oyPixelAccess_GetArray( new_ticket );
+          map.channels_in = channels_src;
         }
+        map.channels_out = channels_dst;
+        oyraChannelMapSetup_( &map, channel );
+
+        /* get the channel buffers */
+        array_in_data = oyArray2d_GetData( array_in );
+        array_out_data = oyArray2d_GetData( array_out );
+        w = OY_MIN( oyArray2d_GetWidth( array_in ) / map.channels_in,
+                    oyArray2d_GetWidth( array_out ) / channels_dst );
+        h = OY_MIN( oyArray2d_GetHeight( array_in ),
+                    oyArray2d_GetHeight( array_out ) );
 
         oyRectangle_SetByRectangle( roi, ticket_roi );
         oyRectangle_Scale( roi, ticket_array_pix_width );
         start_x = OY_ROUND(roi_.x);
         start_y = OY_ROUND(roi_.y);
+        if(start_x > w) start_x = w;
+
+        stride = oyraChannelLineBufferSize_( &map, w - start_x );
+        if(stride)
+          tmp = (uint8_t*) oyAllocateFunc_( stride * threads_n );
+        if(stride && !tmp)
+          result = 1;
 
         /* copy the channels */
+        if(result == 0)
+        {
 #if defined(USE_OPENMP)
-#pragma omp parallel for private(x,y,i)
+#pragma omp parallel for private(y)
 #endif
-        for(y = start_y; y < h; ++y)
-        {
-          for(x = start_x; x < w; ++x)
+          for(y = start_y; y < h; ++y)
           {
-            union u8421 { uint32_t u4; uint16_t u2; uint8_t u1; float f; double d; };
-            union u8421 cache[max_channels];
-            float flt;
-            uint32_t u4;
-            
-            /* fill the intermediate pixel cache;
-             * It is not known which channels are needed and in which order.
-             * Thus all channels are stored outside the main buffer.
-             */
-            for(i = 0; i < count; ++i)
-            {
-              int pos = (channel_pos[i] == -1) ? i : channel_pos[i];
-              switch(data_type_out)
-              {
-              case oyUINT8:
-                cache[i].u1 = (channel_pos[i] == -1) ? OY_ROUND(channel[i] * max_value) : array_out_data[y][x*channels_dst*bps_out + pos*bps_out];
-                break;
-              case oyUINT16:
-                cache[i].u2 = (channel_pos[i] == -1) ? OY_ROUND(channel[i] * max_value) : *((uint16_t*)&array_out_data[y][x*channels_dst*bps_out + pos*bps_out]);
-                break;
-              case oyUINT32:
-                cache[i].u4 = (channel_pos[i] == -1) ? (uint32_t) OY_ROUND(channel[i] * max_value) : *((uint32_t*)&array_out_data[y][x*channels_dst*bps_out + pos*bps_out]);
-                break;
-              case oyHALF:
-                flt = channel[i] * max_value;
-                memcpy( &u4, &flt, 4 );
-                cache[i].u2 = (channel_pos[i] == -1) ? OY_FLOAT2HALF(u4) : *((uint16_t*)&array_out_data[y][x*channels_dst*bps_out + pos*bps_out]);
-                break;
-              case oyFLOAT:
-                cache[i].f = (channel_pos[i] == -1) ? channel[i] * max_value : *((float*)&array_out_data[y][x*channels_dst*bps_out + pos*bps_out]);
-                break;
-              case oyDOUBLE:
-                cache[i].d = (channel_pos[i] == -1) ? channel[i] * max_value : *((double*)&array_out_data[y][x*channels_dst*bps_out + pos*bps_out]);
-                break;
-              }
-            }
-
-            /* read back all scattered channels */
-            for(i = 0; i < count; ++i)
-            {
-              int pos = i;
-              switch(data_type_out)
-              {
-              case oyUINT8:
-                array_out_data[y][x*channels_dst*bps_out + i*bps_out] = cache[pos].u1;
-                break;
-              case oyUINT16:
-                *((uint16_t*)&array_out_data[y][x*channels_dst*bps_out + i*bps_out]) = cache[pos].u2;
-                break;
-              case oyUINT32:
-                *((uint32_t*)&array_out_data[y][x*channels_dst*bps_out + i*bps_out]) = cache[pos].u4;
-                break;
-              case oyHALF:
-                 *((uint16_t*)&array_out_data[y][x*channels_dst*bps_out + i*bps_out]) = cache[pos].u2;
-                break;
-              case oyFLOAT:
-                *((float*)&array_out_data[y][x*channels_dst*bps_out + i*bps_out]) = cache[pos].f;
-                break;
-              case oyDOUBLE:
-                *((double*)&array_out_data[y][x*channels_dst*bps_out + i*bps_out]) = cache[pos].d;
-                break;
-              }
-            }
+            int index = 0;
+#if defined(_OPENMP) && defined(USE_OPENMP)
+            index = omp_get_thread_num();
+#endif
+            oyraChannelLine_( &array_in_data[y][start_x*map.channels_in*bps_in],
+                              &array_out_data[y][start_x*channels_dst*bps_out],
+                              w - start_x, &map,
+                              tmp ? &tmp[stride * index] : NULL );
           }
         }
 
+        if(tmp)
+          oyDeAllocateFunc_( tmp );
+        oyArray2d_Release( &array_in );
         oyArray2d_Release( &array_out );
+        oyPixelAccess_Release( &new_ticket );
+        oyRectangle_Release( &ticket_roi );
       }
+      oyArray2d_Release( &a_dest );
+      oyImage_Release( &image_input );
       oyImage_Release( &output_image );
     } else /* nothing to do */
       result = oyFilterNode_Run( input_node, plug, ticket );
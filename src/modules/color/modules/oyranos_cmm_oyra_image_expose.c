@@ -83,10 +83,115 @@ void     oySensibleClip ( double * c, icColorSpaceSignature sig, int range_max,
   }
 }
 
+/* precomputed exposure per color space */
+typedef struct {
+  int channels;                        /**< samples per pixel */
+  int hue;                             /**< keep the hue of the first three channels while clipping */
+  float gain[256];                     /**< factor per channel, 1.0 leaves the channel untouched */
+} oyraExposePlan_s;
+
+static void  oyraExposePlan_         ( oyraExposePlan_s  * plan,
+                                       icColorSpaceSignature sig,
+                                       int                 channels,
+                                       double              expose )
+{
+  int i;
+
+  plan->channels = channels;
+  plan->hue = 0;
+  for(i = 0; i < channels; ++i)
+    plan->gain[i] = expose;
+
+  if( (sig == icSigRgbData ||
+       sig == icSigXYZData ||
+       sig == icSigLabData ||
+       sig == icSigYCbCrData)
+      && channels >= 3)
+  {
+    /* only the first three channels are exposed, extra channels stay */
+    for(i = 3; i < channels; ++i)
+      plan->gain[i] = 1.0f;
+    /* oySensibleClip() touches only lightness for Lab and YCbCr */
+    if(sig == icSigLabData ||
+       sig == icSigYCbCrData)
+      plan->gain[1] = plan->gain[2] = 1.0f;
+    else
+      plan->hue = 1;
+  }
+}
+
+/* Vectorisable counterpart of oySensibleClip() for integer lines.
+ * The branches are replaced by selects: a pixel, which would exceed range_max,
+ * is linearly remapped from [min,max] to [min*expose,range_max]. */
+#define OYRA_EXPOSE_LINE_INT( name, type ) \
+static void  name                    ( type              * line, \
+                                       int                 count, \
+                                       const oyraExposePlan_s * plan, \
+                                       float               range_max ) \
+{ \
+  int x, i, ch = plan->channels; \
+  if(plan->hue) \
+  { \
+    float e = plan->gain[0]; \
+    OYRA_SIMD \
+    for(x = 0; x < count; ++x) \
+    { \
+      type * p = &line[x*ch]; \
+      float r = p[0], g = p[1], b = p[2], \
+            mx = r > g ? (r > b ? r : b) : (g > b ? g : b), \
+            mn = r < g ? (r < b ? r : b) : (g < b ? g : b), \
+            emin = mn * e, \
+            range = mx > mn ? (range_max - emin) / (mx - mn) : 0.0f; \
+      int over = mx * e > range_max; \
+      float vr = over ? emin + (r - mn) * range + 0.5f : r * e, \
+            vg = over ? emin + (g - mn) * range + 0.5f : g * e, \
+            vb = over ? emin + (b - mn) * range + 0.5f : b * e; \
+      p[0] = vr < range_max ? vr : range_max; \
+      p[1] = vg < range_max ? vg : range_max; \
+      p[2] = vb < range_max ? vb : range_max; \
+    } \
+  } \
+  else \
+  for(i = 0; i < ch; ++i) \
+  { \
+    float e = plan->gain[i]; \
+    if(e == 1.0f) continue; \
+    OYRA_SIMD \
+    for(x = 0; x < count; ++x) \
+    { \
+      float v = line[x*ch + i] * e; \
+      line[x*ch + i] = v < range_max ? v : range_max; \
+    } \
+  } \
+}
+OYRA_EXPOSE_LINE_INT( oyraExposeLineU8_, uint8_t )
+OYRA_EXPOSE_LINE_INT( oyraExposeLineU16_, uint16_t )
+
+/* Floating point samples are scaled without clipping. That matches the
+ * scalar path, which compares normalised samples as integers. */
+static void  oyraExposeLineFloat_    ( float             * line,
+                                       int                 count,
+                                       const oyraExposePlan_s * plan )
+{
+  int x, i, ch = plan->channels;
+
+  for(i = 0; i < ch; ++i)
+  {
+    float e = plan->gain[i];
+    if(e == 1.0f) continue;
+    OYRA_SIMD
+    for(x = 0; x < count; ++x)
+      line[x*ch + i] *= e;
+  }
+}
+
 /** @brief   implement oyCMMFilter_GetNext_f()
  *
- *  @version Oyranos: 0.9.6
- *  @date    2016/04/04
+ *  uint8, uint16, half and float lines are exposed by vectorised kernels
+ *  with per color space gains. Other data types use oySensibleClip().
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2026/10/19
  *  @since   2013/06/10 (Oyranos: 0.9.5)
  */
 int      oyraFilter_ImageExposeRun   ( oyFilterPlug_s    * requestor_plug,
@@ -171,6 +276,14 @@ int      oyraFilter_ImageExposeRun   ( oyFilterPlug_s    * requestor_plug,
         /* get pixel layout infos for copying */
         oyDATATYPE_e data_type_out = oyToDataType_m( layout_dst );
         int bps_out = oyDataTypeGetSize( data_type_out );
+        float * half_lines = NULL;
+        oyraExposePlan_s plan;
+        int threads_n =
+#if defined(_OPENMP) && defined(USE_OPENMP)
+                        omp_get_max_threads();
+#else
+                        1;
+#endif
 
         /* get the source pixels */
         result = oyFilterNode_Run( input_node, plug, ticket );
@@ -185,6 +298,16 @@ int      oyraFilter_ImageExposeRun   ( oyFilterPlug_s    * requestor_plug,
         start_x = OY_ROUND(roi_.x);
         start_y = OY_ROUND(roi_.y);
 
+        if(data_type_out == oyHALF)
+        {
+          half_lines = (float*) oyAllocateFunc_( sizeof(float) * w * channels_dst * threads_n );
+          /* without line buffers halves are exposed sample by sample */
+          if(!half_lines)
+            WARNc_S( "no half float line buffers; using scalar path" );
+        }
+
+        oyraExposePlan_( &plan, sig, channels_dst, expose );
+
         switch(data_type_out)
         {
           case oyUINT8: max = 255; break;
@@ -199,6 +322,47 @@ int      oyraFilter_ImageExposeRun   ( oyFilterPlug_s    * requestor_plug,
 #endif
         for(y = start_y; y < h; ++y)
         {
+          uint8_t * line = array_out_data[y];
+          oyDATATYPE_e data_type = data_type_out;
+          int bps = bps_out;
+          float * line_flt = NULL;
+
+          /* process half floats as float line, which avoids a float image */
+          if(data_type_out == oyHALF && half_lines)
+          {
+            int index = 0;
+#if defined(_OPENMP) && defined(USE_OPENMP)
+            index = omp_get_thread_num();
+#endif
+            line_flt = &half_lines[index * w * channels_dst];
+            oyHalfToFloatLine( (const uint16_t*)array_out_data[y], line_flt,
+                               w * channels_dst );
+            line = (uint8_t*) line_flt;
+            data_type = oyFLOAT;
+            bps = 4;
+          }
+
+          /* vectorised kernels */
+          if(data_type == oyUINT8 || data_type == oyUINT16 ||
+             data_type == oyFLOAT)
+          {
+            uint8_t * pixels = &line[start_x*channels_dst*bps];
+            int count = w - start_x > 0 ? w - start_x : 0;
+
+            if(data_type == oyUINT8)
+              oyraExposeLineU8_( pixels, count, &plan, max );
+            else if(data_type == oyUINT16)
+            {
+              if(byte_swap)
+                oyByteSwap( pixels, 2, count * channels_dst );
+              oyraExposeLineU16_( (uint16_t*)pixels, count, &plan, max );
+              if(byte_swap)
+                oyByteSwap( pixels, 2, count * channels_dst );
+            }
+            else
+              oyraExposeLineFloat_( (float*)pixels, count, &plan );
+          }
+          else
           for(x = start_x; x < w; ++x)
           {
             if( (sig == icSigRgbData ||
@@ -211,35 +375,34 @@ int      oyraFilter_ImageExposeRun   ( oyFilterPlug_s    * requestor_plug,
 
               for(i = 0; i < 3; ++i)
               {
-                switch(data_type_out)
+                switch(data_type)
                 {
                 case oyUINT8:
-                  rgb[i] = array_out_data[y][x*channels_dst*bps_out + i*bps_out];
+                  rgb[i] = line[x*channels_dst*bps + i*bps];
                   break;
                 case oyUINT16:
                   {
-                  uint16_t v = *((uint16_t*)&array_out_data[y][x*channels_dst*bps_out + i*bps_out]);
+                  uint16_t v = *((uint16_t*)&line[x*channels_dst*bps + i*bps]);
                   if(byte_swap) v = oyByteSwapUInt16(v);
                   rgb[i] = v;
                   }
                   break;
                 case oyUINT32:
                   {
-                  uint32_t v = *((uint32_t*)&array_out_data[y][x*channels_dst*bps_out + i*bps_out]);
+                  uint32_t v = *((uint32_t*)&line[x*channels_dst*bps + i*bps]);
                   if(byte_swap) v = oyByteSwapUInt32(v);
                   rgb[i] = v;
                   }
                   break;
-                case oyHALF:
-                  v = *((uint16_t*)&array_out_data[y][x*channels_dst*bps_out + i*bps_out]);
-                  rgb[i] = v;
+                case oyHALF: /* usually processed as oyFLOAT line */
+                  rgb[i] = oyHalfToFloat( *((uint16_t*)&line[x*channels_dst*bps + i*bps]) );
                   break;
                 case oyFLOAT:
-                  v = *((float*)&array_out_data[y][x*channels_dst*bps_out + i*bps_out]);
+                  v = *((float*)&line[x*channels_dst*bps + i*bps]);
                   rgb[i] = v;
                   break;
                 case oyDOUBLE:
-                  v = *((double*)&array_out_data[y][x*channels_dst*bps_out + i*bps_out]);
+                  v = *((double*)&line[x*channels_dst*bps + i*bps]);
                   rgb[i] = v;
                   break;
                 }
@@ -250,29 +413,29 @@ int      oyraFilter_ImageExposeRun   ( oyFilterPlug_s    * requestor_plug,
               for(i = 0; i < 3; ++i)
               {
                 v = rgb[i];
-                switch(data_type_out)
+                switch(data_type)
                 {
                 case oyUINT8:
-                  array_out_data[y][x*channels_dst*bps_out + i*bps_out] = v;
+                  line[x*channels_dst*bps + i*bps] = v;
                   break;
                 case oyUINT16:
                   { uint16_t u16 = v;
-                  *((uint16_t*)&array_out_data[y][x*channels_dst*bps_out + i*bps_out]) = byte_swap ? oyByteSwapUInt16(u16) : u16;
+                  *((uint16_t*)&line[x*channels_dst*bps + i*bps]) = byte_swap ? oyByteSwapUInt16(u16) : u16;
                   }
                   break;
                 case oyUINT32:
                   { uint32_t u32 = v;
-                  *((uint32_t*)&array_out_data[y][x*channels_dst*bps_out + i*bps_out]) = byte_swap ? oyByteSwapUInt16(u32) : u32;
+                  *((uint32_t*)&line[x*channels_dst*bps + i*bps]) = byte_swap ? oyByteSwapUInt16(u32) : u32;
                   }
                   break;
-                case oyHALF:
-                  *((uint16_t*)&array_out_data[y][x*channels_dst*bps_out + i*bps_out]) = v;
+                case oyHALF: /* usually processed as oyFLOAT line */
+                  *((uint16_t*)&line[x*channels_dst*bps + i*bps]) = oyFloatToHalf( v );
                   break;
                 case oyFLOAT:
-                  *((float*)&array_out_data[y][x*channels_dst*bps_out + i*bps_out]) = v;
+                  *((float*)&line[x*channels_dst*bps + i*bps]) = v;
                   break;
                 case oyDOUBLE:
-                  *((double*)&array_out_data[y][x*channels_dst*bps_out + i*bps_out]) = v;
+                  *((double*)&line[x*channels_dst*bps + i*bps]) = v;
                   break;
                 }
               }
@@ -281,37 +444,45 @@ int      oyraFilter_ImageExposeRun   ( oyFilterPlug_s    * requestor_plug,
             for(i = 0; i < channels_dst; ++i)
             {
               int v;
-              switch(data_type_out)
+              switch(data_type)
               {
               case oyUINT8:
-                v = array_out_data[y][x*channels_dst*bps_out + i*bps_out] * expose;
+                v = line[x*channels_dst*bps + i*bps] * expose;
                 if(v > 255) v = 255;
-                array_out_data[y][x*channels_dst*bps_out + i*bps_out] = v;
+                line[x*channels_dst*bps + i*bps] = v;
                 break;
               case oyUINT16:
-                v = *((uint16_t*)&array_out_data[y][x*channels_dst*bps_out + i*bps_out]);
+                v = *((uint16_t*)&line[x*channels_dst*bps + i*bps]);
                 if(byte_swap) v = oyByteSwapUInt16(v);
                 v *= expose;
                 if(v > 65535) v = 65535;
-                *((uint16_t*)&array_out_data[y][x*channels_dst*bps_out + i*bps_out]) = byte_swap ? oyByteSwapUInt16(v) : v;
+                *((uint16_t*)&line[x*channels_dst*bps + i*bps]) = byte_swap ? oyByteSwapUInt16(v) : v;
                 break;
               case oyUINT32:
-                *((uint32_t*)&array_out_data[y][x*channels_dst*bps_out + i*bps_out]) *= expose;
+                *((uint32_t*)&line[x*channels_dst*bps + i*bps]) *= expose;
                 break;
-              case oyHALF:
-                 *((uint16_t*)&array_out_data[y][x*channels_dst*bps_out + i*bps_out]) *= expose;
+              case oyHALF: /* usually processed as oyFLOAT line */
+                { uint16_t * h16 = (uint16_t*)&line[x*channels_dst*bps + i*bps];
+                *h16 = oyFloatToHalf( oyHalfToFloat( *h16 ) * expose );
+                }
                 break;
               case oyFLOAT:
-                *((float*)&array_out_data[y][x*channels_dst*bps_out + i*bps_out]) *= expose;
+                *((float*)&line[x*channels_dst*bps + i*bps]) *= expose;
                 break;
               case oyDOUBLE:
-                *((double*)&array_out_data[y][x*channels_dst*bps_out + i*bps_out]) *= expose;
+                *((double*)&line[x*channels_dst*bps + i*bps]) *= expose;
                 break;
               }
             }
           }
+
+          if(line_flt)
+            oyFloatToHalfLine( line_flt, (uint16_t*)array_out_data[y],
+                               w * channels_dst );
         }
 
+        if(half_lines)
+          oyDeAllocateFunc_( half_lines );
       }
 
       oyArray2d_Release( &array_out );
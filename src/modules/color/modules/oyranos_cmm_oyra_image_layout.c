@@ -0,0 +1,848 @@
+/** @file oyranos_cmm_oyra_image_layout.c
+ *
+ *  Oyranos is an open source Color Management System
+ *
+ *  @par Copyright:
+ *            2026 (C) Kai-Uwe Behrmann
+ *
+ *  @brief    pixel layout module for Oyranos
+ *  @internal
+ *  @author   Kai-Uwe Behrmann <ku.b@gmx.de>
+ *  @par License:
+ *            new BSD <http://www.opensource.org/licenses/BSD-3-Clause>
+ *  @since    2026/10/19
+ */
+
+#include "oyCMMapi4_s.h"
+#include "oyCMMapi7_s.h"
+#include "oyCMMui_s.h"
+#include "oyConnectorImaging_s.h"
+#include "oyPixelAccess_s.h"
+
+#include "oyranos_cmm.h"
+#include "oyranos_cmm_oyra.h"
+#include "oyranos_helper.h"
+#include "oyranos_i18n.h"
+#include "oyranos_string.h"
+
+#include <math.h>
+#include <stdarg.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#ifdef HAVE_POSIX
+#include <stdint.h>  /* UINT32_MAX */
+#endif
+
+/* OY_IMAGE_LAYOUT_REGISTRATION */
+
+#define OYRA_LAYOUT_MAX_CHANNELS 255
+
+/** @internal
+ *  @brief   precomputed pixel layout conversion
+ *
+ *  The plan is computed once per run and describes each sample position
+ *  as base + pixel * x_stride + channel * c_stride. For interwoven lines
+ *  x_stride is the channel count; planar lines contain one plane per
+ *  channel with the pixel width of their own array line as c_stride. The
+ *  input and output arrays can differ in width; only the common pixels are
+ *  converted.
+ */
+typedef struct {
+  oyDATATYPE_e     type_in;
+  oyDATATYPE_e     type_out;
+  int              channels_in;
+  int              channels_out;
+  int              bps_in;
+  int              bps_out;
+  int              planar_in;
+  int              planar_out;
+  int              plane_in;           /**< samples between input planes, 1 for interwoven */
+  int              plane_out;          /**< samples between output planes, 1 for interwoven */
+  int              byteswap_in;
+  int              byteswap_out;
+  int              map[OYRA_LAYOUT_MAX_CHANNELS]; /**< output -> input channel, -1 for fill */
+  int              identity;           /**< map is 0,1,2,...; planar flags match */
+  int              alpha;              /**< input channel of alpha or -1 */
+  int              premultiply;        /**< 1 premultiply, -1 unpremultiply, 0 keep */
+  int              colors_n;
+  int              color_in[OYRA_LAYOUT_MAX_CHANNELS]; /**< input colour channels */
+} oyraLayoutPlan_s;
+
+/* get the channel positions of a pixel layout in a semantic order:
+ * first the color channels, then the extra channels */
+static void oyraLayoutSemanticOrder_ ( oyPixel_t           layout,
+                                       int                 colors_n,
+                                       int               * order )
+{
+  int channels_n = oyToChannels_m( layout ),
+      coff = oyToColorOffset_m( layout ),
+      swap = oyToSwapColorChannels_m( layout ),
+      i, n = colors_n;
+
+  if(coff + colors_n > channels_n)
+    coff = 0;
+
+  for(i = 0; i < colors_n; ++i)
+    order[i] = swap ? coff + colors_n - i - 1 : coff + i;
+  for(i = 0; i < channels_n; ++i)
+    if(i < coff || i >= coff + colors_n)
+      order[n++] = i;
+}
+
+static int oyraLayoutPlan_           ( oyraLayoutPlan_s  * plan,
+                                       oyImage_s         * image_in,
+                                       oyImage_s         * image_out,
+                                       const char        * alpha_mode )
+{
+  oyPixel_t layout_in = oyImage_GetPixelLayout( image_in, oyLAYOUT ),
+            layout_out = oyImage_GetPixelLayout( image_out, oyLAYOUT );
+  oyProfile_s * p = oyImage_GetProfile( image_in );
+  int order_in[OYRA_LAYOUT_MAX_CHANNELS],
+      order_out[OYRA_LAYOUT_MAX_CHANNELS];
+  int i, premultiplied_in = 0, premultiplied_out = 0;
+
+  memset( plan, 0, sizeof(oyraLayoutPlan_s) );
+  plan->colors_n = oyProfile_GetChannelsCount( p );
+  oyProfile_Release( &p );
+
+  plan->type_in = oyToDataType_m( layout_in );
+  plan->type_out = oyToDataType_m( layout_out );
+  plan->channels_in = oyToChannels_m( layout_in );
+  plan->channels_out = oyToChannels_m( layout_out );
+  plan->bps_in = oyDataTypeGetSize( plan->type_in );
+  plan->bps_out = oyDataTypeGetSize( plan->type_out );
+  plan->planar_in = oyToPlanar_m( layout_in );
+  plan->planar_out = oyToPlanar_m( layout_out );
+  plan->byteswap_in = plan->bps_in > 1 && oyToByteswap_m( layout_in );
+  plan->byteswap_out = plan->bps_out > 1 && oyToByteswap_m( layout_out );
+
+  if(plan->channels_in <= 0 || plan->channels_out <= 0 ||
+     plan->channels_in > OYRA_LAYOUT_MAX_CHANNELS ||
+     plan->channels_out > OYRA_LAYOUT_MAX_CHANNELS ||
+     !plan->bps_in || !plan->bps_out ||
+     plan->colors_n > plan->channels_in || plan->colors_n > plan->channels_out)
+    return 1;
+
+  oyraLayoutSemanticOrder_( layout_in, plan->colors_n, order_in );
+  oyraLayoutSemanticOrder_( layout_out, plan->colors_n, order_out );
+
+  /* output channel -> input channel, missing extra channels are filled */
+  for(i = 0; i < plan->channels_out; ++i)
+    plan->map[order_out[i]] = i < plan->channels_in ? order_in[i] : -1;
+  for(i = 0; i < plan->colors_n; ++i)
+    plan->color_in[i] = order_in[i];
+
+  plan->identity = plan->channels_in == plan->channels_out &&
+                   plan->planar_in == plan->planar_out;
+  for(i = 0; i < plan->channels_out && plan->identity; ++i)
+    if(plan->map[i] != i)
+      plan->identity = 0;
+
+  /* alpha is the first extra channel, if not explicitely typed */
+  plan->alpha = -1;
+  for(i = 0; i < plan->channels_in; ++i)
+  {
+    oyCHANNELTYPE_e type = oyImage_GetChannelType( image_in, i );
+    if(type == oyCHANNELTYPE_ALPHA1 && plan->alpha < 0)
+      plan->alpha = i;
+    if(type == oyCHANNELTYPE_COLOR_LIGHTNESS_PREMULTIPLIED)
+      premultiplied_in = 1;
+  }
+  for(i = 0; i < plan->channels_out; ++i)
+    if(oyImage_GetChannelType( image_out, i ) == oyCHANNELTYPE_COLOR_LIGHTNESS_PREMULTIPLIED)
+      premultiplied_out = 1;
+  if(plan->alpha < 0 && plan->channels_in > plan->colors_n)
+    plan->alpha = order_in[plan->colors_n];
+
+  if(alpha_mode && strcmp(alpha_mode, "premultiply") == 0)
+    plan->premultiply = 1;
+  else if(alpha_mode && strcmp(alpha_mode, "unpremultiply") == 0)
+    plan->premultiply = -1;
+  else
+    plan->premultiply = premultiplied_out - premultiplied_in;
+
+  if(plan->alpha < 0)
+    plan->premultiply = 0;
+
+  return 0;
+}
+
+/** @brief   unpack samples into normalised floats
+ *
+ *  Integers are scaled to 0.0 - 1.0. Samples keep their memory order.
+ *
+ *  @param[in]     src                 the samples
+ *  @param[in]     type                sample data type
+ *  @param[in]     byteswap            src is not in host byte order
+ *  @param[out]    dst                 count floats
+ *  @param[in]     count               number of samples
+ *  @param         tmp                 count samples for byte swapping
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2026/10/19
+ *  @since   2026/10/19 (Oyranos: 0.9.7)
+ */
+void     oyraLineToFloat             ( const uint8_t     * src,
+                                       oyDATATYPE_e        type,
+                                       int                 byteswap,
+                                       float             * dst,
+                                       size_t              count,
+                                       uint8_t           * tmp )
+{
+  size_t i;
+
+  if(byteswap)
+  {
+    memcpy( tmp, src, count * oyDataTypeGetSize( type ) );
+    oyByteSwap( tmp, oyDataTypeGetSize( type ), count );
+    src = tmp;
+  }
+
+  switch(type)
+  {
+    case oyUINT8:
+    {
+      const float f = 1.0f / 255.0f;
+      OYRA_SIMD
+      for(i = 0; i < count; ++i)
+        dst[i] = src[i] * f;
+    }
+    break;
+    case oyUINT16:
+    {
+      const uint16_t * u16 = (const uint16_t*) src;
+      const float f = 1.0f / 65535.0f;
+      OYRA_SIMD
+      for(i = 0; i < count; ++i)
+        dst[i] = u16[i] * f;
+    }
+    break;
+    case oyUINT32:
+    {
+      const uint32_t * u32 = (const uint32_t*) src;
+      const double f = 1.0 / UINT32_MAX;
+      for(i = 0; i < count; ++i)
+        dst[i] = u32[i] * f;
+    }
+    break;
+    case oyHALF:
+      oyHalfToFloatLine( (const uint16_t*) src, dst, count );
+    break;
+    case oyFLOAT:
+      memcpy( dst, src, count * sizeof(float) );
+    break;
+    case oyDOUBLE:
+    {
+      const double * d = (const double*) src;
+      OYRA_SIMD
+      for(i = 0; i < count; ++i)
+        dst[i] = d[i];
+    }
+    break;
+  }
+}
+
+/** @brief   pack normalised floats into samples
+ *
+ *  The inverse of oyraLineToFloat(). Integers are rounded and clipped.
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2026/10/19
+ *  @since   2026/10/19 (Oyranos: 0.9.7)
+ */
+void     oyraLineFromFloat           ( const float       * src,
+                                       oyDATATYPE_e        type,
+                                       int                 byteswap,
+                                       uint8_t           * dst,
+                                       size_t              count )
+{
+  size_t i;
+
+  switch(type)
+  {
+    case oyUINT8:
+    {
+      OYRA_SIMD
+      for(i = 0; i < count; ++i)
+      {
+        float v = src[i] * 255.0f + 0.5f;
+        v = v < 0.0f ? 0.0f : v > 255.0f ? 255.0f : v;
+        dst[i] = (uint8_t) v;
+      }
+    }
+    break;
+    case oyUINT16:
+    {
+      uint16_t * u16 = (uint16_t*) dst;
+      OYRA_SIMD
+      for(i = 0; i < count; ++i)
+      {
+        float v = src[i] * 65535.0f + 0.5f;
+        v = v < 0.0f ? 0.0f : v > 65535.0f ? 65535.0f : v;
+        u16[i] = (uint16_t) v;
+      }
+    }
+    break;
+    case oyUINT32:
+    {
+      uint32_t * u32 = (uint32_t*) dst;
+      for(i = 0; i < count; ++i)
+      {
+        double v = src[i] * (double)UINT32_MAX + 0.5;
+        v = v < 0.0 ? 0.0 : v > UINT32_MAX ? UINT32_MAX : v;
+        u32[i] = (uint32_t) v;
+      }
+    }
+    break;
+    case oyHALF:
+      oyFloatToHalfLine( src, (uint16_t*) dst, count );
+    break;
+    case oyFLOAT:
+      memcpy( dst, src, count * sizeof(float) );
+    break;
+    case oyDOUBLE:
+    {
+      double * d = (double*) dst;
+      OYRA_SIMD
+      for(i = 0; i < count; ++i)
+        d[i] = src[i];
+    }
+    break;
+  }
+
+  if(byteswap)
+    oyByteSwap( dst, oyDataTypeGetSize( type ), count );
+}
+
+/* reorder samples of n pixels; works for any sample type T;
+ * sc_ and dc_ are the plane distances of src_ and dst_ */
+#define OYRA_LAYOUT_SWIZZLE( T, src_, dst_, n, sc_, dc_, plan ) \
+{ \
+  const T * s_ = (const T*)(src_); \
+  T * d_ = (T*)(dst_); \
+  int sx = (plan)->planar_in ? 1 : (plan)->channels_in, \
+      s_c = (sc_), \
+      dx = (plan)->planar_out ? 1 : (plan)->channels_out, \
+      d_c = (dc_), \
+      c_, x_; \
+  for(c_ = 0; c_ < (plan)->channels_out; ++c_) \
+  { \
+    T * dp = d_ + c_ * d_c; \
+    if((plan)->map[c_] < 0) \
+    { \
+      OYRA_SIMD \
+      for(x_ = 0; x_ < (int)(n); ++x_) \
+        dp[x_ * dx] = fill; \
+    } else \
+    { \
+      const T * sp = s_ + (plan)->map[c_] * s_c; \
+      OYRA_SIMD \
+      for(x_ = 0; x_ < (int)(n); ++x_) \
+        dp[x_ * dx] = sp[x_ * sx]; \
+    } \
+  } \
+}
+
+/* same type reordering without value conversion */
+static void oyraLayoutSwizzleLine_   ( const uint8_t     * src,
+                                       uint8_t           * dst,
+                                       int                 n,
+                                       oyraLayoutPlan_s  * plan )
+{
+  int sc = plan->plane_in,
+      dc = plan->plane_out;
+
+  switch(plan->bps_in)
+  {
+    case 1: { uint8_t fill = 0xff; OYRA_LAYOUT_SWIZZLE( uint8_t, src, dst, n, sc, dc, plan ) } break;
+    case 2:
+    {
+      uint16_t fill = plan->type_in == oyHALF ? oyFloatToHalf( 1.0f ) : 0xffff;
+      if(plan->byteswap_out) oyByteSwap( &fill, sizeof(fill), 1 );
+      OYRA_LAYOUT_SWIZZLE( uint16_t, src, dst, n, sc, dc, plan )
+    }
+    break;
+    case 4:
+    {
+      uint32_t fill = UINT32_MAX;
+      float one = 1.0f;
+      if(plan->type_in == oyFLOAT) memcpy( &fill, &one, sizeof(fill) );
+      if(plan->byteswap_out) oyByteSwap( &fill, sizeof(fill), 1 );
+      OYRA_LAYOUT_SWIZZLE( uint32_t, src, dst, n, sc, dc, plan )
+    }
+    break;
+    case 8:
+    {
+      uint64_t fill;
+      double one = 1.0;
+      memcpy( &fill, &one, sizeof(fill) );
+      if(plan->byteswap_out) oyByteSwap( &fill, sizeof(fill), 1 );
+      OYRA_LAYOUT_SWIZZLE( uint64_t, src, dst, n, sc, dc, plan )
+    }
+    break;
+  }
+}
+
+/* direct integer paths between 8-bit and 16-bit samples in host order */
+static void oyraLayoutU8ToU16Line_   ( const uint8_t     * src,
+                                       uint16_t          * dst,
+                                       int                 n,
+                                       oyraLayoutPlan_s  * plan )
+{
+  int sx = plan->planar_in ? 1 : plan->channels_in,
+      sc = plan->plane_in,
+      dx = plan->planar_out ? 1 : plan->channels_out,
+      dc = plan->plane_out,
+      c, x;
+  for(c = 0; c < plan->channels_out; ++c)
+  {
+    uint16_t * dp = dst + c * dc;
+    if(plan->map[c] < 0)
+    {
+      OYRA_SIMD
+      for(x = 0; x < n; ++x)
+        dp[x * dx] = 0xffff;
+    } else
+    {
+      const uint8_t * sp = src + plan->map[c] * sc;
+      OYRA_SIMD
+      for(x = 0; x < n; ++x)
+        dp[x * dx] = sp[x * sx] * 257;
+    }
+  }
+}
+static void oyraLayoutU16ToU8Line_   ( const uint16_t    * src,
+                                       uint8_t           * dst,
+                                       int                 n,
+                                       oyraLayoutPlan_s  * plan )
+{
+  int sx = plan->planar_in ? 1 : plan->channels_in,
+      sc = plan->plane_in,
+      dx = plan->planar_out ? 1 : plan->channels_out,
+      dc = plan->plane_out,
+      c, x;
+  for(c = 0; c < plan->channels_out; ++c)
+  {
+    uint8_t * dp = dst + c * dc;
+    if(plan->map[c] < 0)
+    {
+      OYRA_SIMD
+      for(x = 0; x < n; ++x)
+        dp[x * dx] = 0xff;
+    } else
+    {
+      const uint16_t * sp = src + plan->map[c] * sc;
+      /* exact rounding of v / 257 */
+      OYRA_SIMD
+      for(x = 0; x < n; ++x)
+        dp[x * dx] = (sp[x * sx] * 255u + 32895u) >> 16;
+    }
+  }
+}
+
+/* apply alpha to normalised input samples in input memory order,
+ * planes are sc samples apart */
+static void oyraLayoutAlphaLine_     ( float             * line,
+                                       int                 n,
+                                       int                 sc,
+                                       oyraLayoutPlan_s  * plan )
+{
+  int sx = plan->planar_in ? 1 : plan->channels_in,
+      i, x;
+  const float * a = line + plan->alpha * sc;
+
+  for(i = 0; i < plan->colors_n; ++i)
+  {
+    float * c = line + plan->color_in[i] * sc;
+    if(plan->premultiply > 0)
+    {
+      OYRA_SIMD
+      for(x = 0; x < n; ++x)
+        c[x * sx] *= a[x * sx];
+    } else
+    {
+      OYRA_SIMD
+      for(x = 0; x < n; ++x)
+        c[x * sx] = a[x * sx] > 0.0f ? c[x * sx] / a[x * sx] : 0.0f;
+    }
+  }
+}
+
+/** @internal
+ *  @brief   convert one line of n pixels
+ *
+ *  @param[in]     src                 input line
+ *  @param[out]    dst                 output line
+ *  @param[in]     n                   pixel count
+ *  @param[in]     plan                the precomputed conversion
+ *  @param         tmp                 thread local buffer of oyraLayoutLineBufferSize_()
+ */
+static void oyraLayoutLine_          ( const uint8_t     * src,
+                                       uint8_t           * dst,
+                                       int                 n,
+                                       oyraLayoutPlan_s  * plan,
+                                       uint8_t           * tmp )
+{
+  size_t count_in = (size_t)n * plan->channels_in,
+         count_out = (size_t)n * plan->channels_out;
+  float * flt_in, * flt_out;
+  int c;
+
+  if(!plan->premultiply &&
+     plan->type_in == plan->type_out &&
+     plan->byteswap_in == plan->byteswap_out)
+  {
+    if(plan->identity && !plan->planar_out)
+      memcpy( dst, src, count_out * plan->bps_out );
+    else if(plan->identity)
+      for(c = 0; c < plan->channels_out; ++c)
+        memcpy( dst + (size_t)c * plan->plane_out * plan->bps_out,
+                src + (size_t)c * plan->plane_in * plan->bps_in,
+                (size_t)n * plan->bps_out );
+    else
+      oyraLayoutSwizzleLine_( src, dst, n, plan );
+    return;
+  }
+
+  if(!plan->premultiply && !plan->byteswap_in && !plan->byteswap_out)
+  {
+    if(plan->type_in == oyUINT8 && plan->type_out == oyUINT16)
+    {
+      oyraLayoutU8ToU16Line_( src, (uint16_t*)dst, n, plan );
+      return;
+    }
+    if(plan->type_in == oyUINT16 && plan->type_out == oyUINT8)
+    {
+      oyraLayoutU16ToU8Line_( (const uint16_t*)src, dst, n, plan );
+      return;
+    }
+  }
+
+  /* generic path over normalised floats; planes are packed to n samples */
+  flt_in = (float*) tmp;
+  flt_out = flt_in + count_in;
+  if(plan->planar_in)
+    for(c = 0; c < plan->channels_in; ++c)
+      oyraLineToFloat( src + (size_t)c * plan->plane_in * plan->bps_in,
+                       plan->type_in, plan->byteswap_in, flt_in + (size_t)c * n,
+                       n, (uint8_t*)(flt_out + count_out) );
+  else
+    oyraLineToFloat( src, plan->type_in, plan->byteswap_in, flt_in, count_in,
+                     (uint8_t*)(flt_out + count_out) );
+  if(plan->premultiply)
+    oyraLayoutAlphaLine_( flt_in, n, plan->planar_in ? n : 1, plan );
+  {
+    float fill = 1.0f;
+    OYRA_LAYOUT_SWIZZLE( float, flt_in, flt_out, n,
+                         plan->planar_in ? n : 1, plan->planar_out ? n : 1,
+                         plan )
+  }
+  if(plan->planar_out)
+    for(c = 0; c < plan->channels_out; ++c)
+      oyraLineFromFloat( flt_out + (size_t)c * n, plan->type_out,
+                         plan->byteswap_out,
+                         dst + (size_t)c * plan->plane_out * plan->bps_out, n );
+  else
+    oyraLineFromFloat( flt_out, plan->type_out, plan->byteswap_out, dst,
+                       count_out );
+}
+
+static size_t oyraLayoutLineBufferSize_(oyraLayoutPlan_s * plan,
+                                       int                 n )
+{
+  return (size_t)n * ( (plan->channels_in + plan->channels_out) * sizeof(float) +
+                       plan->channels_in * plan->bps_in );
+}
+
+/* OY_IMAGE_LAYOUT_REGISTRATION ----------------------------------------------*/
+
+
+/** @brief   implement oyCMMFilter_GetNext_f()
+ *
+ *  The filter converts from the pixel layout of the input image into the
+ *  pixel layout of the ticket output image. It handles data types,
+ *  channel order, color offsets, planar and interwoven lines, byte swapping
+ *  and premultiplied alpha.
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2026/10/19
+ *  @since   2026/10/19 (Oyranos: 0.9.7)
+ */
+int      oyraFilter_ImageLayoutRun   ( oyFilterPlug_s    * requestor_plug,
+                                       oyPixelAccess_s   * ticket )
+{
+  int result = 0;
+  oyFilterSocket_s * socket = oyFilterPlug_GetSocket( requestor_plug );
+  oyFilterNode_s * node = oyFilterSocket_GetNode( socket ),
+                 * input_node = oyFilterNode_GetPlugNode( node, 0 );
+  oyFilterPlug_s * plug = oyFilterNode_GetPlug( node, 0 );
+  oyImage_s * image_input = oyFilterPlug_ResolveImage( plug, socket, ticket ),
+            * image_output = oyPixelAccess_GetOutputImage( ticket );
+  oyOptions_s * node_opts = oyFilterNode_GetOptions( node, 0 );
+  const char * alpha_mode = oyOptions_FindString( node_opts,
+                                       "//" OY_TYPE_STD "/layout/alpha", 0 );
+  oyPixelAccess_s * new_ticket = NULL;
+  oyArray2d_s * array_in = NULL, * array_out = NULL;
+  oyraLayoutPlan_s plan;
+
+  if(!image_input || !image_output || !input_node)
+  {
+    result = 1;
+    goto clean_layout;
+  }
+
+  if(oyraLayoutPlan_( &plan, image_input, image_output, alpha_mode ))
+  {
+    oyFilterSocket_Callback( requestor_plug, oyCONNECTOR_EVENT_INCOMPATIBLE_DATA );
+    oyra_msg( oyMSG_WARN, (oyStruct_s*)ticket, OY_DBG_FORMAT_
+              "can not convert image[%d] -> image[%d]", OY_DBG_ARGS_,
+              oyStruct_GetId( (oyStruct_s*)image_input ),
+              oyStruct_GetId( (oyStruct_s*)image_output ) );
+    result = 1;
+    goto clean_layout;
+  }
+
+  /* nothing to do, pass the ticket through */
+  if(oyImage_GetPixelLayout( image_input, oyLAYOUT ) ==
+     oyImage_GetPixelLayout( image_output, oyLAYOUT ) &&
+     !plan.premultiply)
+  {
+    result = oyFilterNode_Run( input_node, plug, ticket );
+    goto clean_layout;
+  }
+
+  /* create a new ticket with a input layout array of the old dimensions */
+  {
+    oyArray2d_s * a,
+                * old_a = oyPixelAccess_GetArray( ticket );
+    int w = oyArray2d_GetDataGeo1( old_a, 2 ) / plan.channels_out;
+    int h = oyArray2d_GetDataGeo1( old_a, 3 );
+
+    new_ticket = oyPixelAccess_Copy( ticket, ticket->oy_ );
+    oyPixelAccess_SetOutputImage( new_ticket, image_input );
+    oyPixelAccess_SetArray( new_ticket, 0, 0 );
+    a = oyArray2d_Create( NULL, w * plan.channels_in, h, plan.type_in,
+                          ticket->oy_ );
+    oyPixelAccess_SetArray( new_ticket, a, 0 );
+    oyArray2d_Release( &a );
+    oyArray2d_Release( &old_a );
+    oyPixelAccess_SynchroniseROI( new_ticket, ticket );
+  }
+
+  result = oyFilterNode_Run( input_node, plug, new_ticket );
+  if(result != 0)
+    goto clean_layout;
+
+  array_in = oyPixelAccess_GetArray( new_ticket );
+  array_out = oyPixelAccess_GetArray( ticket );
+
+  {
+    uint8_t ** array_in_data = oyArray2d_GetData( array_in ),
+            ** array_out_data = oyArray2d_GetData( array_out );
+    int width_in = oyArray2d_GetWidth( array_in ) / plan.channels_in,
+        width_out = oyArray2d_GetWidth( array_out ) / plan.channels_out,
+        n = OY_MIN( width_in, width_out ),
+        lines = OY_MIN( oyArray2d_GetHeight( array_in ),
+                        oyArray2d_GetHeight( array_out ) ),
+        k;
+    int threads_n =
+#if defined(_OPENMP) && defined(USE_OPENMP)
+                    omp_get_max_threads();
+#else
+                    1;
+#endif
+    size_t stride;
+    uint8_t * tmp;
+
+    /* each planar line keeps the planes at its own width */
+    plan.plane_in = plan.planar_in ? width_in : 1;
+    plan.plane_out = plan.planar_out ? width_out : 1;
+    stride = oyraLayoutLineBufferSize_( &plan, n );
+    tmp = (uint8_t*) oyAllocateFunc_( stride * threads_n );
+
+    if(oy_debug > 2)
+      oyra_msg( oyMSG_DBG, (oyStruct_s*)ticket, OY_DBG_FORMAT_
+                "image[%d] -> image[%d] lines: %d pixel: %d", OY_DBG_ARGS_,
+                oyStruct_GetId( (oyStruct_s*)image_input ),
+                oyStruct_GetId( (oyStruct_s*)image_output ), lines, n );
+
+    if(!tmp)
+      result = 1;
+    else if(lines > threads_n * 10)
+    {
+#if defined(USE_OPENMP)
+#pragma omp parallel for
+#endif
+      for(k = 0; k < lines; ++k)
+      {
+        int index = 0;
+#if defined(_OPENMP) && defined(USE_OPENMP)
+        index = omp_get_thread_num();
+#endif
+        oyraLayoutLine_( array_in_data[k], array_out_data[k], n, &plan,
+                         &tmp[stride * index] );
+      }
+    } else
+      for(k = 0; k < lines; ++k)
+        oyraLayoutLine_( array_in_data[k], array_out_data[k], n, &plan, tmp );
+
+    if(tmp)
+      oyDeAllocateFunc_( tmp );
+  }
+
+  clean_layout:
+  oyArray2d_Release( &array_in );
+  oyArray2d_Release( &array_out );
+  oyPixelAccess_Release( &new_ticket );
+  oyOptions_Release( &node_opts );
+  oyImage_Release( &image_input );
+  oyImage_Release( &image_output );
+  oyFilterPlug_Release( &plug );
+  oyFilterNode_Release( &input_node );
+  oyFilterSocket_Release( &socket );
+  oyFilterNode_Release( &node );
+
+  return result;
+}
+
+
+#define OY_IMAGE_LAYOUT_REGISTRATION OY_TOP_SHARED OY_SLASH OY_DOMAIN_INTERNAL OY_SLASH OY_TYPE_STD OY_SLASH "layout"
+
+/** @brief    oyra oyCMMapi7_s implementation
+ *
+ *  a filter providing a pixel layout image filter
+ *
+ *  @version Oyranos: 0.9.7
+ *  @since   2026/10/19 (Oyranos: 0.9.7)
+ *  @date    2026/10/19
+ */
+oyCMMapi_s * oyraApi7ImageLayoutCreate(void)
+{
+  oyCMMapi7_s * layout7;
+  int32_t cmm_version[3] = {OYRANOS_VERSION_A,OYRANOS_VERSION_B,OYRANOS_VERSION_C},
+          module_api[3]  = {OYRANOS_VERSION_A,OYRANOS_VERSION_B,OYRANOS_VERSION_C};
+  static oyDATATYPE_e data_types[7] = {oyUINT8, oyUINT16, oyUINT32,
+                                       oyHALF, oyFLOAT, oyDOUBLE, 0};
+  oyConnectorImaging_s * plug = oyConnectorImaging_New(0),
+                       * socket = oyConnectorImaging_New(0);
+  static oyConnectorImaging_s * plugs[2] = {0,0},
+                              * sockets[2] = {0,0};
+  oyConnectorImaging_s * cs[2];
+  int i;
+  plugs[0] = plug;
+  sockets[0] = socket;
+  cs[0] = plug; cs[1] = socket;
+  oyObject_SetNames( plug->oy_, "oyra7", __func__, OY_IMAGE_LAYOUT_REGISTRATION );
+  oyObject_SetNames( socket->oy_, "oyra7", __func__, OY_IMAGE_LAYOUT_REGISTRATION );
+
+  for(i = 0; i < 2; ++i)
+  {
+    oyConnectorImaging_s * c = cs[i];
+    oyConnectorImaging_SetDataTypes( c, data_types, 6 );
+    oyConnectorImaging_SetReg( c, "//" OY_TYPE_STD "/manipulator.data" );
+    oyConnectorImaging_SetMatch( c, oyFilterSocket_MatchImagingPlug );
+    if(c == plug)
+      oyConnectorImaging_SetTexts( c, oyCMMgetImageConnectorPlugText,
+                                   oy_image_connector_texts );
+    else
+      oyConnectorImaging_SetTexts( c, oyCMMgetImageConnectorSocketText,
+                                   oy_image_connector_texts );
+    oyConnectorImaging_SetIsPlug( c, c == plug );
+    oyConnectorImaging_SetCapability( c, oyCONNECTOR_IMAGING_CAP_MAX_COLOR_OFFSET, -1 );
+    oyConnectorImaging_SetCapability( c, oyCONNECTOR_IMAGING_CAP_MIN_CHANNELS_COUNT, 1 );
+    oyConnectorImaging_SetCapability( c, oyCONNECTOR_IMAGING_CAP_MAX_CHANNELS_COUNT, OYRA_LAYOUT_MAX_CHANNELS );
+    oyConnectorImaging_SetCapability( c, oyCONNECTOR_IMAGING_CAP_MIN_COLOR_COUNT, 1 );
+    oyConnectorImaging_SetCapability( c, oyCONNECTOR_IMAGING_CAP_MAX_COLOR_COUNT, OYRA_LAYOUT_MAX_CHANNELS );
+    oyConnectorImaging_SetCapability( c, oyCONNECTOR_IMAGING_CAP_CAN_PLANAR, 1 );
+    oyConnectorImaging_SetCapability( c, oyCONNECTOR_IMAGING_CAP_CAN_INTERWOVEN, 1 );
+    oyConnectorImaging_SetCapability( c, oyCONNECTOR_IMAGING_CAP_CAN_SWAP, 1 );
+    oyConnectorImaging_SetCapability( c, oyCONNECTOR_IMAGING_CAP_CAN_SWAP_BYTES, 1 );
+    oyConnectorImaging_SetCapability( c, oyCONNECTOR_IMAGING_CAP_CAN_PREMULTIPLIED_ALPHA, 1 );
+    oyConnectorImaging_SetCapability( c, oyCONNECTOR_IMAGING_CAP_CAN_NONPREMULTIPLIED_ALPHA, 1 );
+    oyConnectorImaging_SetCapability( c, oyCONNECTOR_IMAGING_CAP_ID, 1 );
+  }
+
+  layout7 = oyCMMapi7_Create (         oyraCMMInit, oyraCMMReset, oyraCMMMessageFuncSet,
+                                       OY_IMAGE_LAYOUT_REGISTRATION,
+                                       cmm_version, module_api,
+                                       NULL,
+                                       oyraFilter_ImageLayoutRun,
+                                       (oyConnector_s**)plugs, 1, 0,
+                                       (oyConnector_s**)sockets, 1, 0,
+                                       0, 0 );
+  oyObject_SetNames( layout7->oy_, "oyra7", __func__, OY_IMAGE_LAYOUT_REGISTRATION );
+  return (oyCMMapi_s*) layout7;
+}
+
+const char * oyraApi4UiImageLayoutGetText (
+                                       const char        * select,
+                                       oyNAME_e            type,
+                                       oyStruct_s        * context OY_UNUSED )
+{
+  if(strcmp(select,"name") == 0)
+  {
+    if(type == oyNAME_NICK)
+      return "image_layout";
+    else if(type == oyNAME_NAME)
+      return _("Image[layout]");
+    else if(type == oyNAME_DESCRIPTION)
+      return _("Pixel Layout Image Filter Object");
+  } else if(strcmp(select,"help") == 0)
+  {
+    if(type == oyNAME_NICK)
+      return "help";
+    else if(type == oyNAME_NAME)
+      return _("The filter converts the pixel layout.");
+    else if(type == oyNAME_DESCRIPTION)
+    {
+      static char * help_desc = NULL;
+      if(!help_desc)
+        oyStringAddPrintf( &help_desc, 0,0, "%s",
+        _("The filter converts the input pixel layout into the layout of the output image. It handles data types, color channel order, color offsets, planar and interwoven lines and byte swapping. An optional \"alpha\" string option with \"premultiply\" or \"unpremultiply\" value changes color channels by the alpha channel.")
+         );
+      return help_desc;
+    }
+  } else if(strcmp(select,"category") == 0)
+  {
+    if(type == oyNAME_NICK)
+      return "category";
+    else if(type == oyNAME_NAME)
+      return _("Image/Simple Image[layout]");
+    else if(type == oyNAME_DESCRIPTION)
+      return _("The filter is used to adapt pixel layouts between filters.");
+  }
+  return 0;
+}
+
+
+/** @brief    oyra oyCMMapi4_s implementation
+ *
+ *  a filter providing a pixel layout image filter
+ *
+ *  @version Oyranos: 0.9.7
+ *  @since   2026/10/19 (Oyranos: 0.9.7)
+ *  @date    2026/10/19
+ */
+oyCMMapi_s * oyraApi4ImageLayoutCreate(void)
+{
+  static const char * oyra_api4_ui_image_layout_texts[] = {"name", "help", "category", 0};
+  oyCMMui_s * ui = oyCMMui_Create( "Image/Simple Image[layout]", /* category */
+                                   oyraApi4UiImageLayoutGetText,
+                                   oyra_api4_ui_image_layout_texts, 0 );
+  int32_t cmm_version[3] = {OYRANOS_VERSION_A,OYRANOS_VERSION_B,OYRANOS_VERSION_C},
+          module_api[3]  = {OYRANOS_VERSION_A,OYRANOS_VERSION_B,OYRANOS_VERSION_C};
+
+  oyCMMapi4_s * layout4 = oyCMMapi4_Create( oyraCMMInit, oyraCMMReset, oyraCMMMessageFuncSet,
+                                       OY_IMAGE_LAYOUT_REGISTRATION,
+                                       cmm_version, module_api,
+                                       NULL,
+                                       NULL,
+                                       NULL,
+                                       ui,
+                                       NULL );
+  oyObject_SetNames( layout4->oy_, "oyra4", __func__, OY_IMAGE_LAYOUT_REGISTRATION );
+  return (oyCMMapi_s*)layout4;
+}
+/* OY_IMAGE_LAYOUT_REGISTRATION ----------------------------------------------*/
+/* ---------------------------------------------------------------------------*/
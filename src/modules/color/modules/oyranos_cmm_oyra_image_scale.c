@@ -38,6 +38,353 @@
 /* OY_IMAGE_SCALE_REGISTRATION */
 
 
+/** @internal
+ *  @brief   resampling filters of the scale node
+ *
+ *  Selected with the "//" OY_TYPE_STD "/scale/interpolation" string option.
+ */
+#define OYRA_SCALE_MAX_TAPS 1024
+
+typedef enum {
+  oyraSCALE_NEAREST,                   /**< copy the nearest pixel; default */
+  oyraSCALE_BOX,                       /**< average the covered pixels */
+  oyraSCALE_BILINEAR,                  /**< triangle filter */
+  oyraSCALE_LANCZOS3                   /**< windowed sinc with three lobes */
+} oyraSCALE_e;
+
+static oyraSCALE_e oyraScaleFromString_ (
+                                       const char        * interpolation )
+{
+  if(!interpolation)
+    return oyraSCALE_NEAREST;
+  if(strcmp( interpolation, "box" ) == 0)
+    return oyraSCALE_BOX;
+  if(strcmp( interpolation, "bilinear" ) == 0 ||
+     strcmp( interpolation, "linear" ) == 0)
+    return oyraSCALE_BILINEAR;
+  if(strcmp( interpolation, "lanczos3" ) == 0 ||
+     strcmp( interpolation, "lanczos" ) == 0)
+    return oyraSCALE_LANCZOS3;
+  return oyraSCALE_NEAREST;
+}
+
+static double oyraScaleSupport_      ( oyraSCALE_e         type )
+{
+  switch(type)
+  {
+    case oyraSCALE_BOX: return 0.5;
+    case oyraSCALE_BILINEAR: return 1.0;
+    case oyraSCALE_LANCZOS3: return 3.0;
+    default: return 0.5;
+  }
+}
+
+static double oyraSinc_              ( double              x )
+{
+  if(x == 0.0)
+    return 1.0;
+  x *= M_PI;
+  return sin(x) / x;
+}
+
+static double oyraScaleKernel_       ( oyraSCALE_e         type,
+                                       double              t )
+{
+  t = fabs(t);
+  switch(type)
+  {
+    case oyraSCALE_BOX: return t <= 0.5 ? 1.0 : 0.0;
+    case oyraSCALE_BILINEAR: return t < 1.0 ? 1.0 - t : 0.0;
+    case oyraSCALE_LANCZOS3: return t < 3.0 ? oyraSinc_(t) * oyraSinc_(t/3.0) : 0.0;
+    default: return 0.0;
+  }
+}
+
+/** @internal
+ *  @brief   precomputed weights along one axis
+ *
+ *  Each output position has taps input positions, which are clamped to the
+ *  input array, and normalised weights. The input array contains a margin
+ *  of oyraScaleMargin_() around the scaled tile, as far as the image
+ *  reaches. So the clamping only happens at the image borders.
+ */
+typedef struct {
+  int              n;                  /**< output positions */
+  int              taps;               /**< weights per output position */
+  int            * index;              /**< n * taps input positions */
+  float          * weight;             /**< n * taps weights */
+} oyraScaleWeights_s;
+
+static void oyraScaleWeightsRelease_ ( oyraScaleWeights_s* w )
+{
+  if(w->index) oyDeAllocateFunc_( w->index );
+  if(w->weight) oyDeAllocateFunc_( w->weight );
+  memset( w, 0, sizeof(oyraScaleWeights_s) );
+}
+
+/* input pixels needed around a scaled tile by the filter kernel */
+static int  oyraScaleMargin_         ( oyraSCALE_e         type,
+                                       double              scale )
+{
+  return (int)ceil( oyraScaleSupport_( type ) / (scale < 1.0 ? scale : 1.0) ) + 1;
+}
+
+/* offset is the position of the output array origin in input array pixels */
+static int  oyraScaleWeights_        ( oyraScaleWeights_s* w,
+                                       oyraSCALE_e         type,
+                                       int                 n_out,
+                                       int                 n_in,
+                                       double              scale,
+                                       double              offset )
+{
+  /* widen the filter for downscaling to cover all input pixels */
+  double filter_scale = scale < 1.0 ? scale : 1.0,
+         support = oyraScaleSupport_( type ) / filter_scale;
+  int i, k;
+
+  memset( w, 0, sizeof(oyraScaleWeights_s) );
+  if(n_out <= 0 || n_in <= 0)
+    return 1;
+
+  w->n = n_out;
+  w->taps = (int)ceil( support * 2.0 ) + 1;
+  w->index = (int*) oyAllocateFunc_( sizeof(int) * n_out * w->taps );
+  w->weight = (float*) oyAllocateFunc_( sizeof(float) * n_out * w->taps );
+  if(!w->index || !w->weight)
+  {
+    oyraScaleWeightsRelease_( w );
+    return 1;
+  }
+
+  for(i = 0; i < n_out; ++i)
+  {
+    double center = (i + 0.5) / scale - 0.5 + offset,
+           sum = 0.0;
+    int first = (int)floor( center - support + 0.5 );
+    int * index = &w->index[i * w->taps];
+    float * weight = &w->weight[i * w->taps];
+
+    for(k = 0; k < w->taps; ++k)
+    {
+      int pos = first + k;
+      double v = oyraScaleKernel_( type, (pos - center) * filter_scale );
+      index[k] = pos < 0 ? 0 : pos >= n_in ? n_in - 1 : pos;
+      weight[k] = v;
+      sum += v;
+    }
+
+    if(sum != 0.0)
+      for(k = 0; k < w->taps; ++k)
+        weight[k] /= sum;
+    else
+    {
+      /* fall back to the nearest pixel */
+      int pos = OY_ROUND( center );
+      for(k = 0; k < w->taps; ++k)
+        weight[k] = 0.0f;
+      index[0] = pos < 0 ? 0 : pos >= n_in ? n_in - 1 : pos;
+      weight[0] = 1.0f;
+    }
+  }
+
+  return 0;
+}
+
+/* horizontal pass over one float line */
+static void oyraScaleLineH_          ( const float       * in,
+                                       float             * out,
+                                       int                 channels,
+                                       oyraScaleWeights_s* w )
+{
+  int x, k, c;
+
+  if(channels == 4)
+  {
+    for(x = 0; x < w->n; ++x)
+    {
+      const int * index = &w->index[x * w->taps];
+      const float * weight = &w->weight[x * w->taps];
+      float s0 = 0.f, s1 = 0.f, s2 = 0.f, s3 = 0.f;
+      for(k = 0; k < w->taps; ++k)
+      {
+        const float * p = &in[index[k] * 4];
+        float f = weight[k];
+        s0 += p[0] * f; s1 += p[1] * f; s2 += p[2] * f; s3 += p[3] * f;
+      }
+      out[x*4+0] = s0; out[x*4+1] = s1; out[x*4+2] = s2; out[x*4+3] = s3;
+    }
+  } else if(channels == 3)
+  {
+    for(x = 0; x < w->n; ++x)
+    {
+      const int * index = &w->index[x * w->taps];
+      const float * weight = &w->weight[x * w->taps];
+      float s0 = 0.f, s1 = 0.f, s2 = 0.f;
+      for(k = 0; k < w->taps; ++k)
+      {
+        const float * p = &in[index[k] * 3];
+        float f = weight[k];
+        s0 += p[0] * f; s1 += p[1] * f; s2 += p[2] * f;
+      }
+      out[x*3+0] = s0; out[x*3+1] = s1; out[x*3+2] = s2;
+    }
+  } else
+    for(x = 0; x < w->n; ++x)
+    {
+      const int * index = &w->index[x * w->taps];
+      const float * weight = &w->weight[x * w->taps];
+      float * o = &out[x * channels];
+      for(c = 0; c < channels; ++c)
+        o[c] = 0.f;
+      for(k = 0; k < w->taps; ++k)
+      {
+        const float * p = &in[index[k] * channels];
+        float f = weight[k];
+        OYRA_SIMD
+        for(c = 0; c < channels; ++c)
+          o[c] += p[c] * f;
+      }
+    }
+}
+
+/** @internal
+ *  @brief   separable resampling of a array
+ *
+ *  Each thread filters a band of output lines. Horizontally filtered
+ *  input lines are kept in a small per thread ring cache, which is
+ *  indexed by the input line number. So neighbouring output lines reuse
+ *  the input lines and each input line is horizontally filtered only once
+ *  per band. The vertical pass runs over contiguous float lines.
+ *
+ *  The cache lives for one run. Input lines inside the kernel margin of
+ *  vertically neighbouring tiles are read and filtered again by each tile;
+ *  rows are not cached across tiles.
+ *
+ *  ox and oy place the output array origin in the input array, including
+ *  the margin, in input pixels.
+ */
+static int  oyraScaleArray_          ( uint8_t          ** array_in_data,
+                                       int                 nw,
+                                       int                 nh,
+                                       uint8_t          ** array_out_data,
+                                       int                 w,
+                                       int                 h,
+                                       int                 channels,
+                                       oyDATATYPE_e        data_type,
+                                       int                 byteswap,
+                                       oyraSCALE_e         type,
+                                       double              scale,
+                                       double              ox,
+                                       double              oy )
+{
+  oyraScaleWeights_s wx, wy;
+  int bps = oyDataTypeGetSize( data_type );
+  int threads_n =
+#if defined(_OPENMP) && defined(USE_OPENMP)
+                  omp_get_max_threads();
+#else
+                  1;
+#endif
+  int t, error = 0;
+  size_t line_in = (size_t)nw * channels,
+         line_out = (size_t)w * channels,
+         thread_size;
+  float * buffer;
+
+  if(oyraScaleWeights_( &wx, type, w, nw, scale, ox ) ||
+     oyraScaleWeights_( &wy, type, h, nh, scale, oy ))
+  {
+    oyraScaleWeightsRelease_( &wx );
+    oyraScaleWeightsRelease_( &wy );
+    return 1;
+  }
+
+  if(wy.taps > OYRA_SCALE_MAX_TAPS)
+  {
+    oyraScaleWeightsRelease_( &wx );
+    oyraScaleWeightsRelease_( &wy );
+    return 1;
+  }
+
+  if(threads_n > h) threads_n = h;
+  if(threads_n < 1) threads_n = 1;
+
+  /* per thread: input line + byte swap space, output line, ring cache */
+  thread_size = line_in + (line_in * bps + sizeof(float) - 1) / sizeof(float) +
+                line_out + line_out * wy.taps;
+  buffer = (float*) oyAllocateFunc_( sizeof(float) * thread_size * threads_n );
+  if(!buffer)
+    error = 1;
+
+  if(!error)
+  {
+#if defined(USE_OPENMP)
+#pragma omp parallel for schedule(static)
+#endif
+    for(t = 0; t < threads_n; ++t)
+    {
+      float * in = &buffer[thread_size * t],
+            * swap = in + line_in,
+            * out = swap + (line_in * bps + sizeof(float) - 1) / sizeof(float),
+            * cache = out + line_out;
+      int cache_line[OYRA_SCALE_MAX_TAPS];
+      int y, k, y_start = h * t / threads_n,
+          y_end = h * (t + 1) / threads_n;
+      size_t i;
+
+      for(k = 0; k < wy.taps; ++k)
+        cache_line[k] = -1;
+
+      for(y = y_start; y < y_end; ++y)
+      {
+        const int * index = &wy.index[y * wy.taps];
+        const float * weight = &wy.weight[y * wy.taps];
+
+        /* horizontal pass for not yet cached input lines */
+        for(k = 0; k < wy.taps; ++k)
+        {
+          int line = index[k],
+              slot = line % wy.taps;
+          if(cache_line[slot] != line)
+          {
+            oyraLineToFloat( array_in_data[line], data_type, byteswap, in,
+                             line_in, (uint8_t*)swap );
+            oyraScaleLineH_( in, &cache[slot * line_out], channels, &wx );
+            cache_line[slot] = line;
+          }
+        }
+
+        /* vertical pass */
+        {
+          const float * row = &cache[(index[0] % wy.taps) * line_out];
+          float f = weight[0];
+          OYRA_SIMD
+          for(i = 0; i < line_out; ++i)
+            out[i] = row[i] * f;
+        }
+        for(k = 1; k < wy.taps; ++k)
+        {
+          const float * row = &cache[(index[k] % wy.taps) * line_out];
+          float f = weight[k];
+          if(f == 0.0f) continue;
+          OYRA_SIMD
+          for(i = 0; i < line_out; ++i)
+            out[i] += row[i] * f;
+        }
+
+        oyraLineFromFloat( out, data_type, byteswap, array_out_data[y],
+                           line_out );
+      }
+    }
+  }
+
+  if(buffer)
+    oyDeAllocateFunc_( buffer );
+  oyraScaleWeightsRelease_( &wx );
+  oyraScaleWeightsRelease_( &wy );
+
+  return error;
+}
 
 /* OY_IMAGE_SCALE_REGISTRATION ----------------------------------------------*/
 
@@ -45,8 +392,13 @@
 /** @func    oyraFilter_ImageScaleRun
  *  @brief   implement oyCMMFilter_GetNext_f()
  *
- *  @version Oyranos: 0.9.6
- *  @date    2016/04/04
+ *  The "//" OY_TYPE_STD "/scale/interpolation" option selects the
+ *  resampling filter: "nearest" (default), "box", "bilinear" or "lanczos3".
+ *  The filters request the source tile with a margin for their kernel,
+ *  limited by the image. So tiles are filtered seamless.
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2026/10/19
  *  @since   2013/06/10 (Oyranos: 0.9.5)
  */
 int      oyraFilter_ImageScaleRun    ( oyFilterPlug_s    * requestor_plug,
@@ -82,6 +434,7 @@ int      oyraFilter_ImageScaleRun    ( oyFilterPlug_s    * requestor_plug,
     oyRectangle_s * ticket_roi_pix = (oyRectangle_s*)&ticket_roi_pix_;
     double  scale = 1.0;
     oyOptions_s * node_opts = oyFilterNode_GetOptions( node, 0 );
+    oyraSCALE_e interpolation;
 
     if(!node_opts)
       dirty = 1;
@@ -102,6 +455,8 @@ int      oyraFilter_ImageScaleRun    ( oyFilterPlug_s    * requestor_plug,
                                   "//" OY_TYPE_STD "/scale/scale",
                                   0, &scale );
     if(error) WARNc2_S("%s %d", _("found issues"),error);
+    interpolation = oyraScaleFromString_( oyOptions_FindString( node_opts,
+                                  "//" OY_TYPE_STD "/scale/interpolation", 0 ) );
 
 
     oyPixelAccess_RoiToPixels( ticket, NULL, &ticket_roi_pix );
@@ -131,6 +486,9 @@ int      oyraFilter_ImageScaleRun    ( oyFilterPlug_s    * requestor_plug,
           layout_dst = oyImage_GetPixelLayout( output_image, oyLAYOUT );
       int channels_src = oyToChannels_m( layout_src );
       int channels_dst = oyToChannels_m( layout_dst );
+      int filtered = interpolation != oyraSCALE_NEAREST &&
+                     layout_src == layout_dst && !oyToPlanar_m( layout_src ),
+          margin_x = 0, margin_y = 0;
 
       /* avoid division by zero */
       if(!channels_src) channels_src = 1;
@@ -160,13 +518,38 @@ int      oyraFilter_ImageScaleRun    ( oyFilterPlug_s    * requestor_plug,
         /* scale */
       oyRectangle_Scale( new_ticket_array_roi_pix, 1.0/scale );
       oyRectangle_Round( new_ticket_array_roi_pix );
-        /* convert to new_ticket relative dimensions */
-      oyPixelAccess_PixelsToRoi( new_ticket, new_ticket_array_roi_pix,
-                                 &new_ticket_array_roi );
 
       /* adapt the access start and write relative to new tickets image width */
       start_x_dst_pixel = OY_ROUND(start_x_src_pixel / scale);
       start_y_dst_pixel = OY_ROUND(start_y_src_pixel / scale);
+
+      /* add the kernel margin around the tile, but stay inside the image */
+      if(filtered)
+      {
+        oyRectangle_s_ * r = &new_ticket_array_roi_pix_;
+        int m = oyraScaleMargin_( interpolation, scale ),
+            iw = oyImage_GetWidth( image ),
+            ih = oyImage_GetHeight( image ),
+            x = start_x_dst_pixel,
+            y = start_y_dst_pixel,
+            x_end = x + OY_ROUND(r->width),
+            y_end = y + OY_ROUND(r->height),
+            x0 = OY_MAX( x - m, OY_MIN( x, 0 ) ),
+            y0 = OY_MAX( y - m, OY_MIN( y, 0 ) ),
+            x1 = OY_MIN( x_end + m, OY_MAX( x_end, iw ) ),
+            y1 = OY_MIN( y_end + m, OY_MAX( y_end, ih ) );
+
+        margin_x = x - x0;
+        margin_y = y - y0;
+        start_x_dst_pixel -= margin_x;
+        start_y_dst_pixel -= margin_y;
+        r->width = x1 - x0;
+        r->height = y1 - y0;
+      }
+
+        /* convert to new_ticket relative dimensions */
+      oyPixelAccess_PixelsToRoi( new_ticket, new_ticket_array_roi_pix,
+                                 &new_ticket_array_roi );
       oyPixelAccess_ChangeRectangle( new_ticket,
                                      start_x_dst_pixel / image_width,
                                      start_y_dst_pixel / image_width,
@@ -209,7 +592,7 @@ int      oyraFilter_ImageScaleRun    ( oyFilterPlug_s    * requestor_plug,
                      data_type_out = oyToDataType_m( layout_dst );
         int bps_in = oyDataTypeGetSize( data_type_in ),
             bps_out = oyDataTypeGetSize( data_type_out );
-        int issue = 0;
+        int issue = 0, nearest_lines;
 
         /* get the source pixels */
           if(oy_debug > 2)
@@ -231,9 +614,10 @@ int      oyraFilter_ImageScaleRun    ( oyFilterPlug_s    * requestor_plug,
         h  = oyArray2d_GetHeight( array_out );
         nw = oyArray2d_GetWidth ( array_in ) / channels_src;
         nh = oyArray2d_GetHeight( array_in );
+        nearest_lines = h;
 
-        if(nw < (int)OY_ROUND(w/scale)) issue |= 1;
-        if(nh < (int)OY_ROUND(h/scale)) issue |= 2;
+        if(nw < (int)OY_ROUND(w/scale) + margin_x) issue |= 1;
+        if(nh < (int)OY_ROUND(h/scale) + margin_y) issue |= 2;
         if(issue || oy_debug > 2)
         {
           oyra_msg( oyMSG_WARN, (oyStruct_s*)ticket, OY_DBG_FORMAT_
@@ -260,13 +644,24 @@ int      oyraFilter_ImageScaleRun    ( oyFilterPlug_s    * requestor_plug,
           if(a) {free(a);} if(b) {free(b);} if(c) {free(c);}
         }
 
+        /* filter the source pixels; the tile origin is placed exactly and
+         * not at the rounded start of the source tile */
+        if(filtered &&
+           oyraScaleArray_( array_in_data, nw, nh, array_out_data, w, h,
+                            channels_src, data_type_in,
+                            oyToByteswap_m( layout_src ), interpolation,
+                            scale,
+                            start_x_src_pixel / scale - start_x_dst_pixel,
+                            start_y_src_pixel / scale - start_y_dst_pixel ) == 0)
+          nearest_lines = 0;
+
         /* do the scaling while copying the channels */
 #if defined(USE_OPENMP)
 #pragma omp parallel for private(x,xs,ys)
 #endif
-        for(y = 0; y < h; ++y)
+        for(y = 0; y < nearest_lines; ++y)
         {
-          ys = y/scale;
+          ys = y/scale + margin_y;
           if(OY_ROUNDp(ys) >= nh)
           {
             if(oy_debug || (OY_ROUNDp(ys) >= (nh + 1)))
@@ -276,7 +671,7 @@ int      oyraFilter_ImageScaleRun    ( oyFilterPlug_s    * requestor_plug,
           } else
           for(x = 0; x < w; ++x)
           {
-            xs = x/scale;
+            xs = x/scale + margin_x;
             if(OY_ROUNDp(xs) < nw)
             {
 #if 0
@@ -444,7 +839,7 @@ const char * oyraApi4UiImageScaleGetText (
 "             |                                    | \n"
 "             +------------------------------------+ \n"
         "",
-        _("The filter will expect a \"scale\" double option and will create, fill and process a according data version with a new job ticket. The new job tickets image, array and output_array_roi will be divided by the supplied \"scale\" factor. It's plug will request the divided image sizes from the source socket."),
+        _("The filter will expect a \"scale\" double option and will create, fill and process a according data version with a new job ticket. The new job tickets image, array and output_array_roi will be divided by the supplied \"scale\" factor. It's plug will request the divided image sizes from the source socket. An optional \"interpolation\" string option selects \"nearest\" (default), \"box\", \"bilinear\" or \"lanczos3\" resampling."),
         _("Relation of positional parameters:"),
         /* output image region of interesst */
         _("output_array_roi"),
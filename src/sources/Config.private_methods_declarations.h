@@ -0,0 +1,25 @@
+/** @internal
+ *  @brief   a oyConfig_s projected for rank computation
+ *
+ *  Key names and value texts are extracted once per configuration and the
+ *  oyRankMap is resolved once into one slot per key. oyConfigMatch_Rank_()
+ *  compares then plain strings without allocations.
+ */
+typedef struct {
+  int            n;                    /**< count of key/value pairs */
+  char        ** keys;                 /**< oyFILTER_REG_MAX key names */
+  char        ** values;               /**< value texts; can be NULL */
+  const oyRankMap * rank_map;          /**< the map of slots */
+  int          * slots;                /**< rank_map index per key or -1 */
+} oyConfigMatch_s;
+
+int      oyConfigMatch_Set_          ( oyConfigMatch_s   * match,
+                                       oyOptions_s       * options );
+void     oyConfigMatch_Clear_        ( oyConfigMatch_s   * match );
+int32_t  oyConfigMatch_Rank_         ( oyConfigMatch_s   * device,
+                                       oyConfigMatch_s   * pattern,
+                                       const oyRankMap   * rank_map,
+                                       char                path_separator,
+                                       char                key_separator,
+                                       int                 flags );
+oyOptions_s *  oyConfig_MatchOptions_( oyConfig_s_       * device );
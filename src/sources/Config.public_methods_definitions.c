@@ -1,6 +1,12 @@
+#include "oyranos_cache.h"
 #include "oyranos_db.h"
 #include "oyranos_devices.h"
 #include "oyranos_devices_internal.h"
+#include "oyranos_generic_internal.h"
+#include "oyPointer_s.h"
+#ifdef HAVE_POSIX
+#include <sys/stat.h>   /* stat() */
+#endif
 
 /** Function oyConfig_AddDBData
  *  @memberof oyConfig_s
@@ -90,6 +96,246 @@ OYAPI int  OYEXPORT
   return error;
 }
 
+/** @internal
+ *  @brief   device to DB configuration index of one registration
+ *
+ *  The DB configurations are hashed over their "manufacturer", "model" and
+ *  "serial" values into a open addressing table. A device lookup is then
+ *  one probe and the oyConfig_SelectDB() verification over the few
+ *  configurations with equal keys.
+ */
+typedef struct {
+  int            generation;           /**< oyDbGeneration() at build time */
+  char         * db_stamp;             /**< DB file states at build time */
+  char        ** key_set_names;        /**< DB key sets at build time */
+  int            key_set_names_n;
+  oyConfigs_s  * configs;              /**< all DB configs of the registration */
+  unsigned char* keys;                 /**< OY_HASH_SIZE bytes per slot */
+  oyConfigs_s ** slots;                /**< configs with equal keys or NULL */
+  int            slots_n;              /**< a power of two */
+} oyDeviceIndex_s;
+
+static int     oyDeviceIndexRelease_ ( oyPointer         * ptr )
+{
+  oyDeviceIndex_s * index = (oyDeviceIndex_s*) *ptr;
+  int i;
+
+  if(!index) return 1;
+
+  oyStringListRelease_( &index->key_set_names, index->key_set_names_n,
+                        oyDeAllocateFunc_ );
+  if(index->db_stamp)
+    oyDeAllocateFunc_( index->db_stamp );
+  oyConfigs_Release( &index->configs );
+  for(i = 0; i < index->slots_n && index->slots; ++i)
+    oyConfigs_Release( &index->slots[i] );
+  if(index->slots)
+    oyDeAllocateFunc_( index->slots );
+  if(index->keys)
+    oyDeAllocateFunc_( index->keys );
+  oyDeAllocateFunc_( index );
+  *ptr = NULL;
+
+  return 0;
+}
+
+/* hash the significant keys of a device or of a DB configuration;
+ * fails without manufacturer and model */
+static int     oyDeviceIndexKey_     ( oyOptions_s       * opts,
+                                       unsigned char     * key )
+{
+  const char * manufacturer = oyOptions_FindString( opts, "manufacturer", 0 ),
+             * model = oyOptions_FindString( opts, "model", 0 ),
+             * serial = oyOptions_FindString( opts, "serial", 0 );
+  char * text = NULL;
+  int error;
+
+  if(!manufacturer && !model)
+    return 1;
+
+  oyStringAddPrintf( &text, oyAllocateFunc_, oyDeAllocateFunc_, "%s\n%s\n%s",
+                     manufacturer ? manufacturer : "", model ? model : "",
+                     serial ? serial : "" );
+  error = oyMiscBlobGetHash_( text, strlen(text), oyHASH_FAST, key );
+  oyFree_m_( text );
+
+  return error;
+}
+
+/* the slot holding key or the free slot for it */
+static int     oyDeviceIndexSlot_    ( oyDeviceIndex_s   * index,
+                                       const unsigned char*key )
+{
+  uint32_t h;
+  int i;
+
+  memcpy( &h, key, 4 );
+  i = h & (index->slots_n - 1);
+  while(index->slots[i] &&
+        memcmp( &index->keys[i*OY_HASH_SIZE], key, OY_HASH_SIZE ) != 0)
+    i = (i + 1) & (index->slots_n - 1);
+
+  return i;
+}
+
+/* identify the user and system DB files by inode, size and mtime;
+ * the same openicc.json location as used by oyCanSetPersistent() */
+static char *  oyDeviceIndexDBStamp_ ( void )
+{
+  char * stamp = NULL;
+#ifdef HAVE_POSIX
+  oySCOPE_e scopes[2] = { oySCOPE_USER, oySCOPE_SYSTEM };
+  int i;
+
+  for(i = 0; i < 2; ++i)
+  {
+    struct stat st;
+    char * path = oyGetInstallPath( oyPATH_POLICY, scopes[i], oyAllocateFunc_ );
+
+    memset( &st, 0, sizeof(st) );
+    if(path)
+    {
+      oyStringAddPrintf( &path, oyAllocateFunc_, oyDeAllocateFunc_,
+                         "/openicc.json" );
+      if(stat( path, &st ) != 0)
+        memset( &st, 0, sizeof(st) );
+      oyFree_m_( path );
+    }
+    oyStringAddPrintf( &stamp, oyAllocateFunc_, oyDeAllocateFunc_,
+                       "%llu:%lld:%lld",
+                       (unsigned long long) st.st_ino, (long long) st.st_size,
+                       (long long) st.st_mtime );
+#if defined(__linux__)
+    oyStringAddPrintf( &stamp, oyAllocateFunc_, oyDeAllocateFunc_,
+                       ".%ld", (long) st.st_mtim.tv_nsec );
+#endif
+    oyStringAddPrintf( &stamp, oyAllocateFunc_, oyDeAllocateFunc_, ";" );
+  }
+#endif
+  return stamp;
+}
+
+/* read all DB configurations and hash them; takes over key_set_names */
+static oyPointer_s * oyDeviceIndexNew_(const char        * registration,
+                                       char             ** key_set_names,
+                                       int                 key_set_names_n )
+{
+  oyDeviceIndex_s * index = NULL;
+  oyPointer_s * ptr;
+  unsigned char key[OY_HASH_SIZE];
+  int i, n, slot;
+
+  oyAllocHelper_m_( index, oyDeviceIndex_s, 1, oyAllocateFunc_,
+                    oyStringListRelease_( &key_set_names, key_set_names_n, oyDeAllocateFunc_ ); return NULL );
+  index->generation = oyDbGeneration();
+  /* stamp before reading to see changes during the read */
+  index->db_stamp = oyDeviceIndexDBStamp_();
+  index->key_set_names = key_set_names;
+  index->key_set_names_n = key_set_names_n;
+
+  ptr = oyPointer_New( 0 );
+  oyPointer_Set( ptr, __FILE__, "oyDeviceIndex_s*", index,
+                 "oyDeviceIndexRelease_", oyDeviceIndexRelease_ );
+
+  if(oyConfigs_FromDB( registration, NULL, &index->configs, 0 ) > 0)
+  {
+    oyPointer_Release( &ptr );
+    return NULL;
+  }
+  n = oyConfigs_Count( index->configs );
+
+  /* keep the table at most half filled */
+  index->slots_n = 8;
+  while(index->slots_n < 2 * n)
+    index->slots_n *= 2;
+  oyAllocHelper_m_( index->slots, oyConfigs_s*, index->slots_n, oyAllocateFunc_,
+                    oyPointer_Release( &ptr ); return NULL );
+  oyAllocHelper_m_( index->keys, unsigned char, index->slots_n * OY_HASH_SIZE,
+                    oyAllocateFunc_, oyPointer_Release( &ptr ); return NULL );
+
+  for(i = 0; i < n; ++i)
+  {
+    oyConfig_s * config = oyConfigs_Get( index->configs, i );
+
+    /* configurations without keys are reached by the full scan only */
+    if(oyDeviceIndexKey_( ((oyConfig_s_*)config)->db, key ) == 0)
+    {
+      slot = oyDeviceIndexSlot_( index, key );
+      if(!index->slots[slot])
+      {
+        index->slots[slot] = oyConfigs_New( 0 );
+        memcpy( &index->keys[slot*OY_HASH_SIZE], key, OY_HASH_SIZE );
+      }
+      oyConfigs_MoveIn( index->slots[slot], &config, -1 );
+    }
+
+    oyConfig_Release( &config );
+  }
+
+  return ptr;
+}
+
+/* obtain the index of a registration from oy_device_index_cache_;
+ * a index is rebuild after own DB writes, for changed DB files and for
+ * changed DB key sets */
+static oyPointer_s * oyDeviceIndexGet_(const char        * registration )
+{
+  char * db_registration, * t, ** names = NULL, * stamp;
+  int n = 0, i, valid = 0;
+  oyDB_s * db;
+  oyHash_s * entry;
+  oyPointer_s * ptr;
+  oyDeviceIndex_s * index;
+
+  db_registration = oyStringCopy( registration, oyAllocateFunc_ );
+  if(!db_registration) return NULL;
+  t = strchr( db_registration, '.' );
+  if(t) t[0] = 0;
+
+  /* DB key set names are compared to detect changes of other processes */
+  oyExportStart_(EXPORT_PATH | EXPORT_SETTING);
+  db = oyDB_newFrom( db_registration, oySCOPE_USER_SYS, oyAllocateFunc_, oyDeAllocateFunc_ );
+  if(db)
+    names = oyDB_getKeyNamesOneLevel( db, db_registration, &n );
+  oyDB_release( &db );
+  oyFree_m_( db_registration );
+
+  if(!oy_device_index_cache_)
+    oy_device_index_cache_ = oyStructList_Create( 0, "oy_device_index_cache_", 0 );
+  entry = oyCacheListGetEntry_( oy_device_index_cache_, 0, registration );
+
+  ptr = (oyPointer_s*) oyHash_GetPointer( entry, oyOBJECT_POINTER_S );
+  index = (oyDeviceIndex_s*) oyPointer_GetPointer( ptr );
+  if(index)
+  {
+    stamp = oyDeviceIndexDBStamp_();
+    /* files written by other processes, e.g. oyranos-monitor -s */
+    valid = index->generation == oyDbGeneration() &&
+            oyStrcmp_( index->db_stamp ? index->db_stamp : "",
+                       stamp ? stamp : "" ) == 0 &&
+            index->key_set_names_n == n;
+    if(stamp)
+      oyFree_m_( stamp );
+    for(i = 0; valid && i < n; ++i)
+      if(oyStrcmp_( index->key_set_names[i], names[i] ) != 0)
+        valid = 0;
+  }
+
+  if(valid)
+    oyStringListRelease_( &names, n, oyDeAllocateFunc_ );
+  else
+  {
+    oyPointer_Release( &ptr );
+    ptr = oyDeviceIndexNew_( registration, names, n );
+    if(ptr)
+      oyHash_SetPointer( entry, (oyStruct_s*) ptr );
+  }
+  oyHash_Release( &entry );
+  oyExportEnd_();
+
+  return ptr;
+}
+
 /** Function  oyConfig_GetDB
  *  @brief    search a configuration in the DB for a configuration from module
  *  @memberof oyConfig_s
@@ -104,9 +350,17 @@ OYAPI int  OYEXPORT
  *  @return                            0 - good, >= 1 - error + a message should
  *                                     be sent
  *
- *  @version Oyranos: 0.3.0
+ *  Without options the DB configurations are read once per registration
+ *  and indexed over their manufacturer, model and serial keys. The
+ *  configurations with the device keys are then compared first. Only if
+ *  none of them matches, all configurations are compared. The index is
+ *  rebuild after DB writes from this process, when the user or system
+ *  DB file changed on disk, e.g. by another process, or when DB key sets
+ *  were added or removed. The index lives in memory of each process.
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2026/10/19
  *  @since   2009/01/26 (Oyranos: 0.1.10)
- *  @date    2012/09/15
  */
 OYAPI int  OYEXPORT
                oyConfig_GetDB        ( oyConfig_s        * device,
@@ -119,6 +373,37 @@ OYAPI int  OYEXPORT
 
   oyCheckType__m( oyOBJECT_CONFIG_S, return 0 )
 
+  if(error <= 0 && !options)
+  {
+    oyPointer_s * ptr = oyDeviceIndexGet_( s->registration );
+    oyDeviceIndex_s * index = (oyDeviceIndex_s*) oyPointer_GetPointer( ptr );
+
+    if(index)
+    {
+      unsigned char key[OY_HASH_SIZE];
+      int32_t rank = 0;
+      int slot;
+      /* the same device keys as oyConfig_Match() uses */
+      oyOptions_s * dopts = oyOptions_Count( s->backend_core ) ?
+                            s->backend_core : s->db;
+
+      if(oyDeviceIndexKey_( dopts, key ) == 0)
+      {
+        slot = oyDeviceIndexSlot_( index, key );
+        if(index->slots[slot])
+          error = oyConfig_SelectDB( device, index->slots[slot], &rank );
+      }
+      if(error <= 0 && rank <= 0)
+        error = oyConfig_SelectDB( device, index->configs, &rank );
+      if(rank_value)
+        *rank_value = rank;
+
+      oyPointer_Release( &ptr );
+      return error;
+    }
+    oyPointer_Release( &ptr );
+  }
+
   if(error <= 0)
     error = oyConfigs_FromDB( s->registration, options, &configs, 0 );
   if(error <= 0)
@@ -133,6 +418,8 @@ OYAPI int  OYEXPORT
  *  @memberof oyConfig_s
  *
  *  This function is useful to fill the best matching config into the db options set.
+ *  The device obtains own copies of the db options, as configs can be
+ *  shared, e.g. by the oyConfig_GetDB() device index.
  *
  *  @param[in,out] device              the to be checked configuration from
  *                                     oyConfigs_FromPattern_f
@@ -142,8 +429,8 @@ OYAPI int  OYEXPORT
  *  @return                            0 - good, >= 1 - error + a message should
  *                                     be sent
  *
- *  @version Oyranos: 0.9.6
- *  @date    2015/02/15
+ *  @version Oyranos: 0.9.7
+ *  @date    2026/10/19
  *  @since   2009/01/26 (Oyranos: 0.3.2)
  */
 OYAPI int  OYEXPORT
@@ -156,6 +443,7 @@ OYAPI int  OYEXPORT
   int i, n;
   oyConfig_s * config = 0, * max_config = 0;
   oyConfig_s_ * s = (oyConfig_s_*)device;
+  oyConfigMatch_s d, p;
 
   oyCheckType__m( oyOBJECT_CONFIG_S, return 0 )
 
@@ -163,13 +451,27 @@ OYAPI int  OYEXPORT
   {
     n = oyConfigs_Count( configs );
 
+    /* the device keys and values are projected once for all configs */
+    error = oyConfigMatch_Set_( &d, oyConfig_MatchOptions_( s ) );
+
     /** 1. iterate over all configs */
-    for( i = 0; i < n; ++i )
+    for( i = 0; i < n && error <= 0; ++i )
     {
+      oyConfig_s_ * pattern;
+
       config = oyConfigs_Get( configs, i );
+      pattern = (oyConfig_s_*)config;
+      if(!pattern)
+        continue;
 
-      /** 2. oyDeviceCompare() with the provided device */
-      error = oyDeviceCompare( device, config, &rank );
+      /** 2. rank like oyDeviceCompare() with the provided device */
+      rank = 0;
+      error = oyConfigMatch_Set_( &p, pattern->db );
+      if(error <= 0)
+        rank = oyConfigMatch_Rank_( &d, &p,
+                                   s->rank_map ? s->rank_map : pattern->rank_map,
+                                   '/', ',', 0 );
+      oyConfigMatch_Clear_( &p );
       DBG_PROG1_S("rank: %d\n", rank);
       /** 3. store the biggest rank_value */
       if(max_rank < rank)
@@ -181,6 +483,7 @@ OYAPI int  OYEXPORT
 
       oyConfig_Release( &config );
     }
+    oyConfigMatch_Clear_( &d );
   }
 
   if(error <= 0 && rank_value)
@@ -191,8 +494,19 @@ OYAPI int  OYEXPORT
    */
   if(error <= 0 && max_config)
   {
+    oyOptions_s * db = ((oyConfig_s_*)max_config)->db;
+    int k, kn = oyOptions_Count( db );
+
     oyOptions_Release( &s->db );
-    s->db = oyOptions_Copy( ((oyConfig_s_*)max_config)->db, 0 );
+    if(db)
+      s->db = oyOptions_New( s->oy_ );
+    for(k = 0; k < kn; ++k)
+    {
+      oyOption_s * o = oyOptions_Get( db, k ),
+                 * copy = oyOption_Copy( o, s->oy_ );
+      oyOptions_MoveIn( s->db, &copy, -1 );
+      oyOption_Release( &o );
+    }
     oyConfig_Release( &max_config );
   }
 
@@ -354,7 +668,7 @@ OYAPI int  OYEXPORT oyConfig_EraseFromDB (
  *                                     be sent
  *
  *  @version Oyranos: 0.9.7
- *  @date    2024/03/11
+ *  @date    2026/10/19
  *  @since   2017/01/05 (Oyranos: 0.9.7)
  */
 OYAPI int OYEXPORT oyConfig_Match    ( oyConfig_s        * module_device,
@@ -364,18 +678,9 @@ OYAPI int OYEXPORT oyConfig_Match    ( oyConfig_s        * module_device,
                                        int                 flags,
                                        int32_t           * rank_value )
 {
-  int error = !module_device || !db_pattern,
-      multiple_dopts = 0;
-  int domain_n, pattern_n, i, j, k, l,
-      rank = 0,
-      has_opt;
-  oyOption_s * d = 0,
-             * p = 0,
-             * check = 0;
-  oyOptions_s * dopts = 0; /* device options */
-  char * d_opt = 0, * d_val = 0, /* device variables */
-       * p_opt = 0, * p_val = 0, /* pattern variables */
-       * check_opt = 0, * check_val = 0;
+  int error = !module_device || !db_pattern;
+  int32_t rank = 0;
+  oyConfigMatch_s d, p;
   oyConfig_s_ * pattern = (oyConfig_s_*)db_pattern,
               * device  = (oyConfig_s_*)module_device;
   oyRankMap  * rank_map = 0;
@@ -390,157 +695,20 @@ OYAPI int OYEXPORT oyConfig_Match    ( oyConfig_s        * module_device,
     else
       rank_map = pattern->rank_map;
 
-    domain_n = oyOptions_Count( device->backend_core );
-    if(domain_n)
-      dopts = device->backend_core;
-    else
-    {
-      domain_n = oyOptions_Count( device->db );
-      if(domain_n)
-        /* fall back for pure DB contructed oyConfig_s */
-        dopts = device->db;
+    error = oyConfigMatch_Set_( &d, oyConfig_MatchOptions_( device ) );
 #ifdef DEBUG
-      else if(oy_debug > 2)
-        WARNc1_S("No key/values pairs found in %s", device->registration);
+    if(!d.n && oy_debug > 2)
+      WARNc1_S("No key/values pairs found in %s", device->registration);
 #endif
-    }
-
-    pattern_n = oyOptions_Count( pattern->db );
-    for(i = 0; i < domain_n; ++i)
+    if(error <= 0)
+      error = oyConfigMatch_Set_( &p, pattern->db );
+    if(error <= 0)
     {
-      d = oyOptions_Get( dopts, i );
-      d_opt = oyFilterRegistrationToText( oyOption_GetRegistration(d),
-                                          oyFILTER_REG_MAX, 0);
-      d_val = oyOption_GetValueText( d, oyAllocateFunc_ );
-      has_opt = 0;
-
-      /* check for double occurences */
-      for(l = i+1; l < i; ++l)
-      {
-        check = oyOptions_Get( dopts, l );
-        check_opt = oyFilterRegistrationToText( oyOption_GetRegistration(check),
-                                                oyFILTER_REG_MAX, 0);
-        if(oyStrcmp_(d_opt, check_opt) == 0)
-        {
-          check_val = oyOption_GetValueText( check, oyAllocateFunc_ );
-          DBG_PROG4_S( "%d %s occured twice with: %s %s", i, d_opt, check_val,
-                    check_val ? check_val : "" );
-          ++multiple_dopts;
-          if(check_val) oyFree_m_( check_val );
-        }
-
-        oyOption_Release( &check );
-        oyFree_m_( check_opt );
-      }
-
-      if(d_val && d_opt)
-      for( j = 0; j < pattern_n; ++j )
-      {
-        const char * pr;
-        p = oyOptions_Get( pattern->db, j );
-        pr = oyOption_GetRegistration(p);
-        p_opt = oyFilterRegistrationToText( pr, oyFILTER_REG_MAX, 0 );
-
-        if(p_opt && oyStrstr_(p_opt, d_opt))
-        {
-          p_val = oyOption_GetValueText( p, oyAllocateFunc_ );
-          has_opt = 1;
-
-          /** Option name is equal and and value matches : increase rank value
-           *  
-           *        we need a comparision mechanism here. The pattern value
-           *        should be expandable to several values.
-           *        Do we need more than the ICC dict style syntax here?
-           */
-          if((flags & OY_MATCH_SUB_STRING) ?
-                      oyFilterStringMatch( d_val, p_val, oyOBJECT_NONE,
-                                           path_separator, key_separator,
-                                           flags ) :
-                      oyTextIccDictMatch( d_val, p_val, 0.0005,
-                                          path_separator, key_separator ))
-          {
-            if(rank_map)
-            {
-              k = 0;
-              while(rank_map[k].key)
-              {
-                if(oyStrcmp_(rank_map[k].key, d_opt) == 0)
-                {
-                  if(oy_debug)
-                    DBG_PROG5_S( "match_value[%s]: %s - %s %d+%d",
-                                oyNoEmptyString_m_(d_opt), oyNoEmptyString_m_(d_val),
-                                oyNoEmptyString_m_(p_val),
-                                rank, rank_map[k].match_value );
-                  rank += rank_map[k].match_value;
-                  break;
-                }
-                ++k;
-              }
-            } else
-              ++rank;
-
-            if(p_val) oyFree_m_(p_val);
-          } else if(rank_map)
-          {
-            k = 0;
-            while(rank_map[k].key)
-            {
-              if(oyStrcmp_(rank_map[k].key, d_opt) == 0)
-              {
-                if(oy_debug)
-                    DBG_PROG5_S( "none_match_value[%s]: %s - %s %d+%d",
-                                oyNoEmptyString_m_(d_opt), oyNoEmptyString_m_(d_val),
-                                oyNoEmptyString_m_(p_val),
-                                rank, rank_map[k].none_match_value );
-                rank += rank_map[k].none_match_value;
-                break;
-              }
-              ++k;
-            }
-          }
-          j = pattern_n; /* break */
-        }
-        /*
-        rank += oyFilterRegistrationMatch( d->registration, p->registration,
-                                           oyOBJECT_CMM_API8_S); */
-
-        if(oy_debug)
-          DBG_MEM4_S( "[%s]: %s/%s %d",
-                      oyNoEmptyString_m_(d_opt), oyNoEmptyString_m_(d_val),
-                      oyNoEmptyString_m_(p_val), rank );
-
-        oyOption_Release( &p );
-        if(p_opt) oyFree_m_( p_opt );
-        if(p_val) oyFree_m_( p_val );
-      }
-
-      if(!has_opt && rank_map)
-      {
-        k = 0;
-          while(rank_map[k].key)
-          {
-            if(oyStrcmp_(rank_map[k].key, d_opt) == 0)
-            {
-              if(oy_debug)
-                    DBG_NUM5_S( "not_found_value[%s]: %s/%s %d+%d\n",
-                                oyNoEmptyString_m_(d_opt), oyNoEmptyString_m_(d_val),
-                                oyNoEmptyString_m_(p_val),
-                                rank, rank_map[k].not_found_value );
-              rank += rank_map[k].not_found_value;
-              break;
-            }
-            ++k;
-          }
-      }
-
-      oyOption_Release( &d );
-      if(d_opt)
-        oyFree_m_( d_opt );
-      if(d_val)
-        oyFree_m_( d_val );
+      rank = oyConfigMatch_Rank_( &d, &p, rank_map,
+                                  path_separator, key_separator, flags );
+      oyConfigMatch_Clear_( &p );
     }
-    if(multiple_dopts)
-      WARNc1_S( "Found multiple_dopts: %d\n", multiple_dopts );
+    oyConfigMatch_Clear_( &d );
   }
 
   if(rank_value)
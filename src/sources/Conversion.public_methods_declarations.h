@@ -28,6 +28,19 @@ OYAPI oyConversion_s *  OYEXPORT
                                        oyDATATYPE_e        buf_type_out,
                                        uint32_t            flags,
                                        oyObject_s          obj );
+OYAPI oyConversion_s *  OYEXPORT
+                oyConversion_CreateGamutCheck (
+                                       oyProfile_s       * space,
+                                       oyProfiles_s      * proofing,
+                                       oyOptions_s       * options,
+                                       oyObject_s          obj );
+OYAPI int  OYEXPORT
+                 oyConversion_GamutCheck (
+                                       oyConversion_s    * gamut_check,
+                                       const double      * colors,
+                                       int                 count,
+                                       int               * is_outside,
+                                       double            * dE );
 OYAPI oyFilterGraph_s *  OYEXPORT
                 oyConversion_GetGraph (
                                        oyConversion_s    * conversion );
@@ -45,6 +58,11 @@ OYAPI int  OYEXPORT
                                        double              x,
                                        double              y,
                                        oyPixelAccess_s   * pixel_access );
+OYAPI char *  OYEXPORT
+                oyConversion_GetStats (
+                                       oyConversion_s    * conversion,
+                                       int                 flags,
+                                       oyAlloc_f           allocateFunc );
 OYAPI int  OYEXPORT
                  oyConversion_RunPixels (
                                        oyConversion_s    * conversion,
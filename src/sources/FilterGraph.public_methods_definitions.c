@@ -184,13 +184,18 @@ OYAPI int OYEXPORT
  *  @memberof oyFilterGraph_s
  *  @brief    Iterate over a filter graph and possibly prepare contexts
  *
+ *  Only nodes without context or with a changed oyFilterNode_GetHash_()
+ *  text are prepared again. Untouched nodes keep their contexts.
+ *  The graph options obtain a "prepared" string with one line per prepared
+ *  node: "node_id registration seconds".
+ *
  *  @param[in,out] graph               a filter graph
  *  @param[in]     flags               1 - enforce a context preparation
  *  @return                            0 on success, else error
  *
- *  @version Oyranos: 0.1.10
+ *  @version Oyranos: 0.9.7
  *  @since   2009/02/28 (Oyranos: 0.1.10)
- *  @date    2009/03/01
+ *  @date    2026/10/19
  */
 OYAPI int  OYEXPORT
            oyFilterGraph_PrepareContexts (
@@ -200,7 +205,9 @@ OYAPI int  OYEXPORT
   oyOption_s * o = 0;
   oyFilterNode_s_ * node = 0;
   oyFilterGraph_s_ * s = (oyFilterGraph_s_*)graph;
-  int i, n, do_it;
+  int i, n;
+  char * prepared = NULL;
+  double clck;
 
   oyCheckType__m( oyOBJECT_FILTER_GRAPH_S, return 1 )
 
@@ -209,19 +216,30 @@ OYAPI int  OYEXPORT
   {
     node = (oyFilterNode_s_*) oyFilterNodes_Get( s->nodes, i );
 
-    if(flags || !node->backend_data)
-      do_it = 1;
-    else
-      do_it = 0;
-
-    if(do_it &&
-       ((oyCMMapi4_s_*)node->core->api4_)->oyCMMFilterNode_ContextToMem &&
-       strlen(((oyCMMapi7_s_*)node->api7_)->context_type))
+    if(((oyCMMapi4_s_*)node->core->api4_)->oyCMMFilterNode_ContextToMem &&
+       strlen(((oyCMMapi7_s_*)node->api7_)->context_type) &&
+       (flags || oyFilterNode_ContextChanged_( node )))
+    {
+      clck = oyClock();
       oyFilterNode_SetContext_( node, 0 );
+      clck = oyClock() - clck;
+
+      oyStringAddPrintf( &prepared, oyAllocateFunc_, oyDeAllocateFunc_,
+                         "%d %s %g\n", oyFilterNode_GetId( (oyFilterNode_s*)node ),
+                         node->core->registration_, clck/1000000.0 );
+      if(oy_debug)
+        oyMessageFunc_p( oyMSG_DBG, (oyStruct_s*) node,
+                         OY_DBG_FORMAT_ "prepared context: %g", OY_DBG_ARGS_,
+                         clck/1000000.0 );
+    }
 
     oyFilterNode_Release( (oyFilterNode_s**)&node );
   }
 
+  oyOptions_SetFromString( &s->options, "////prepared",
+                           prepared ? prepared : "", OY_CREATE_NEW );
+  if(prepared) oyFree_m_( prepared );
+
   /* clean the graph */
   o = oyOptions_Find( s->options, "dirty", oyNAME_PATTERN );
   oyOption_SetFromString( o, "false", 0 );
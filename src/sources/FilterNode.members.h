@@ -11,5 +11,9 @@
    *  oyCMMapi4_s::oyCMMFilterNode_ContextToMem() and converted to
    *  oyCMMapi4_s::context_type */
   oyPointer_s        * backend_data;
+  /** @private oyFilterNode_GetHash_() api7 key of backend_data */
+  unsigned char        context_hash_[2*OY_HASH_SIZE];
+  /** @private hot path counters */
+  oyFilterNodeStats_s  stats_;
   /** the processing function and node connector descriptions */
   oyCMMapi7_s_       * api7_;
@@ -0,0 +1,27 @@
+/** @internal
+ *  @memberof oyFilterNode_s
+ *  @brief    hot path counters
+ *
+ *  The counters are filled only with ::oy_stats being set.
+ *  oyConversion_GetStats() collects them.
+ *
+ *  @version Oyranos: 0.9.7
+ *  @since   2026/10/19 (Oyranos: 0.9.7)
+ *  @date    2026/10/19
+ */
+typedef struct {
+  uint64_t           runs;             /**< oyFilterNode_Run() calls */
+  uint64_t           pixels;           /**< pixels of the run tickets */
+  uint64_t           run_usec;         /**< run time including upstream nodes */
+  uint64_t           contexts;         /**< oyFilterNode_SetContext_() calls */
+  uint64_t           context_usec;     /**< context creation time */
+  uint64_t           cache_hits;       /**< contexts from a cache */
+  uint64_t           cache_misses;     /**< contexts computed by the CMM */
+} oyFilterNodeStats_s;
+#if defined(__GNUC__)
+#define oyFilterNodeStatsAdd_m(node, counter, value) \
+  __atomic_fetch_add( &(node)->stats_.counter, (uint64_t)(value), __ATOMIC_RELAXED )
+#else
+#define oyFilterNodeStatsAdd_m(node, counter, value) \
+  (node)->stats_.counter += (uint64_t)(value)
+#endif
@@ -195,6 +195,7 @@ int oyFilterNode_Copy__Members( oyFilterNode_s_ * dst, oyFilterNode_s_ * src)
   if(src->backend_data && src->backend_data->copy)
     dst->backend_data = (oyPointer_s*) src->backend_data->copy( (oyStruct_s*)
                                                 src->backend_data , dst->oy_ );
+  memcpy( dst->context_hash_, src->context_hash_, sizeof(dst->context_hash_) );
   if(oy_debug_objects >= 0 && dst->backend_data)
     oyObjectDebugMessage_( dst->backend_data->oy_, __func__,
                            oyStructTypeToText(dst->backend_data->type_) );
@@ -14,6 +14,11 @@ oyFilterNode_s *   oyFilterNode_GetNextFromLinear_ (
 oyPointer    oyFilterNode_TextToInfo_( oyFilterNode_s_    * node,
                                        size_t             * size,
                                        oyAlloc_f            allocateFunc );
+int          oyFilterNode_ContextChanged_ (
+                                       oyFilterNode_s_    * node );
+void         oyFilterNode_StatsRun_  ( oyFilterNode_s_    * node,
+                                       oyPixelAccess_s    * ticket,
+                                       double               usec );
 int      oyFilterNode_Observe_       ( oyObserver_s      * observer,
                                        oySIGNAL_e          signal_type,
                                        oyStruct_s        * signal_data );
@@ -1,5 +1,7 @@
 #include "oyranos_conversion_internal.h"
 #include "oyCMMapi9_s_.h"
+#include "oyranos_cache.h"
+#include "oyObject_s_.h"
 
 /** Function  oyFilterNode_AddToAdjacencyLst_
  *  @memberof oyFilterNode_s
@@ -239,12 +241,15 @@ void *       oyFilterNode_ContextToMem_
  *  The api4 data is passed to a interpolator specific transformer. The result
  *  of this transformer will on request be cached by Oyranos as well.
  *
+ *  With ::oy_stats set, the node counts contexts, their creation time and
+ *  the cache hits and misses.
+ *
  *  @param[in]     node                filter
  *  @param[in,out] blob                context to fill; expensive
  *  @return                            error
  *
- *  @version Oyranos: 0.9.6
- *  @date    2014/06/26
+ *  @version Oyranos: 0.9.7
+ *  @date    2026/10/19
  *  @since   2008/11/02 (Oyranos: 0.1.8)
  */
 int          oyFilterNode_SetContext_( oyFilterNode_s_    * node,
@@ -255,6 +260,8 @@ int          oyFilterNode_SetContext_( oyFilterNode_s_    * node,
   oyHash_s * hash4 = 0,          /* public context provider */
            * hash7 = 0;          /* data processor part */
   oyOption_s * ct = NULL;        /* context module option */
+  double clck = oy_stats ? oyClock() : 0;
+  int cached = -1;               /* 1 - cache hit; 0 - computed */
 
 
   if(error <= 0)
@@ -390,8 +397,18 @@ int          oyFilterNode_SetContext_( oyFilterNode_s_    * node,
               if(!oyPointer_GetPointer(cmm_ptr4))
               {
                 size = 0;
-                /* 3b. ask CMM */
-                ptr = oyFilterNode_ContextToMem_( node, &size, oyAllocateFunc_);
+                ptr = NULL;
+                /* 3b. ask other processes on this host or the CMM */
+                cached = 1;
+                if(oySharedCacheGet_( hash4, oySHARED_CACHE_DEVICE_LINK, &size,
+                                      &ptr, oyAllocateFunc_ ) != 0)
+                {
+                  cached = 0;
+                  ptr = oyFilterNode_ContextToMem_( node, &size, oyAllocateFunc_);
+                  if(ptr && size)
+                    oySharedCacheSet_( hash4, oySHARED_CACHE_DEVICE_LINK, ptr,
+                                       size );
+                }
 
                 if(!ptr || !size)
                 {
@@ -464,7 +481,8 @@ int          oyFilterNode_SetContext_( oyFilterNode_s_    * node,
                   /* 3b.2. update cmm4 cache entry */
                   error = oyHash_SetPointer( hash4, (oyStruct_s*) cmm_ptr4);
                 }
-              }
+              } else
+                cached = 1;
 
 
               if(error <= 0 && cmm_ptr4 && oyPointer_GetPointer(cmm_ptr4))
@@ -503,10 +521,21 @@ int          oyFilterNode_SetContext_( oyFilterNode_s_    * node,
               }
 
             } else
+            {
+              /* a prepare on a node with a context replaces the old one */
+              if(node->backend_data && node->backend_data->release)
+                node->backend_data->release( (oyStruct_s**)&node->backend_data);
               node->backend_data = cmm_ptr7;
+              cached = 1;
+            }
 
           }
           oyPointer_Release( &cmm_ptr4 );
+
+          /* remember the context origin for oyFilterNode_ContextChanged_() */
+          if(error <= 0 && node->backend_data && hash7)
+            memcpy( node->context_hash_, hash7->oy_->hash_ptr_,
+                    sizeof(node->context_hash_) );
   }
 
   clean:
@@ -514,9 +543,88 @@ int          oyFilterNode_SetContext_( oyFilterNode_s_    * node,
     oyHash_Release( &hash7 );
     oyOption_Release( &ct );
 
+  if(oy_stats && cached >= 0)
+  {
+    oyFilterNodeStatsAdd_m( node, contexts, 1 );
+    oyFilterNodeStatsAdd_m( node, context_usec, oyClock() - clck );
+    if(cached)
+      oyFilterNodeStatsAdd_m( node, cache_hits, 1 );
+    else
+      oyFilterNodeStatsAdd_m( node, cache_misses, 1 );
+  }
+
   return error;
 }
 
+/** Function  oyFilterNode_ContextChanged_
+ *  @memberof oyFilterNode_s
+ *  @brief    Check if the node context is outdated
+ *  @internal
+ *
+ *  The api7 hash of the node is compared against the hash, which was used
+ *  by oyFilterNode_SetContext_() to build oyFilterNode_s::backend_data.
+ *  The hash text covers the node options and its input data. So a changed
+ *  upstream node is detected as well.
+ *
+ *  @param[in]     node                filter
+ *  @return                            1 - needs a new context, 0 - valid
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2026/10/19
+ *  @since   2026/10/19 (Oyranos: 0.9.7)
+ */
+int          oyFilterNode_ContextChanged_ (
+                                       oyFilterNode_s_    * node )
+{
+  oyHash_s * hash7;
+  int changed = 1;
+
+  if(!node->backend_data)
+    return 1;
+
+  hash7 = oyFilterNode_GetHash_( node, 7 );
+  if(hash7 && hash7->oy_->hash_ptr_)
+    changed = memcmp( node->context_hash_, hash7->oy_->hash_ptr_,
+                      sizeof(node->context_hash_) ) != 0;
+  oyHash_Release( &hash7 );
+
+  return changed;
+}
+
+/** Function  oyFilterNode_StatsRun_
+ *  @memberof oyFilterNode_s
+ *  @brief    Count a node run
+ *  @internal
+ *
+ *  @param[in,out] node                filter
+ *  @param[in]     ticket              the run ticket
+ *  @param[in]     usec                run time in micro seconds
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2026/10/19
+ *  @since   2026/10/19 (Oyranos: 0.9.7)
+ */
+void         oyFilterNode_StatsRun_  ( oyFilterNode_s_    * node,
+                                       oyPixelAccess_s    * ticket,
+                                       double               usec )
+{
+  oyArray2d_s * a = oyPixelAccess_GetArray( ticket );
+  oyImage_s * image = oyPixelAccess_GetOutputImage( ticket );
+  int channels = oyToChannels_m( oyImage_GetPixelLayout( image, oyLAYOUT ) );
+  uint64_t pixels = 0;
+
+  if(a && channels)
+    pixels = (uint64_t)(oyArray2d_GetDataGeo1( a, 2 ) / channels) *
+             (uint64_t)oyArray2d_GetHeight( a );
+
+  oyFilterNodeStatsAdd_m( node, runs, 1 );
+  oyFilterNodeStatsAdd_m( node, pixels, pixels );
+  oyFilterNodeStatsAdd_m( node, run_usec, usec > 0 ? usec : 0 );
+
+  oyArray2d_Release( &a );
+  oyImage_Release( &image );
+}
+
 /** Function  oyFilterNode_GetData_
  *  @memberof oyFilterNode_s
  *  @brief    Get the processing data from a filter node
@@ -765,9 +873,9 @@ oyPointer    oyFilterNode_TextToInfo_( oyFilterNode_s_    * node,
  *
  *  Implements oyObserver_Signal_f.
  *
- *  @version Oyranos: 0.1.10
+ *  @version Oyranos: 0.9.7
  *  @since   2009/10/28 (Oyranos: 0.1.10)
- *  @date    2009/10/28
+ *  @date    2026/10/19
  */
 int      oyFilterNode_Observe_       ( oyObserver_s      * observer,
                                        oySIGNAL_e          signal_type,
@@ -793,8 +901,8 @@ int      oyFilterNode_Observe_       ( oyObserver_s      * observer,
 
     node = (oyFilterNode_s_*)obs->observer;
 
-    /* invalidate the context */
-    if(node->backend_data)
+    /* invalidate the context, if the options changed its hash */
+    if(node->backend_data && oyFilterNode_ContextChanged_( node ))
       node->backend_data->release( (oyStruct_s**)&node->backend_data );
 
     n = oyFilterNode_EdgeCount( (oyFilterNode_s*)node, 0, 0 );
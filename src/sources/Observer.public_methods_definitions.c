@@ -45,9 +45,9 @@ OYAPI int  OYEXPORT oyObserver_SignalSend (
  *                                     defaults to oyStructSignalForward_
  *  @return                            0 - fine; 1 - error
  *
- *  @version Oyranos: 0.1.10
+ *  @version Oyranos: 0.9.7
  *  @since   2009/10/26 (Oyranos: 0.1.10)
- *  @date    2010/06/25
+ *  @date    2026/10/19
  */
 OYAPI int  OYEXPORT oyStruct_ObserverAdd (
                                        oyStruct_s        * model,
@@ -104,6 +104,7 @@ OYAPI int  OYEXPORT oyStruct_ObserverAdd (
 
       oyStructList_MoveIn( list, (oyStruct_s**)&s, -1, 0 );
     }
+    model->oy_->observers_ = oyStructList_Count( list );
   }
 
   /* add to observer */
@@ -149,9 +150,9 @@ OYAPI int  OYEXPORT oyStruct_ObserverAdd (
  *  @param[in]     signalFunc          the signal handler to remove
  *  @return                            0 - fine; 1 - error
  *
- *  @version Oyranos: 0.1.10
+ *  @version Oyranos: 0.9.7
  *  @since   2009/10/26 (Oyranos: 0.1.10)
- *  @date    2009/11/02
+ *  @date    2026/10/19
  */
 OYAPI int  OYEXPORT oyStruct_ObserverRemove (
                                        oyStruct_s        * model,
@@ -165,6 +166,7 @@ OYAPI int  OYEXPORT oyStruct_ObserverRemove (
   {
     list = oyStruct_ObserverListGet_( model, OY_SIGNAL_OBSERVERS );
     error = oyStruct_ObserverRemove_( list, observer, 1, signalFunc );
+    model->oy_->observers_ = oyStructList_Count( list );
   }
   if(!error && observer->oy_->handles_) /* do not create a new observer list */
   {
@@ -180,15 +182,17 @@ OYAPI int  OYEXPORT oyStruct_ObserverRemove (
  *  @memberof oyObserver_s
  *  @brief   send a signal to all ovservers of a model
  *
+ *  Objects without observers return after a single counter test.
+ *
  *  @param[in]     model               the model
  *  @param[in]     signal_type         the basic signal type to emit
  *  @param[in,out] signal_data         the advanced signal information
  *  @return                            0 - no handler found; 1 - handler found;
  *                                     < 0 error or issue
  *
- *  @version Oyranos: 0.1.10
+ *  @version Oyranos: 0.9.7
  *  @since   2009/10/27 (Oyranos: 0.1.10)
- *  @date    2009/10/27
+ *  @date    2026/10/19
  */
 OYAPI int  OYEXPORT oyStruct_ObserverSignal (
                                        oyStruct_s        * model,
@@ -204,6 +208,10 @@ OYAPI int  OYEXPORT oyStruct_ObserverSignal (
   if(oyToSignalBlock_m( oyObserverGetFlags() ))
     return 0;
 
+  /* unobserved; avoid the handles lookup */
+  if(!error && !model->oy_->observers_)
+    return 0;
+
   if(!error)
     o = oyOptions_Find( model->oy_->handles_, OY_SIGNAL_OBSERVERS,
                         oyNAME_REGISTRATION );
@@ -576,7 +584,7 @@ OYAPI int  OYEXPORT oyStruct_IsObserved (
   oyOptions_s_ * handles = (oyOptions_s_*) model->oy_->handles_;
   int error = 0;
 
-  if(handles)
+  if(handles && model->oy_->observers_)
     n = oyStructList_Count( handles->list_ );
   for(i = 0; i < n; ++i)
   {
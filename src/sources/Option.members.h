@@ -5,3 +5,4 @@
   oyValue_u          * value;          /**< the actual value */
   oyOPTIONSOURCE_e     source;         /**< the source of this value */
   uint32_t             flags;          /**< | oyOPTIONATTRIBUTE_e */
+  int                  value_capacity; /**< allocated elements of a int32 or double list including the count; 0 - unknown */
@@ -355,41 +355,120 @@ int            oyOption_SetFromInt_  ( oyOption_s_       * obj,
        (s->value_type != oyVAL_INT_LIST ||
         (s->value_type == oyVAL_INT_LIST &&
          (!s->value->int32_list || pos >= s->value->int32_list[0]))))
-    {
-      int32_t * old_list = 0,
-                old_int = 0;
+      error = oyOption_ListReserve_( s, oyVAL_INT_LIST, pos + 1 );
 
-      if(s->value_type == oyVAL_INT_LIST)
-        old_list = s->value->int32_list;
-      if(s->value_type == oyVAL_INT)
-        old_int = s->value->int32;
+    if(s->value_type == oyVAL_INT)
+      s->value->int32 = integer;
+    else
+      s->value->int32_list[pos+1] = integer;
 
-      s->value->int32_list = 0;
-      oyStruct_AllocHelper_m_( s->value->int32_list, int32_t, pos + 2,
-                               s, error = 1 );
+    s->flags |= oyOPTIONATTRIBUTE_EDIT;
+    oyStruct_ObserverSignal( (oyStruct_s*)obj, oySIGNAL_DATA_CHANGED, 0 );
+  }
+
+  return error;
+}
+
+/** @internal
+ *  Function oyOption_ListReserve_
+ *  @memberof oyOption_s
+ *  @brief   provide a int32 or double list with at least n elements
+ *
+ *  The list memory grows geometrically, which keeps appending of single
+ *  values linear. A scalar of the same type becomes the first element.
+ *  Other values are released. New elements are zero.
+ *
+ *  @param[in,out] s                   the option
+ *  @param         list_type           oyVAL_INT_LIST or oyVAL_DOUBLE_LIST
+ *  @param         n                   minimal element count
+ *  @return                            0 - success, 1 - error
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2026/10/19
+ *  @since   2026/10/19 (Oyranos: 0.9.7)
+ */
+int            oyOption_ListReserve_ ( oyOption_s_       * s,
+                                       oyVALUETYPE_e       list_type,
+                                       int                 n )
+{
+  int error = 0;
+  int is_dbl = list_type == oyVAL_DOUBLE_LIST;
+  size_t size = is_dbl ? sizeof(double) : sizeof(int32_t);
+  int count = 0, capacity;
+  char * list = NULL;
+
+  if(!s || n < 0 ||
+     (list_type != oyVAL_INT_LIST && list_type != oyVAL_DOUBLE_LIST))
+    return 1;
+
+  if(!s->value)
+  {
+    oyStruct_AllocHelper_m_( s->value, oyValue_u, 1, s, error = 1 );
+    if(error)
+      return error;
+    s->value_type = oyVAL_NONE;
+  }
+
+  if(s->value_type == list_type && s->value->int32_list)
+  {
+    count = is_dbl ? (int)s->value->dbl_list[0] : s->value->int32_list[0];
 
-      if(!error && old_list)
+    /* fits into the present memory */
+    if(n + 1 <= OY_MAX( s->value_capacity, count + 1 ))
+    {
+      if(n > count)
       {
-        memcpy( s->value->int32_list, old_list,
-                (old_list[0] + 1) * sizeof(uint32_t) );
-        s->oy_->deallocateFunc_( old_list ); old_list = 0;
+        memset( (char*)s->value->int32_list + (count + 1) * size, 0,
+                (n - count) * size );
+        if(is_dbl)
+          s->value->dbl_list[0] = n;
+        else
+          s->value->int32_list[0] = n;
       }
+      return error;
+    }
+  }
 
-      if(!error && old_int)
-        s->value->int32_list[1] = old_int;
+  capacity = n + 1;
+  if(count)
+    capacity = OY_MAX( capacity, 2 * (count + 1) );
 
-      s->value_type = oyVAL_INT_LIST;
-      s->value->int32_list[0] = pos + 1;
-    }
+  list = (char*) oyStruct_Allocate( (oyStruct_s*) s, capacity * size );
+  if(!list)
+    return 1;
+  memset( list, 0, capacity * size );
 
-    if(s->value_type == oyVAL_INT)
-      s->value->int32 = integer;
-    else
-      s->value->int32_list[pos+1] = integer;
+  if(count)
+  {
+    memcpy( list, s->value->int32_list, (count + 1) * size );
+    s->oy_->deallocateFunc_( s->value->int32_list );
+  }
+  else if(s->value_type == oyVAL_INT && !is_dbl)
+  {
+    ((int32_t*)list)[1] = s->value->int32;
+    count = 1;
+  }
+  else if(s->value_type == oyVAL_DOUBLE && is_dbl)
+  {
+    ((double*)list)[1] = s->value->dbl;
+    count = 1;
+  }
+  else
+    oyValueClear( s->value, s->value_type, s->oy_->deallocateFunc_ );
 
-    s->flags |= oyOPTIONATTRIBUTE_EDIT;
-    oyStruct_ObserverSignal( (oyStruct_s*)obj, oySIGNAL_DATA_CHANGED, 0 );
+  if(n < count)
+    n = count;
+  if(is_dbl)
+  {
+    s->value->dbl_list = (double*) list;
+    s->value->dbl_list[0] = n;
+  } else
+  {
+    s->value->int32_list = (int32_t*) list;
+    s->value->int32_list[0] = n;
   }
+  s->value_type = list_type;
+  s->value_capacity = capacity;
 
   return error;
 }
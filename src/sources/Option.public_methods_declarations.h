@@ -35,6 +35,39 @@ OYAPI int  OYEXPORT
 OYAPI double  OYEXPORT
                  oyOption_GetValueDouble(oyOption_s        * obj,
                                        int                 pos );
+OYAPI int  OYEXPORT
+                 oyOption_SetFromInts( oyOption_s        * obj,
+                                       const int32_t     * values,
+                                       int                 count,
+                                       int                 pos,
+                                       uint32_t            flags );
+OYAPI int  OYEXPORT
+                 oyOption_GetValueInts(oyOption_s        * obj,
+                                       int32_t           * values,
+                                       int                 count,
+                                       int                 pos );
+OYAPI int  OYEXPORT
+                 oyOption_MoveInInts ( oyOption_s        * obj,
+                                       int32_t          ** list,
+                                       int                 count );
+OYAPI int  OYEXPORT
+                 oyOption_SetFromDoubles (
+                                       oyOption_s        * obj,
+                                       const double      * values,
+                                       int                 count,
+                                       int                 pos,
+                                       uint32_t            flags );
+OYAPI int  OYEXPORT
+                 oyOption_GetValueDoubles (
+                                       oyOption_s        * obj,
+                                       double            * values,
+                                       int                 count,
+                                       int                 pos );
+OYAPI int  OYEXPORT
+                 oyOption_MoveInDoubles (
+                                       oyOption_s        * obj,
+                                       double           ** list,
+                                       int                 count );
 OYAPI int  OYEXPORT
                  oyOption_Clear      ( oyOption_s        * s );
 OYAPI int  OYEXPORT
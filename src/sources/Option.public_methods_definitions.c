@@ -502,32 +502,10 @@ int            oyOption_SetFromDouble( oyOption_s        * obj,
        (s->value_type != oyVAL_DOUBLE_LIST ||
         (s->value_type == oyVAL_DOUBLE_LIST &&
          (!s->value->dbl_list || pos >= s->value->dbl_list[0]))))
-    {
-      double * old_list = 0,
-               old_int = 0;
-
-      if(s->value_type == oyVAL_DOUBLE_LIST)
-        old_list = s->value->dbl_list;
-      if(s->value_type == oyVAL_DOUBLE)
-        old_int = s->value->dbl;
-
-      s->value->dbl_list = 0;
-      oyStruct_AllocHelper_m_( s->value->dbl_list, double, pos + 2,
-                               s, error = 1 );
+      error = oyOption_ListReserve_( s, oyVAL_DOUBLE_LIST, pos + 1 );
 
-      if(!error && old_list)
-      {
-        memcpy( s->value->dbl_list, old_list,
-                (old_list[0] + 1) * sizeof(double) );
-        s->oy_->deallocateFunc_( old_list ); old_list = 0;
-      }
-
-      if(!error && old_int)
-        s->value->dbl_list[1] = old_int;
-
-      s->value_type = oyVAL_DOUBLE_LIST;
-      s->value->dbl_list[0] = pos + 1;
-    }
+    if(error)
+      return error;
 
     if(s->value_type == oyVAL_DOUBLE)
       s->value->dbl = floating_point;
@@ -590,6 +568,306 @@ double         oyOption_GetValueDouble(oyOption_s        * obj,
   return result;
 }
 
+/** Function oyOption_SetFromInts
+ *  @memberof oyOption_s
+ *  @brief   set a range of int32_t values
+ *
+ *  The list grows as needed and observers get one change signal for all
+ *  values. Use it instead of calling oyOption_SetFromInt() in a loop.
+ *  A single value at position 0 is stored like with
+ *  oyOption_SetFromInt().
+ *
+ *  @param[in,out] obj                 the option
+ *  @param[in]     values              count values
+ *  @param         count               number of values
+ *  @param         pos                 list position of the first value
+ *  @param         flags               unused
+ *  @return                            0 - success, 1 - error
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2026/10/19
+ *  @since   2026/10/19 (Oyranos: 0.9.7)
+ */
+int            oyOption_SetFromInts  ( oyOption_s        * obj,
+                                       const int32_t     * values,
+                                       int                 count,
+                                       int                 pos,
+                                       uint32_t            flags )
+{
+  int error = !obj || !values || count <= 0 || pos < 0;
+  oyOption_s_ * s = (oyOption_s_*)obj;
+
+  if(!s)
+    return 1;
+
+  oyCheckType__m( oyOBJECT_OPTION_S, return 1 )
+
+  if(error)
+    return error;
+
+  if(pos == 0 && count == 1 && s->value_type != oyVAL_INT_LIST)
+    return oyOption_SetFromInt( obj, values[0], 0, flags );
+
+  error = oyOption_ListReserve_( s, oyVAL_INT_LIST, pos + count );
+  if(!error)
+  {
+    memcpy( &s->value->int32_list[pos + 1], values, count * sizeof(int32_t) );
+
+    s->flags |= oyOPTIONATTRIBUTE_EDIT;
+    oyStruct_ObserverSignal( (oyStruct_s*)s, oySIGNAL_DATA_CHANGED, 0 );
+
+    oyOption_UpdateFlags_(s);
+  }
+
+  return error;
+}
+
+/** Function oyOption_GetValueInts
+ *  @memberof oyOption_s
+ *  @brief   get a range of int32_t values
+ *
+ *  @param[in]     obj                 the option
+ *  @param[out]    values              space for count values
+ *  @param         count               number of requested values
+ *  @param         pos                 list position of the first value
+ *  @return                            number of copied values
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2026/10/19
+ *  @since   2026/10/19 (Oyranos: 0.9.7)
+ */
+int            oyOption_GetValueInts ( oyOption_s        * obj,
+                                       int32_t           * values,
+                                       int                 count,
+                                       int                 pos )
+{
+  oyOption_s_ * s = (oyOption_s_*)obj;
+  int n = 0;
+
+  if(!s || !values || count <= 0 || pos < 0)
+    return 0;
+
+  oyCheckType__m( oyOBJECT_OPTION_S, return 0 )
+
+  if( s->value_type == oyVAL_INT_LIST &&
+      s->value->int32_list )
+  {
+    n = s->value->int32_list[0] - pos;
+    if(n > count)
+      n = count;
+    if(n > 0)
+      memcpy( values, &s->value->int32_list[pos + 1], n * sizeof(int32_t) );
+  }
+  else if(s->value_type == oyVAL_INT && pos == 0)
+  {
+    values[0] = s->value->int32;
+    n = 1;
+  }
+
+  return n > 0 ? n : 0;
+}
+
+/** Function oyOption_MoveInInts
+ *  @memberof oyOption_s
+ *  @brief   take over a int32_t list without copying
+ *
+ *  The list must be allocated with the allocator of the options object,
+ *  typically oyAllocateFunc_(), and hold count + 1 int32_t values. The values
+ *  start at list[1]; list[0] is set to count. The option owns the memory
+ *  afterwards and *list is set to zero.
+ *
+ *  @param[in,out] obj                 the option
+ *  @param[in,out] list                the list to move in
+ *  @param         count               number of values in the list
+ *  @return                            0 - success, 1 - error
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2026/10/19
+ *  @since   2026/10/19 (Oyranos: 0.9.7)
+ */
+int            oyOption_MoveInInts   ( oyOption_s        * obj,
+                                       int32_t          ** list,
+                                       int                 count )
+{
+  oyOption_s_ * s = (oyOption_s_*)obj;
+  int error = !s || !list || !*list || count < 0;
+
+  if(!s)
+    return 1;
+
+  oyCheckType__m( oyOBJECT_OPTION_S, return 1 )
+
+  if(error)
+    return error;
+
+  if(s->value)
+    oyValueClear( s->value, s->value_type, s->oy_->deallocateFunc_ );
+  else
+    oyStruct_AllocHelper_m_( s->value, oyValue_u, 1, s, return 1 );
+
+  s->value->int32_list = *list; *list = NULL;
+  s->value->int32_list[0] = count;
+  s->value_type = oyVAL_INT_LIST;
+  s->value_capacity = count + 1;
+
+  s->flags |= oyOPTIONATTRIBUTE_EDIT;
+  oyStruct_ObserverSignal( (oyStruct_s*)s, oySIGNAL_DATA_CHANGED, 0 );
+
+  oyOption_UpdateFlags_(s);
+
+  return error;
+}
+
+/** Function oyOption_SetFromDoubles
+ *  @memberof oyOption_s
+ *  @brief   set a range of double values
+ *
+ *  The list grows as needed and observers get one change signal for all
+ *  values. Use it instead of calling oyOption_SetFromDouble() in a loop.
+ *  A single value at position 0 is stored like with
+ *  oyOption_SetFromDouble().
+ *
+ *  @param[in,out] obj                 the option
+ *  @param[in]     values              count values
+ *  @param         count               number of values
+ *  @param         pos                 list position of the first value
+ *  @param         flags               unused
+ *  @return                            0 - success, 1 - error
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2026/10/19
+ *  @since   2026/10/19 (Oyranos: 0.9.7)
+ */
+int            oyOption_SetFromDoubles(oyOption_s        * obj,
+                                       const double      * values,
+                                       int                 count,
+                                       int                 pos,
+                                       uint32_t            flags )
+{
+  int error = !obj || !values || count <= 0 || pos < 0;
+  oyOption_s_ * s = (oyOption_s_*)obj;
+
+  if(!s)
+    return 1;
+
+  oyCheckType__m( oyOBJECT_OPTION_S, return 1 )
+
+  if(error)
+    return error;
+
+  if(pos == 0 && count == 1 && s->value_type != oyVAL_DOUBLE_LIST)
+    return oyOption_SetFromDouble( obj, values[0], 0, flags );
+
+  error = oyOption_ListReserve_( s, oyVAL_DOUBLE_LIST, pos + count );
+  if(!error)
+  {
+    memcpy( &s->value->dbl_list[pos + 1], values, count * sizeof(double) );
+
+    s->flags |= oyOPTIONATTRIBUTE_EDIT;
+    oyStruct_ObserverSignal( (oyStruct_s*)s, oySIGNAL_DATA_CHANGED, 0 );
+
+    oyOption_UpdateFlags_(s);
+  }
+
+  return error;
+}
+
+/** Function oyOption_GetValueDoubles
+ *  @memberof oyOption_s
+ *  @brief   get a range of doubles
+ *
+ *  @param[in]     obj                 the option
+ *  @param[out]    values              space for count values
+ *  @param         count               number of requested values
+ *  @param         pos                 list position of the first value
+ *  @return                            number of copied values
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2026/10/19
+ *  @since   2026/10/19 (Oyranos: 0.9.7)
+ */
+int            oyOption_GetValueDoubles(oyOption_s       * obj,
+                                       double            * values,
+                                       int                 count,
+                                       int                 pos )
+{
+  oyOption_s_ * s = (oyOption_s_*)obj;
+  int n = 0;
+
+  if(!s || !values || count <= 0 || pos < 0)
+    return 0;
+
+  oyCheckType__m( oyOBJECT_OPTION_S, return 0 )
+
+  if( s->value_type == oyVAL_DOUBLE_LIST &&
+      s->value->dbl_list )
+  {
+    n = (int)s->value->dbl_list[0] - pos;
+    if(n > count)
+      n = count;
+    if(n > 0)
+      memcpy( values, &s->value->dbl_list[pos + 1], n * sizeof(double) );
+  }
+  else if(s->value_type == oyVAL_DOUBLE && pos == 0)
+  {
+    values[0] = s->value->dbl;
+    n = 1;
+  }
+
+  return n > 0 ? n : 0;
+}
+
+/** Function oyOption_MoveInDoubles
+ *  @memberof oyOption_s
+ *  @brief   take over a double list without copying
+ *
+ *  The list must be allocated with the allocator of the options object,
+ *  typically oyAllocateFunc_(), and hold count + 1 doubles. The values
+ *  start at list[1]; list[0] is set to count. The option owns the memory
+ *  afterwards and *list is set to zero.
+ *
+ *  @param[in,out] obj                 the option
+ *  @param[in,out] list                the list to move in
+ *  @param         count               number of values in the list
+ *  @return                            0 - success, 1 - error
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2026/10/19
+ *  @since   2026/10/19 (Oyranos: 0.9.7)
+ */
+int            oyOption_MoveInDoubles( oyOption_s        * obj,
+                                       double           ** list,
+                                       int                 count )
+{
+  oyOption_s_ * s = (oyOption_s_*)obj;
+  int error = !s || !list || !*list || count < 0;
+
+  if(!s)
+    return 1;
+
+  oyCheckType__m( oyOBJECT_OPTION_S, return 1 )
+
+  if(error)
+    return error;
+
+  if(s->value)
+    oyValueClear( s->value, s->value_type, s->oy_->deallocateFunc_ );
+  else
+    oyStruct_AllocHelper_m_( s->value, oyValue_u, 1, s, return 1 );
+
+  s->value->dbl_list = *list; *list = NULL;
+  s->value->dbl_list[0] = count;
+  s->value_type = oyVAL_DOUBLE_LIST;
+  s->value_capacity = count + 1;
+
+  s->flags |= oyOPTIONATTRIBUTE_EDIT;
+  oyStruct_ObserverSignal( (oyStruct_s*)s, oySIGNAL_DATA_CHANGED, 0 );
+
+  oyOption_UpdateFlags_(s);
+
+  return error;
+}
+
 /** Function oyOption_Clear
  *  @memberof oyOption_s
  *  @brief   clear a option
@@ -617,6 +895,7 @@ int            oyOption_Clear        ( oyOption_s        * obj )
     oyValueRelease( &s->value, s->value_type, deallocateFunc );
 
     s->value_type = oyVAL_NONE;
+    s->value_capacity = 0;
 
     if(s->registration)
       deallocateFunc( s->registration );
@@ -114,11 +114,14 @@ int oyProfile_Copy__Members( oyProfile_s_ * dst, oyProfile_s_ * src)
       error = !memcpy( dst->block_, src->block_, src->size_ );
       if(error) { WARNc_S("Unable to copy CMM name"); }
     }
+    dst->probe_ = src->probe_;
   }
 
   if(error <= 0)
   {
-    if(!oyProfile_Hashed_(dst))
+    /* a probe without ID is hashed after oyProfile_Load_() */
+    if(!oyProfile_Hashed_(dst) &&
+       !(dst->probe_ && !oyProfile_HasID_(dst)))
       error = oyProfile_GetHash_( dst, 0 );
   }
 
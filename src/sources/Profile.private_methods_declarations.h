@@ -6,6 +6,11 @@ oyProfile_s_* oyProfile_FromMemMove_  ( size_t              size,
 oyProfile_s_ *  oyProfile_FromFile_  ( const char        * name,
                                        uint32_t            flags,
                                        oyObject_s          object );
+int          oyProfile_ProbeHasTag_  ( icTagSignature      sig );
+oyProfile_s_ *  oyProfile_FromFileProbe_( const char      * file_name,
+                                       uint32_t            flags,
+                                       oyObject_s          object );
+int          oyProfile_Load_         ( oyProfile_s_      * profile );
 oyPointer    oyProfile_TagsToMem_    ( oyProfile_s_      * profile,
                                        size_t            * size,
                                        oyAlloc_f           allocateFunc );
@@ -27,11 +27,12 @@ int oyProfile_HasID_          ( oyProfile_s_      * s )
  *  @memberof oyProfile_s
  *  @brief   hash for oyProfile_s
  *
- *  Get ICC ID from profile or compute.
+ *  Get ICC ID from profile or compute. A probe is loaded completely for
+ *  computing.
  +
- *  @version Oyranos: 0.3.0
+ *  @version Oyranos: 0.9.7
  *  @since   2007/11/0 (Oyranos: 0.1.8)
- *  @date    2011/04/10
+ *  @date    2026/10/19
  */
 int oyProfile_GetHash_               ( oyProfile_s_      * s,
                                        int                 flags )
@@ -40,6 +41,9 @@ int oyProfile_GetHash_               ( oyProfile_s_      * s,
 
   oyCheckType__m( oyOBJECT_PROFILE_S, return 1 )
 
+  if(s->probe_ && (flags & OY_COMPUTE || !oyProfile_HasID_( s )))
+    oyProfile_Load_( s );
+
   if(s->block_ && s->size_)
   {
     int has_id = oyProfile_HasID_( s );
@@ -84,12 +88,12 @@ int oyProfile_GetHash_               ( oyProfile_s_      * s,
  *
  *  @param[in]    size           buffer size
  *  @param[in]    block          pointer to memory containing a profile
- *  @param[in]    flags          pass through
+ *  @param[in]    flags          pass through; OY_PROBE marks a probe block
  *  @param[out]   error_return   error codes
  *  @param[in]    object         the optional base
  *
- *  @version Oyranos: 0.9.6
- *  @date    2015/08/03
+ *  @version Oyranos: 0.9.7
+ *  @date    2026/10/19
  *  @since   2007/11/00 (Oyranos: 0.1.8)
  */
 oyProfile_s_* oyProfile_FromMemMove_  ( size_t              size,
@@ -108,6 +112,8 @@ oyProfile_s_* oyProfile_FromMemMove_  ( size_t              size,
   {
     s->block_ = *block;
     *block = 0;
+    if(flags & OY_PROBE)
+      s->probe_ = 1;
 
     if(size > 128)
     {
@@ -153,7 +159,8 @@ oyProfile_s_* oyProfile_FromMemMove_  ( size_t              size,
        - A higher level API can maintain its own cache depending on costs.
    */
 
-  if(error <= 0)
+  /* a probe without ID is hashed after oyProfile_Load_() */
+  if(error <= 0 && !(s->probe_ && !oyProfile_HasID_( s )))
   {
     l_error = oyProfile_GetHash_( s, flags );
     if(l_error != 0)
@@ -209,6 +216,239 @@ oyProfile_s_* oyProfile_FromMemMove_  ( size_t              size,
   return s;
 }
 
+/** @internal
+ *  Tags copied into a probe. The probe tag table stays authoritative for
+ *  these signatures; any other tag request loads the full profile.
+ */
+static const char * oy_profile_probe_tags_[] = {"desc","dscm","meta","dmnd","dmdd",NULL};
+
+/** @internal
+ *  Function  oyProfile_ProbeHasTag_
+ *  @memberof oyProfile_s
+ *  @brief    check if a tag signature is covered by a probe
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2026/10/19
+ *  @since   2026/10/19 (Oyranos: 0.9.7)
+ */
+int          oyProfile_ProbeHasTag_  ( icTagSignature      sig )
+{
+  int i;
+  for(i = 0; oy_profile_probe_tags_[i]; ++i)
+  {
+    uint32_t probe_sig;
+    memcpy( &probe_sig, oy_profile_probe_tags_[i], 4 );
+    if((uint32_t)sig == oyValueUInt32( probe_sig ))
+      return 1;
+  }
+  return 0;
+}
+
+#if defined(HAVE_POSIX) && !defined(_WIN32)
+#define OY_PROBE_PREAD 1
+#endif
+
+#ifdef OY_PROBE_PREAD
+typedef int oyProbeFile_t;
+#define oyProbeOpen_m(name) open( name, O_RDONLY )
+#define oyProbeValid_m(f) ((f) >= 0)
+#define oyProbeClose_m(f) close( f )
+#else
+typedef FILE * oyProbeFile_t;
+#define oyProbeOpen_m(name) fopen( name, "rb" )
+#define oyProbeValid_m(f) ((f) != NULL)
+#define oyProbeClose_m(f) fclose( f )
+#endif
+
+/* read size bytes at offset; returns zero on success */
+static int   oyProfileProbeRead_     ( oyProbeFile_t       f,
+                                       size_t              offset,
+                                       size_t              size,
+                                       void              * dst )
+{
+#ifdef OY_PROBE_PREAD
+  return pread( f, dst, size, (off_t)offset ) != (ssize_t)size;
+#else
+  return fseek( f, (long)offset, SEEK_SET ) != 0 ||
+         fread( dst, 1, size, f ) != size;
+#endif
+}
+
+/** @internal
+ *  Function  oyProfile_FromFileProbe_
+ *  @memberof oyProfile_s
+ *  @brief    Create a probe from file
+ *
+ *  Only the 128 byte header, the tag table and the tags listed in
+ *  oy_profile_probe_tags_ are read. They are placed into a compact ICC
+ *  block with rewritten tag offsets, while the header stays unchanged.
+ *  The resulting object is marked as probe and oyProfile_Load_() reads
+ *  the full profile on request. Profiles, which can not be probed, are
+ *  loaded completely.
+ *
+ *  @param[in]    file_name      full file name
+ *  @param[in]    flags          OY_ICC_VERSION_2, OY_ICC_VERSION_4
+ *  @param[in]    object         the optional base
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2026/10/19
+ *  @since   2026/10/19 (Oyranos: 0.9.7)
+ */
+oyProfile_s_ *  oyProfile_FromFileProbe_( const char      * file_name,
+                                       uint32_t            flags,
+                                       oyObject_s          object )
+{
+  oyProfile_s_ * s = NULL;
+  oyProbeFile_t f;
+  char head[132];
+  icTag * list = NULL, * entries = NULL;
+  uint32_t count = 0, kept = 0, file_size = 0, i;
+  size_t size = 0, pos;
+  char * block = NULL;
+  int error = !file_name;
+
+  if(error)
+    return NULL;
+
+  f = oyProbeOpen_m( file_name );
+  if(!oyProbeValid_m(f))
+    return NULL;
+
+  error = oyProfileProbeRead_( f, 0, 132, head );
+  if(!error)
+  {
+    icHeader * h = (icHeader*) head;
+    file_size = oyValueUInt32( h->size );
+    count = oyValueUInt32( ((icProfile*)head)->count );
+    error = oyValueUInt32( h->magic ) != icMagicNumber ||
+            file_size < 132 ||
+            (size_t)count * sizeof(icTag) > file_size - 132;
+  }
+
+  if(!error && count)
+  {
+    list = oyAllocateFunc_( count * sizeof(icTag) );
+    entries = oyAllocateFunc_( count * sizeof(icTag) );
+    error = !list || !entries ||
+            oyProfileProbeRead_( f, 132, count * sizeof(icTag), list );
+  }
+
+  /* select the probe tags and compute the compact block size */
+  size = 132;
+  for(i = 0; !error && i < count; ++i)
+  {
+    uint32_t offset = oyValueUInt32( list[i].offset ),
+             tag_size = oyValueUInt32( list[i].size );
+    if(!oyProfile_ProbeHasTag_( oyValueUInt32( list[i].sig ) ))
+      continue;
+    if((size_t)offset + tag_size > file_size)
+      continue;
+    entries[kept++] = list[i];
+    size += sizeof(icTag) + ((tag_size + 3) & ~3u);
+  }
+
+  if(!error)
+  {
+    block = oyAllocateFunc_( size );
+    error = !block;
+  }
+
+  if(!error)
+  {
+    icTag * table = (icTag*)&block[132];
+
+    memset( block, 0, size );
+    memcpy( block, head, 128 );
+    ((icProfile*)block)->count = oyValueUInt32( kept );
+
+    pos = 132 + kept * sizeof(icTag);
+    for(i = 0; !error && i < kept; ++i)
+    {
+      uint32_t offset = oyValueUInt32( entries[i].offset ),
+               tag_size = oyValueUInt32( entries[i].size );
+
+      error = oyProfileProbeRead_( f, offset, tag_size, &block[pos] );
+      table[i].sig = entries[i].sig;
+      table[i].offset = oyValueUInt32( (uint32_t)pos );
+      table[i].size = entries[i].size;
+      pos += (tag_size + 3) & ~3u;
+    }
+  }
+
+  oyProbeClose_m( f );
+  if(list) oyDeAllocateFunc_( list );
+  if(entries) oyDeAllocateFunc_( entries );
+
+  if(!error)
+  {
+    int l_error = 0;
+    s = oyProfile_FromMemMove_( size, (oyPointer*)&block,
+                                (int)((flags | OY_PROBE) & ~OY_COMPUTE),
+                                &l_error, object );
+    if(s)
+      s->file_name_ = oyStringCopy_( file_name, s->oy_->allocateFunc_ );
+  }
+  if(block) oyDeAllocateFunc_( block );
+
+  if(error)
+  {
+    DBG_PROG1_S( "probe failed, load completely: %s", file_name )
+    s = oyProfile_FromFile_( file_name, flags & ~OY_PROBE, object );
+  }
+
+  return s;
+}
+
+/** @internal
+ *  Function  oyProfile_Load_
+ *  @memberof oyProfile_s
+ *  @brief    Replace a probe by the full profile
+ *
+ *  The full file is read into the existing object. The tag list is
+ *  cleared and parsed again on request. Objects, which are no probes,
+ *  stay untouched.
+ *
+ *  @param[in,out] profile       the profile
+ *  @return                      0 - success, >= 1 - error
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2026/10/19
+ *  @since   2026/10/19 (Oyranos: 0.9.7)
+ */
+int          oyProfile_Load_         ( oyProfile_s_      * profile )
+{
+  oyProfile_s_ * s = profile;
+  oyPointer block = NULL;
+  size_t size = 0;
+  int error = 0;
+
+  if(!s || !s->probe_)
+    return 0;
+
+  oyObject_Lock( s->oy_, __FILE__, __LINE__ );
+  if(s->probe_)
+  {
+    block = oyGetProfileBlock_( s->file_name_, &size, s->oy_->allocateFunc_ );
+    error = !block || size < 132 || oyCheckProfileMem_( block, 128, 0, 0 );
+    if(!error)
+    {
+      if(s->block_)
+        s->oy_->deallocateFunc_( s->block_ );
+      s->block_ = block; block = NULL;
+      s->size_ = size;
+      if(s->tags_)
+        oyStructList_Clear( s->tags_ );
+      s->probe_ = 0;
+    } else
+      WARNc1_S( "could not load: %s", oyNoEmptyString_m_(s->file_name_) )
+    if(block)
+      s->oy_->deallocateFunc_( block );
+  }
+  oyObject_UnLock( s->oy_, __FILE__, __LINE__ );
+
+  return error;
+}
+
 #ifdef COMPILE_STATIC
 #include "Gray-CIE_L.h"
 #include "ISOcoated_v2_bas.h"
@@ -219,6 +459,32 @@ oyProfile_s_* oyProfile_FromMemMove_  ( size_t              size,
 #include "XYZ.h"
 #endif
 
+/* The cross process cache outlives this process. So its key names the
+ * file by path, size, inode and modification time, even with
+ * OY_SKIP_MTIME_CHECK for the in process cache. */
+static oyHash_s * oyProfileSharedCacheEntry_ ( const char * file_name )
+{
+#ifdef HAVE_POSIX
+  struct stat st;
+  char * key = NULL;
+  oyHash_s * entry;
+
+  if(!file_name || stat( file_name, &st ) != 0)
+    return NULL;
+
+  oyStringAddPrintf( &key, oyAllocateFunc_, oyDeAllocateFunc_,
+                     "oyProfile_FromFile_:%s:%lld:%llu:%lld", file_name,
+                     (long long)st.st_size, (unsigned long long)st.st_ino,
+                     (long long)st.st_mtime );
+  entry = oyHash_Create( key, NULL );
+  oyFree_m_( key );
+  return entry;
+#else
+  (void)file_name;
+  return NULL;
+#endif
+}
+
 /** @internal
  *  Function  oyProfile_FromFile_
  *  @memberof oyProfile_s
@@ -303,7 +569,17 @@ oyProfile_s_ *  oyProfile_FromFile_  ( const char        * name,
   {
     if(!file_name)
       file_name = oyFindProfile_( name, flags );
-    block = oyGetProfileBlock( file_name, &size, allocateFunc );
+    /* 3a. ask other processes on this host */
+    oyHash_s * shared = entry ? oyProfileSharedCacheEntry_( file_name ) : NULL;
+    if(shared && !oyToNoCacheRead_m(flags))
+      oySharedCacheGet_( shared, oySHARED_CACHE_PROFILE, &size, &block, allocateFunc );
+    if(!block)
+    {
+      block = oyGetProfileBlock( file_name, &size, allocateFunc );
+      if(block && size && shared && !oyToNoCacheWrite_m(flags))
+        oySharedCacheSet_( shared, oySHARED_CACHE_PROFILE, block, size );
+    }
+    oyHash_Release( &shared );
     if(!block || !size)
       error = 1;
   }
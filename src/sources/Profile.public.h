@@ -15,4 +15,5 @@
 #define OY_NO_REPAIR     0x80                   /**< do not try to repair or fix profiles */
 #define OY_NO_LOAD       0x100                  /**< do not load profile, create fragment */
 #define OY_SKIP_MTIME_CHECK 0x200               /**< ignore checking time stamp; old bahaviour for faster caching */
+#define OY_PROBE         0x400                  /**< read only header, tag table and text tags; load fully on request */
 /** @} *//* objects_profile */
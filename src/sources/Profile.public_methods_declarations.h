@@ -76,6 +76,10 @@ OYAPI oyProfileTag_s * OYEXPORT
 OYAPI oyProfileTag_s * OYEXPORT
                 oyProfile_GetTagById ( oyProfile_s    * profile,
                                        icTagSignature      id );
+OYAPI int OYEXPORT
+                 oyProfile_GetTagView( oyProfile_s       * profile,
+                                       icTagSignature      id,
+                                       oyICCTagView_s    * view );
 OYAPI int OYEXPORT
                    oyProfile_GetTagCount( oyProfile_s    * profile );
 OYAPI int OYEXPORT
@@ -336,9 +336,12 @@ OYAPI oyProfile_s * OYEXPORT oyProfile_FromName (
  *    after that the string is taken as value. A star '*', at begin or end, is kept in the profile
  *    name property for following sub string matching, but it is removed from the value string.
  *  - ::OY_SKIP_MTIME_CHECK ignore checking time stamp; old bahaviour for faster caching 
+ *  - ::OY_PROBE read only header, tag table and description and device
+ *    tags; the caches are bypassed; the profile is loaded completely, when
+ *    its memory, a other tag or a computed ID are requested
  *
  *  @version Oyranos: 0.9.7
- *  @date    2019/06/03
+ *  @date    2026/10/19
  *  @since   2007/11/0 (Oyranos: 0.1.9)
  */
 OYAPI oyProfile_s * OYEXPORT
@@ -420,6 +423,21 @@ oyProfile_FromFile            ( const char      * name,
     return (oyProfile_s*)s;
   }
 
+  if(flags & OY_PROBE)
+  {
+    char * file_name = oyFindProfile_( name, flags );
+
+    if(file_name)
+    {
+      s = oyProfile_FromFileProbe_( file_name, flags, object );
+      oyFree_m_( file_name );
+    }
+    /* without ID the name would need a fully loaded profile */
+    if(s && oyProfile_Hashed_( s ))
+      oyProfile_GetID( (oyProfile_s*)s );
+    return (oyProfile_s*)s;
+  }
+
   s = oyProfile_FromFile_( name, flags, object );
 
   if(flags & OY_COMPUTE)
@@ -1552,6 +1570,9 @@ OYAPI oyPointer OYEXPORT
   if(s)
     oyObject_Lock( s->oy_, __FILE__, __LINE__ );
 
+  if(error <= 0 && s->probe_)
+    error = oyProfile_Load_( s );
+
   if(error <= 0 && s->type_ == oyOBJECT_PROFILE_S)
   {
     if(s->size_ && s->block_ && !s->tags_modified_)
@@ -1627,6 +1648,9 @@ OYAPI size_t OYEXPORT
 
   oyCheckType__m( oyOBJECT_PROFILE_S, return 0 )
 
+  if(error <= 0 && s->probe_)
+    error = oyProfile_Load_( s );
+
   if(error <= 0 && s->type_ == oyOBJECT_PROFILE_S)
   {
     if(s->size_ && s->block_ && !s->tags_modified_)
@@ -1671,6 +1695,9 @@ OYAPI oyProfileTag_s * OYEXPORT
   if(s)
     oyObject_Lock( s->oy_, __FILE__, __LINE__ );
 
+  if(s->probe_)
+    oyProfile_Load_( s );
+
   tag = oyProfile_GetTagByPos_( s, pos );
 
   if(s)
@@ -1683,11 +1710,15 @@ OYAPI oyProfileTag_s * OYEXPORT
  *  @memberof oyProfile_s
  *  @brief    Get a profile tag by its tag signature
  *
+ *  A ::OY_PROBE profile is loaded completely, if the tag is not covered
+ *  by the probe.
+ *
  *  @param[in]     profile             the profile
  *  @param[in]     id                  icTagSignature
  *
- *  @since Oyranos: version 0.1.8
- *  @date  2 january 2008 (API 0.1.8)
+ *  @version Oyranos: 0.9.7
+ *  @date    2026/10/19
+ *  @since   2008/01/02 (Oyranos: 0.1.8)
  */
 OYAPI oyProfileTag_s * OYEXPORT
                  oyProfile_GetTagById( oyProfile_s       * profile,
@@ -1729,9 +1760,67 @@ OYAPI oyProfileTag_s * OYEXPORT
     oyObject_UnLock( s->oy_, __FILE__, __LINE__ );
   }
 
+  /* a probe knows only about its text tags */
+  if(!tag && s->probe_ && !oyProfile_ProbeHasTag_( id ) &&
+     oyProfile_Load_( s ) == 0)
+    tag = oyProfile_GetTagById( profile, id );
+
   return tag;
 }
 
+/** Function  oyProfile_GetTagView
+ *  @memberof oyProfile_s
+ *  @brief    Get a read only view of a tag inside the profile memory
+ *
+ *  Unlike oyProfile_GetTagById() nothing is copied or allocated. The view
+ *  is decoded with oyICCTagViewGetXYZ(), oyICCTagViewGetCurve(),
+ *  oyICCTagViewGetParametric(), oyICCTagViewGetString() and
+ *  oyICCTagViewGetLut(). It stays valid as long as the profile is
+ *  referenced and unmodified. Modified tag lists have no memory to view.
+ *  A ::OY_PROBE profile is loaded completely for tags outside of the probe,
+ *  which invalidates previous views of that profile.
+ *
+ *  @code
+    oyICCTagView_s view;
+    double XYZ[3];
+    if(oyProfile_GetTagView( p, icSigMediaWhitePointTag, &view ) == 0 &&
+       oyICCTagViewGetXYZ( &view, 0, XYZ ) == 0)
+      printf( "wtpt: %g %g %g\n", XYZ[0], XYZ[1], XYZ[2] );@endcode
+ *
+ *  @param[in]     profile             the profile
+ *  @param[in]     id                  icTagSignature
+ *  @param[out]    view                the tag view
+ *  @return                            0 - success, -1 - not found, 1 - error
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2026/10/19
+ *  @since   2026/10/19 (Oyranos: 0.9.7)
+ */
+OYAPI int OYEXPORT
+                 oyProfile_GetTagView( oyProfile_s       * profile,
+                                       icTagSignature      id,
+                                       oyICCTagView_s    * view )
+{
+  oyProfile_s_ * s = (oyProfile_s_*)profile;
+  int error = !s || !view;
+
+  if(error)
+    return 1;
+
+  oyCheckType__m( oyOBJECT_PROFILE_S, return 1 )
+
+  if(s->probe_ && !oyProfile_ProbeHasTag_( id ))
+    error = oyProfile_Load_( s );
+
+  if(error <= 0 && (s->tags_modified_ || !s->block_))
+    error = 1;
+
+  if(error <= 0)
+    error = oyICCTagViewFromMem( s->block_, s->size_, id, view );
+
+  return error;
+}
+
 /** Function  oyProfile_GetTagCount
  *  @memberof oyProfile_s
  *
@@ -1751,6 +1840,9 @@ OYAPI int OYEXPORT
 
   oyCheckType__m( oyOBJECT_PROFILE_S, return 0 )
 
+  if(error <= 0 && s->probe_)
+    error = oyProfile_Load_( s );
+
   if(error <= 0 && !s->tags_)
     error = 1;
 
@@ -4,6 +4,7 @@
 {{ block.super }}
 #include "oyranos_module_internal.h"
 #include "oyCMMapiFilters_s.h"
+#include "oyConnectorImaging_s.h"
 #include "oyFilterGraph_s.h"
 #include "oyFilterPlug_s_.h"
 #include "oyFilterNode_s_.h"
@@ -11,4 +12,5 @@
 #include "oyImage_s_.h"
 #include "oyCMMapi9_s_.h"
 #include "oyPixelAccess_s_.h"
+#include "oyranos_color.h"
 {% endblock %}
@@ -6,6 +6,7 @@
 #include "oyOptions_s.h"
 #include "oyImage_s.h"
 #include "oyProfile_s.h"
+#include "oyProfiles_s.h"
 #include "oyFilterNode_s.h"
 #include "oyPixelAccess_s.h"
 {% endblock %}
@@ -10,6 +10,7 @@
 #include "oyFilterCore_s_.h"
 #include "oyFilterSocket_s.h"
 #include "oyObserver_s_.h"
+#include "oyObject_s.h"
 {% endblock %}
 
 {% block ChildMembers %}
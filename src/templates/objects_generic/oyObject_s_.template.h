@@ -35,6 +35,7 @@ struct oyObject_s_ {
   int                  version_;       /*!< @private OYRANOS_VERSION */
   unsigned char      * hash_ptr_;      /**< @private 2*OY_HASH_SIZE */
   oyPointer            lock_;          /**< @private the user provided lock */
+  int                  observers_;     /**< @private observers count of a model; 0 - skip signals */
 };
 
 {% block SpecificPrivateMethodsDeclarations %}
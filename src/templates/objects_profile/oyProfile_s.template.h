@@ -2,7 +2,7 @@
 
 {% block GlobalIncludeFiles %}
 {{ block.super }}
-#include <icc34.h>
+#include <oyranos_icc.h>
 {% endblock %}
 
 {% block LocalIncludeFiles %}
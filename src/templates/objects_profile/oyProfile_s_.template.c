@@ -10,6 +10,11 @@
 #include "oyranos_generic_internal.h"
 
 #include <oyjl_macros.h>
+#ifdef HAVE_POSIX
+#include <fcntl.h>      /* open() */
+#include <unistd.h>     /* pread() */
+#include <sys/stat.h>   /* stat() */
+#endif
 {% endblock %}
 
 {% block GlobalIncludeFiles %}
@@ -6,4 +6,9 @@
 #include "oyProfile_s_.h"
 #include "oyProfiles_s_.h"
 #include "oyConfig_s_.h"
+#include "oyranos_threads.h"
+
+#ifdef HAVE_POSIX
+#include <unistd.h> /* usleep() */
+#endif
 {% endblock %}
@@ -1188,9 +1188,9 @@ OYAPI int OYEXPORT oyDeviceProfileFromDB
  *  @param[out]    matched_devices     the devices selected from heap
  *  @return                            error
  *
- *  @version Oyranos: 0.1.10
+ *  @version Oyranos: 0.9.7
+ *  @date    2026/10/19
  *  @since   2009/08/27 (Oyranos: 0.1.10)
- *  @date    2009/08/27
  */
 OYAPI int OYEXPORT oyDeviceSelectSimiliar
                                      ( oyConfig_s        * pattern,
@@ -1201,13 +1201,15 @@ OYAPI int OYEXPORT oyDeviceSelectSimiliar
   oyOption_s * odh = 0,
              * od = 0;
   int error  = !pattern || !matched_devices;
-  char * od_key = 0;
+  char * od_key = 0,
+      ** keys = 0;
   const char * od_val = 0,
-             * odh_val = 0;
+             * odh_val = 0,
+            ** vals = 0;
   oyConfig_s * s = pattern,
              * dh = 0;
   oyConfigs_s * matched = 0;
-  int i,j,n,j_n;
+  int i,j,n,j_n,k_n = 0;
   int match = 1;
 
   oyCheckType__m( oyOBJECT_CONFIG_S, return 1 )
@@ -1238,66 +1240,64 @@ OYAPI int OYEXPORT oyDeviceSelectSimiliar
 
     matched = oyConfigs_New( 0 );
 
-    for(i = 0; i < n; ++i)
+    /* select the compared pattern keys once for all heap devices */
+    j_n = oyConfig_Count( pattern );
+    if(j_n)
     {
-      match = 0;
-      dh = oyConfigs_Get( heap, i );
-
-      j_n = oyConfig_Count( pattern );
-      for(j = 0; j < j_n; ++j)
+      oyAllocHelper_m_( keys, char*, j_n, oyAllocateFunc_, error = 1 );
+      oyAllocHelper_m_( vals, const char*, j_n, oyAllocateFunc_, error = 1 );
+    }
+    for(j = 0; j < j_n && error <= 0; ++j)
+    {
+      od = oyConfig_Get( pattern, j );
+      od_key = oyFilterRegistrationToText( oyOption_GetRegistration(od),
+                                           oyFILTER_REG_MAX, 0);
+      /* the value stays owned by pattern */
+      od_val = oyOption_GetValueString( od, 0 );
+      oyOption_Release( &od );
+
+      if(!od_val ||
+         /* ignore non text options */
+         /* handle selective flags */
+         (flags == 4 &&
+          oyStrcmp_(od_key,"device_name") != 0) ||
+         (flags == 2 &&
+          oyStrcmp_(od_key,"manufacturer") != 0 &&
+          oyStrcmp_(od_key,"model") != 0) ||
+         (flags == 1 &&
+          oyStrcmp_(od_key,"manufacturer") != 0 &&
+          oyStrcmp_(od_key,"model") != 0 &&
+          oyStrcmp_(od_key,"serial") != 0) ||
+         /* ignore a "profile_name" option */
+         oyStrcmp_(od_key,"profile_name") == 0)
       {
-        match = 1;
-        od = oyConfig_Get( pattern, j );
-        od_key = oyFilterRegistrationToText( oyOption_GetRegistration(od),
-                                             oyFILTER_REG_MAX, 0);
-
-        od_val = oyOption_GetValueString( od, 0 );
-        if(!od_val)
-          /* ignore non text options */
-          continue;
+        if(od_key) oyFree_m_( od_key );
+        continue;
+      }
 
-        /* handle selective flags */
-        if(flags == 4 &&
-           oyStrcmp_(od_key,"device_name") != 0
-          )
-          continue;
-        else
-        if(flags == 2 &&
-           oyStrcmp_(od_key,"manufacturer") != 0 &&
-           oyStrcmp_(od_key,"model") != 0
-          )
-          continue;
-        else
-        if(flags == 1 &&
-           oyStrcmp_(od_key,"manufacturer") != 0 &&
-           oyStrcmp_(od_key,"model") != 0 &&
-           oyStrcmp_(od_key,"serial") != 0
-          )
-          continue;
+      keys[k_n] = od_key; od_key = 0;
+      vals[k_n++] = od_val;
+    }
 
-        /* ignore a "profile_name" option */
-        if(oyStrcmp_(od_key,"profile_name") == 0)
-          continue;
+    for(i = 0; i < n && error <= 0; ++i)
+    {
+      dh = oyConfigs_Get( heap, i );
 
-        odh = oyOptions_Find( oyConfigPriv_m(dh)->db, od_key, oyNAME_PATTERN );
+      /* a pattern without options matches nothing */
+      match = j_n > 0;
+      for(j = 0; j < k_n && match; ++j)
+      {
+        odh = oyOptions_Find( oyConfigPriv_m(dh)->db, keys[j], oyNAME_PATTERN );
 
         odh_val = oyOption_GetValueString( odh, 0 );
         if( !odh_val )
           /* ignore non text options */
           match = 0;
 
-        if(match && oyStrcmp_( od_val, odh_val ) != 0)
+        if(match && oyStrcmp_( vals[j], odh_val ) != 0)
           match = 0;
 
-        /*printf("pruefe: %s=%s match = %d flags=%d\n", od_key, od_val, match, flags);*/
-
-
-        oyOption_Release( &od );
-
         oyOption_Release( &odh );
-
-        if(match == 0)
-          break;
       }
 
       if(match)
@@ -1305,6 +1305,9 @@ OYAPI int OYEXPORT oyDeviceSelectSimiliar
       else
         oyConfig_Release( &dh );
     }
+    oyStringListRelease_( &keys, k_n, oyDeAllocateFunc_ );
+    if(vals)
+      oyDeAllocateFunc_( vals );
 
     if(oyConfigs_Count( matched ))
       *matched_devices = matched;
@@ -0,0 +1,600 @@
+/** @file oyranos_bench.c
+ *
+ *  Oyranos is an open source Color Management System
+ *
+ *  @par Copyright:
+ *            2026 (C) Kai-Uwe Behrmann
+ *
+ *  @brief    conversion benchmarks
+ *  @internal
+ *  @author   Kai-Uwe Behrmann <ku.b@gmx.de>
+ *  @par License:
+ *            new BSD <http://www.opensource.org/licenses/BSD-3-Clause>
+ *  @since    2026/10/19
+ *
+ *  The benchmark runs only with the profiles compiled in from extras/icc
+ *  and with profiles created from primaries. They are written into a
+ *  temporary XDG_DATA_HOME, which is the only profile search path during
+ *  the run. Results are printed as JSON for regression tracking:
+ *  @code
+    {"oyranos-bench": {"version": "0.9.7", "mode": "full", "threads": 8,
+      "results": [{"scenario": "profile_load", "variant": "cold",
+                   "iterations": 200, "seconds": 0.02,
+                   "seconds_per_iteration": 0.0001}, ...]}}
+    @endcode
+ *
+ *  Options:
+ *  - -q quick run with small images for CI
+ *  - -o FILE write the JSON to FILE instead of stdout
+ *
+ *  The CMYK scenarios run only with a CMYK profile file set in the
+ *  OY_BENCH_CMYK environment variable.
+ */
+
+#include "oyConversion_s.h"
+#include "oyFilterNode_s.h"
+#include "oyImage_s.h"
+#include "oyArray2d_s.h"
+#include "oyProfile_s.h"
+#include "oyProfiles_s.h"
+#include "oyranos.h"
+#include "oyranos_conversion.h"
+#include "oyranos_helper.h"     /* oyFloatToHalf(), oyMakeDir_() */
+#include "oyranos_i18n.h"
+#include "oyranos_string.h"
+#include "oyjl.h"
+#include "oyranos_version.h"
+
+/* in-tree profiles */
+#include "sRGB.h"
+#include "LStar-RGB.h"
+#include "Lab.h"
+#include "XYZ.h"
+#include "Gray-CIE_L.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+static oyjl_val bench_root = NULL;
+static int      bench_n = 0;
+static int      bench_quick = 0;
+static char     bench_dir[256] = {0};
+static uint32_t icc_profile_flags = 0;
+
+static double      benchSeconds      ( )
+{
+  struct timespec ts;
+  clock_gettime( CLOCK_MONOTONIC, &ts );
+  return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+/* add one result entry and return its index for further fields */
+static int         benchResult       ( const char        * scenario,
+                                       const char        * variant,
+                                       int                 iterations,
+                                       double              seconds )
+{
+  int i = bench_n++;
+  oyjlTreeSetStringF( bench_root, OYJL_CREATE_NEW, scenario,
+                      "oyranos-bench/results/[%d]/scenario", i );
+  oyjlTreeSetStringF( bench_root, OYJL_CREATE_NEW, variant,
+                      "oyranos-bench/results/[%d]/variant", i );
+  oyjlTreeSetIntF( bench_root, OYJL_CREATE_NEW, iterations,
+                   "oyranos-bench/results/[%d]/iterations", i );
+  oyjlTreeSetDoubleF( bench_root, OYJL_CREATE_NEW, seconds,
+                      "oyranos-bench/results/[%d]/seconds", i );
+  oyjlTreeSetDoubleF( bench_root, OYJL_CREATE_NEW,
+                      iterations ? seconds / iterations : 0.0,
+                      "oyranos-bench/results/[%d]/seconds_per_iteration", i );
+  fprintf( stderr, "%-16s %-28s %6d %12.6f s\n", scenario, variant,
+           iterations, iterations ? seconds / iterations : 0.0 );
+  return i;
+}
+
+static char *      benchWriteProfile ( const char        * name,
+                                       const void        * mem,
+                                       size_t              size )
+{
+  char * path = NULL;
+  FILE * fp;
+
+  oyStringAddPrintf( &path, 0,0, "%s/color/icc/%s", bench_dir, name );
+  fp = fopen( path, "wb" );
+  if(fp)
+  {
+    fwrite( mem, 1, size, fp );
+    fclose( fp );
+  } else
+    fprintf( stderr, "could not write %s\n", path );
+
+  return path;
+}
+
+/* the synthetic matrix profile differs by gamma, which gives a new hash */
+static oyProfile_s * benchMatrixProfile ( double         gamma,
+                                       const char        * name )
+{
+  double pandg[9] = { 0.64, 0.33, 0.30, 0.60, 0.15, 0.06, 0.3127, 0.329,
+                      gamma };
+  return oyProfile_FromMatrix( pandg, icc_profile_flags, name );
+}
+
+/* fill with a smooth pattern inside 0.0 - 1.0 for all data types */
+static void        benchFill         ( oyImage_s         * image )
+{
+  oyArray2d_s * a = (oyArray2d_s*) oyImage_GetPixelData( image );
+  oyPixel_t layout = oyImage_GetPixelLayout( image, oyLAYOUT );
+  oyDATATYPE_e type = oyToDataType_m( layout );
+  int samples = oyImage_GetWidth( image ) * oyToChannels_m( layout ),
+      height = oyImage_GetHeight( image ), x, y;
+  char ** rows = (char**) oyArray2d_GetData( a );
+
+  for(y = 0; y < height; ++y)
+    for(x = 0; x < samples; ++x)
+    {
+      float v = ((x * 7 + y * 13) % 256) / 255.0f;
+      switch(type)
+      {
+        case oyUINT8:  ((uint8_t*)rows[y])[x] = v * 255; break;
+        case oyUINT16: ((uint16_t*)rows[y])[x] = v * 65535; break;
+        case oyHALF:   ((uint16_t*)rows[y])[x] = oyFloatToHalf( v ); break;
+        case oyFLOAT:  ((float*)rows[y])[x] = v; break;
+        case oyDOUBLE: ((double*)rows[y])[x] = v; break;
+        default: break;
+      }
+    }
+
+  oyArray2d_Release( &a );
+}
+
+static void        benchProfileLoad  ( const char        * path )
+{
+  int i, n = bench_quick ? 20 : 200;
+  double t;
+  oyProfile_s * p;
+
+  t = benchSeconds();
+  for(i = 0; i < n; ++i)
+  {
+    p = oyProfile_FromFile( path, OY_NO_CACHE_READ | OY_NO_CACHE_WRITE |
+                            icc_profile_flags, NULL );
+    oyProfile_Release( &p );
+  }
+  benchResult( "profile_load", "cold", n, benchSeconds() - t );
+
+  p = oyProfile_FromFile( path, icc_profile_flags, NULL );
+  oyProfile_Release( &p );
+  t = benchSeconds();
+  for(i = 0; i < n; ++i)
+  {
+    p = oyProfile_FromFile( path, icc_profile_flags, NULL );
+    oyProfile_Release( &p );
+  }
+  benchResult( "profile_load", "warm", n, benchSeconds() - t );
+
+  t = benchSeconds();
+  for(i = 0; i < n; ++i)
+  {
+    p = oyProfile_FromMem( _usr_share_color_icc_OpenICC_sRGB_icc_len,
+                           (const oyPointer)_usr_share_color_icc_OpenICC_sRGB_icc,
+                           0, NULL );
+    oyProfile_Release( &p );
+  }
+  benchResult( "profile_load", "memory", n, benchSeconds() - t );
+}
+
+static void        benchProfilesCreate( )
+{
+  int i, n = bench_quick ? 3 : 20, count;
+  double t;
+  oyProfiles_s * ps;
+
+  t = benchSeconds();
+  ps = oyProfiles_Create( NULL, icc_profile_flags, NULL );
+  count = oyProfiles_Count( ps );
+  oyProfiles_Release( &ps );
+  i = benchResult( "profiles_create", "cold", 1, benchSeconds() - t );
+  oyjlTreeSetIntF( bench_root, OYJL_CREATE_NEW, count,
+                   "oyranos-bench/results/[%d]/profiles", i );
+
+  t = benchSeconds();
+  for(i = 0; i < n; ++i)
+  {
+    ps = oyProfiles_Create( NULL, icc_profile_flags, NULL );
+    oyProfiles_Release( &ps );
+  }
+  benchResult( "profiles_create", "warm", n, benchSeconds() - t );
+}
+
+static oyOptions_s * benchOptions    ( int                 intent,
+                                       oyProfile_s       * proof )
+{
+  oyOptions_s * opts = NULL;
+  char num[8];
+
+  sprintf( num, "%d", intent );
+  oyOptions_SetFromString( &opts, "////rendering_intent", num,
+                           OY_CREATE_NEW );
+  if(proof)
+  {
+    oyProfiles_s * ps = oyProfiles_New( NULL );
+    oyProfile_s * p = oyProfile_Copy( proof, NULL );
+    oyProfiles_MoveIn( ps, &p, -1 );
+    oyOptions_SetFromString( &opts, "////proof_soft", "1", OY_CREATE_NEW );
+    oyOptions_MoveInStruct( &opts, OY_PROFILES_SIMULATION,
+                            (oyStruct_s**) &ps, OY_CREATE_NEW );
+  }
+  return opts;
+}
+
+/* create a conversion and run it once on a tiny image */
+static int         benchTransform    ( oyProfile_s       * p_in,
+                                       oyProfile_s       * p_out,
+                                       oyOptions_s       * opts )
+{
+  oyImage_s * in = oyImage_Create( 8, 8, NULL, OY_TYPE_123_16, p_in, NULL ),
+            * out = oyImage_Create( 8, 8, NULL, OY_TYPE_123_16, p_out, NULL );
+  oyConversion_s * cc = oyConversion_CreateBasicPixels( in, out, opts, NULL );
+  int error = cc ? oyConversion_RunPixels( cc, NULL ) : 1;
+
+  oyConversion_Release( &cc );
+  oyImage_Release( &in );
+  oyImage_Release( &out );
+  return error;
+}
+
+static void        benchTransforms   ( oyProfile_s       * p_out,
+                                       oyProfile_s       * proof )
+{
+  const char * names[4] = { "perceptual", "relative", "saturation",
+                            "absolute" };
+  int n = bench_quick ? 3 : 20, intent, proofing, i;
+  char variant[64];
+
+  for(proofing = 0; proofing < 2; ++proofing)
+  for(intent = 0; intent < 4; ++intent)
+  {
+    oyOptions_s * opts = benchOptions( intent, proofing ? proof : NULL );
+    oyProfile_s ** ps = calloc( n, sizeof(oyProfile_s*) );
+    double t;
+
+    /* new profiles avoid the device link cache */
+    for(i = 0; i < n; ++i)
+    {
+      char name[64];
+      sprintf( name, "bench-gamma-%d-%d-%d", proofing, intent, i );
+      ps[i] = benchMatrixProfile( 2.2 + (proofing * 4 * n + intent * n + i) *
+                                  0.0001, name );
+    }
+
+    t = benchSeconds();
+    for(i = 0; i < n; ++i)
+      benchTransform( ps[i], p_out, opts );
+    sprintf( variant, "%s%s/cold", names[intent], proofing ? "+proof" : "" );
+    benchResult( "transform", variant, n, benchSeconds() - t );
+
+    t = benchSeconds();
+    for(i = 0; i < n; ++i)
+      benchTransform( ps[0], p_out, opts );
+    sprintf( variant, "%s%s/warm", names[intent], proofing ? "+proof" : "" );
+    benchResult( "transform", variant, n, benchSeconds() - t );
+
+    for(i = 0; i < n; ++i)
+      oyProfile_Release( &ps[i] );
+    free( ps );
+    oyOptions_Release( &opts );
+  }
+}
+
+static void        benchPixels       ( const char        * space,
+                                       oyProfile_s       * p_in,
+                                       oyProfile_s       * p_out,
+                                       int                 threads )
+{
+  oyDATATYPE_e types[4] = { oyUINT8, oyUINT16, oyHALF, oyFLOAT };
+  const char * type_names[4] = { "uint8", "uint16", "half", "float" };
+  int sizes_full[3] = { 64, 512, 2048 },
+      sizes_quick[2] = { 64, 256 },
+      * sizes = bench_quick ? sizes_quick : sizes_full,
+      sizes_n = bench_quick ? 2 : 3,
+      channels_in = oyProfile_GetChannelsCount( p_in ),
+      channels_out = oyProfile_GetChannelsCount( p_out ),
+      t_i, s_i, i;
+
+#ifdef _OPENMP
+  omp_set_num_threads( threads );
+#endif
+
+  for(t_i = 0; t_i < 4; ++t_i)
+  for(s_i = 0; s_i < sizes_n; ++s_i)
+  {
+    int size = sizes[s_i],
+        n = size >= 2048 ? 3 : size >= 512 ? 10 : 50, error, pos;
+    oyImage_s * in = oyImage_Create( size, size, NULL,
+                           oyChannels_m(channels_in) | oyDataType_m(types[t_i]),
+                                     p_in, NULL ),
+              * out = oyImage_Create( size, size, NULL,
+                          oyChannels_m(channels_out) | oyDataType_m(types[t_i]),
+                                      p_out, NULL );
+    oyConversion_s * cc;
+    char variant[64];
+    double t;
+
+    benchFill( in );
+    cc = oyConversion_CreateBasicPixels( in, out, NULL, NULL );
+    /* prepare the contexts outside of the measurement */
+    error = cc ? oyConversion_RunPixels( cc, NULL ) : 1;
+
+    t = benchSeconds();
+    for(i = 0; i < n && !error; ++i)
+      error = oyConversion_RunPixels( cc, NULL );
+    t = benchSeconds() - t;
+
+    sprintf( variant, "%s/%s/%dx%d/t%d", space, type_names[t_i], size, size,
+             threads );
+    pos = benchResult( "run_pixels", variant, error ? 0 : n, t );
+    oyjlTreeSetDoubleF( bench_root, OYJL_CREATE_NEW,
+                        error || t <= 0 ? 0.0 : size * size * (double)n / t / 1e6,
+                        "oyranos-bench/results/[%d]/megapixel_per_second", pos );
+    oyjlTreeSetIntF( bench_root, OYJL_CREATE_NEW, threads,
+                     "oyranos-bench/results/[%d]/threads", pos );
+    if(error)
+      oyjlTreeSetIntF( bench_root, OYJL_CREATE_NEW, error,
+                       "oyranos-bench/results/[%d]/error", pos );
+
+    oyConversion_Release( &cc );
+    oyImage_Release( &in );
+    oyImage_Release( &out );
+  }
+}
+
+/* root -> filter -> icc -> output, like the image_display pipeline */
+static void        benchFilter       ( const char        * filter,
+                                       const char        * option,
+                                       const char        * value,
+                                       double              scale,
+                                       oyProfile_s       * p )
+{
+  int size = bench_quick ? 256 : 1024, out_size = size * scale,
+      n = bench_quick ? 5 : 10, i, error = 0, pos;
+  oyImage_s * image_in = oyImage_Create( size, size, NULL, OY_TYPE_123_FLOAT,
+                                         p, NULL ),
+            * image_out = oyImage_Create( out_size, out_size, NULL,
+                                          OY_TYPE_123_FLOAT, p, NULL );
+  oyConversion_s * cc = oyConversion_New( NULL );
+  oyFilterNode_s * in = oyFilterNode_NewWith( "//" OY_TYPE_STD "/root", 0, 0 ),
+                 * out = NULL;
+  char * reg = NULL;
+  double t;
+
+  benchFill( image_in );
+  oyConversion_Set( cc, in, 0 );
+  oyFilterNode_SetData( in, (oyStruct_s*)image_in, 0, 0 );
+
+  if(filter)
+  {
+    oyOptions_s * opts;
+
+    oyStringAddPrintf( &reg, 0,0, "//" OY_TYPE_STD "/%s", filter );
+    out = oyFilterNode_NewWith( reg, 0, 0 );
+    opts = oyFilterNode_GetOptions( out, OY_SELECT_FILTER );
+    oyFree_m_( reg );
+    oyStringAddPrintf( &reg, 0,0, "//" OY_TYPE_STD "/%s/%s", filter, filter );
+    if(value)
+      error = oyOptions_SetFromString( &opts, reg, value, OY_CREATE_NEW );
+    else
+      error = oyOptions_SetFromDouble( &opts, reg, scale, 0, OY_CREATE_NEW );
+    if(option)
+      error = oyOptions_SetFromString( &opts, option,
+                                       strchr( option, '=' ) + 1,
+                                       OY_CREATE_NEW );
+    oyFree_m_( reg );
+    oyOptions_Release( &opts );
+    error = oyFilterNode_Connect( in, "//" OY_TYPE_STD "/data",
+                                  out, "//" OY_TYPE_STD "/data", 0 );
+    in = out;
+  }
+
+  out = oyFilterNode_FromOptions( OY_CMM_STD, "//" OY_TYPE_STD "/icc_color",
+                                  NULL, NULL );
+  error = oyFilterNode_Connect( in, "//" OY_TYPE_STD "/data",
+                                out, "//" OY_TYPE_STD "/data", 0 );
+  oyFilterNode_SetData( out, (oyStruct_s*)image_out, 0, 0 );
+  in = out;
+
+  out = oyFilterNode_NewWith( "//" OY_TYPE_STD "/output", 0, 0 );
+  error = oyFilterNode_Connect( in, "//" OY_TYPE_STD "/data",
+                                out, "//" OY_TYPE_STD "/data", 0 );
+  oyConversion_Set( cc, 0, out );
+
+  error = oyConversion_RunPixels( cc, NULL );
+  t = benchSeconds();
+  for(i = 0; i < n && !error; ++i)
+    error = oyConversion_RunPixels( cc, NULL );
+  t = benchSeconds() - t;
+
+  oyStringAddPrintf( &reg, 0,0, "%s%s%s/%dx%d", filter ? filter : "none",
+                     option ? "/" : "", option ? strchr( option, '=' ) + 1 : "",
+                     size, size );
+  pos = benchResult( "filter", reg, error ? 0 : n, t );
+  if(error)
+    oyjlTreeSetIntF( bench_root, OYJL_CREATE_NEW, error,
+                     "oyranos-bench/results/[%d]/error", pos );
+  oyFree_m_( reg );
+
+  oyConversion_Release( &cc );
+  oyImage_Release( &image_in );
+  oyImage_Release( &image_out );
+}
+
+int main( int argc, char ** argv )
+{
+  const char * output = NULL;
+  char * path = NULL, * json = NULL, * srgb_path = NULL;
+  int i, level = 0, threads = 1, t;
+  oyProfile_s * srgb, * lstar, * cmyk;
+  size_t size = 0;
+
+  for(i = 1; i < argc; ++i)
+  {
+    if(strcmp( argv[i], "-q" ) == 0)
+      bench_quick = 1;
+    else if(strcmp( argv[i], "-o" ) == 0 && i + 1 < argc)
+      output = argv[++i];
+    else
+    {
+      fprintf( stderr, "Usage: %s [-q] [-o FILE]\n", argv[0] );
+      return 1;
+    }
+  }
+
+  /* only in-tree and synthetic profiles are visible */
+  sprintf( bench_dir, "/tmp/oyranos-bench-XXXXXX" );
+  if(!mkdtemp( bench_dir ))
+  {
+    fprintf( stderr, "could not create %s\n", bench_dir );
+    return 1;
+  }
+  oyStringAddPrintf( &path, 0,0, "%s/color", bench_dir );
+  oyMakeDir_( path );
+  oyFree_m_( path );
+  oyStringAddPrintf( &path, 0,0, "%s/color/icc", bench_dir );
+  oyMakeDir_( path );
+  oyFree_m_( path );
+  setenv( "XDG_DATA_HOME", bench_dir, 1 );
+  setenv( "XDG_DATA_DIRS", bench_dir, 1 );
+
+  srgb_path = benchWriteProfile( "sRGB.icc",
+                            _usr_share_color_icc_OpenICC_sRGB_icc,
+                            _usr_share_color_icc_OpenICC_sRGB_icc_len );
+  path = benchWriteProfile( "LStar-RGB.icc",
+                            _usr_share_color_icc_basICColor_LStar_RGB_icc,
+                            _usr_share_color_icc_basICColor_LStar_RGB_icc_len );
+  oyFree_m_( path );
+  path = benchWriteProfile( "Lab.icc", _usr_share_color_icc_lcms_Lab_icc,
+                            _usr_share_color_icc_lcms_Lab_icc_len );
+  oyFree_m_( path );
+  path = benchWriteProfile( "XYZ.icc", _usr_share_color_icc_lcms_XYZ_icc,
+                            _usr_share_color_icc_lcms_XYZ_icc_len );
+  oyFree_m_( path );
+  path = benchWriteProfile( "Gray-CIE_L.icc",
+                            _usr_share_color_icc_Oyranos_Gray_CIE_L_icc,
+                            _usr_share_color_icc_Oyranos_Gray_CIE_L_icc_len );
+  oyFree_m_( path );
+
+  icc_profile_flags = oyICCProfileSelectionFlagsFromOptions( OY_CMM_STD,
+                                       "//" OY_TYPE_STD "/icc_color", NULL, 0 );
+
+  {
+    oyProfile_s * p = benchMatrixProfile( 1.8, "bench-gamma-1.8" );
+    void * mem = oyProfile_GetMem( p, &size, 0, oyAllocateFunc_ );
+    path = benchWriteProfile( "bench-gamma-1.8.icc", mem, size );
+    oyFree_m_( path );
+    oyFree_m_( mem );
+    oyProfile_Release( &p );
+  }
+
+  bench_root = oyjlTreeNew( "" );
+  oyjlTreeSetStringF( bench_root, OYJL_CREATE_NEW, OYRANOS_VERSION_NAME,
+                      "oyranos-bench/version" );
+  oyjlTreeSetStringF( bench_root, OYJL_CREATE_NEW,
+                      bench_quick ? "quick" : "full", "oyranos-bench/mode" );
+#ifdef _OPENMP
+  threads = omp_get_num_procs();
+#endif
+  oyjlTreeSetIntF( bench_root, OYJL_CREATE_NEW, threads,
+                   "oyranos-bench/threads" );
+
+  benchProfileLoad( srgb_path );
+  benchProfilesCreate( );
+
+  srgb = oyProfile_FromFile( srgb_path, icc_profile_flags, NULL );
+  lstar = oyProfile_FromMem( _usr_share_color_icc_basICColor_LStar_RGB_icc_len,
+                    (const oyPointer)_usr_share_color_icc_basICColor_LStar_RGB_icc,
+                             0, NULL );
+  benchTransforms( lstar, srgb );
+
+  /* extras/icc ships no CMYK profile; take one from OY_BENCH_CMYK */
+  cmyk = getenv( "OY_BENCH_CMYK" ) ?
+         oyProfile_FromFile( getenv( "OY_BENCH_CMYK" ), icc_profile_flags,
+                             NULL ) : NULL;
+  if(cmyk && oyProfile_GetChannelsCount( cmyk ) != 4)
+    oyProfile_Release( &cmyk );
+  oyjlTreeSetStringF( bench_root, OYJL_CREATE_NEW,
+                      cmyk ? oyProfile_GetText( cmyk, oyNAME_DESCRIPTION ) :
+                      "none", "oyranos-bench/cmyk_profile" );
+
+  /* 1, 2, 4 ... threads up to all processors */
+  t = 1;
+  while(1)
+  {
+    benchPixels( "rgb", srgb, lstar, t );
+    if(cmyk)
+      benchPixels( "cmyk", cmyk, srgb, t );
+    if(t >= threads)
+      break;
+    t = t * 2 > threads ? threads : t * 2;
+  }
+#ifdef _OPENMP
+  omp_set_num_threads( threads );
+#endif
+
+  benchFilter( NULL, NULL, NULL, 1.0, srgb );
+  benchFilter( "scale", "//" OY_TYPE_STD "/scale/interpolation=nearest", NULL,
+               0.5, srgb );
+  benchFilter( "scale", "//" OY_TYPE_STD "/scale/interpolation=lanczos3", NULL,
+               0.5, srgb );
+  benchFilter( "expose", NULL, NULL, 1.5, srgb );
+  benchFilter( "channel", NULL, "[\"c\", \"b\", \"a\"]", 1.0, srgb );
+
+  oyProfile_Release( &cmyk );
+  oyProfile_Release( &lstar );
+  oyProfile_Release( &srgb );
+
+  oyjlTreeToJson( bench_root, &level, &json );
+  if(output)
+  {
+    FILE * fp = fopen( output, "w" );
+    if(fp)
+    {
+      fputs( json, fp );
+      fclose( fp );
+    } else
+      fprintf( stderr, "could not write %s\n", output );
+  } else
+    puts( json );
+
+  /* remove the temporary profile directory */
+  {
+    const char * names[6] = { "sRGB.icc", "LStar-RGB.icc", "Lab.icc",
+                              "XYZ.icc", "Gray-CIE_L.icc",
+                              "bench-gamma-1.8.icc" };
+    for(i = 0; i < 6; ++i)
+    {
+      oyStringAddPrintf( &path, 0,0, "%s/color/icc/%s", bench_dir, names[i] );
+      remove( path );
+      oyFree_m_( path );
+    }
+    oyStringAddPrintf( &path, 0,0, "%s/color/icc", bench_dir );
+    rmdir( path );
+    oyFree_m_( path );
+    oyStringAddPrintf( &path, 0,0, "%s/color", bench_dir );
+    rmdir( path );
+    oyFree_m_( path );
+    rmdir( bench_dir );
+  }
+
+  free( json );
+  oyFree_m_( srgb_path );
+  oyjlTreeFree( bench_root );
+  oyLibConfigRelease( 0 );
+
+  return 0;
+}
@@ -21,14 +21,17 @@
   TEST_RUN( testJson, "JSON handling", 1 ); \
   TEST_RUN( testOption, "basic oyOption_s", 1 ); \
   TEST_RUN( testOptionInt,  "oyOption_s integers", 1 ); \
+  TEST_RUN( testOptionLists,  "oyOption_s numeric lists", 1 ); \
   TEST_RUN( testOptionsSet,  "Set oyOptions_s", 1 ); \
   TEST_RUN( testOptionsCopy,  "Copy oyOptions_s", 1 ); \
   TEST_RUN( testOptionsType,  "Objects inside oyOptions_s", 1 ); \
   TEST_RUN( testBlob, "oyBlob_s", 1 ); \
   TEST_RUN( testDAGbasic, "basic DAG", 1 ); \
+  TEST_RUN( testObserverSignal, "Signal throughput", 1 ); \
   TEST_RUN( testSettings, "default oyOptions_s settings", 1 ); \
   TEST_RUN( testConfDomain, "oyConfDomain_s", 1 ); \
   TEST_RUN( testInterpolation, "Interpolation oyLinInterpolateRampU16", 1 ); \
+  TEST_RUN( testHalfFloat, "Half float conversion", 1 ); \
   TEST_RUN( testProfile, "Profile handling", 1 ); \
   TEST_RUN( testProfiles, "Profiles reading", 1 ); \
   TEST_RUN( testProfileLists, "Profile lists", 1 ); \
@@ -51,6 +54,10 @@
   TEST_RUN( testCMMsShow, "CMMs show", 1 ); \
   TEST_RUN( testCMMnmRun, "CMM named color run", 1 ); \
   TEST_RUN( testImagePixel, "CMM Image Pixel run", 1 ); \
+  TEST_RUN( testPixelLayout, "Pixel layout node", 1 ); \
+  TEST_RUN( testImageScale, "Image scale filters", 1 ); \
+  TEST_RUN( testImageExpose, "Image expose kernels", 1 ); \
+  TEST_RUN( testImageChannel, "Image channel kernels", 1 ); \
   TEST_RUN( testRectangles, "Image Rectangles", 1 ); \
   TEST_RUN( testDAG2, "screen DAG", 1 ); \
   TEST_RUN( testScreenPixel, "Draw Screen Pixel run", 1 ); \
@@ -58,6 +65,18 @@
   TEST_RUN( testConversion, "CMM selection", 1 ); \
   TEST_RUN( testCMMlists, "CMMs listing", 1 ); \
   TEST_RUN( testICCsCheck, "CMMs ICC conversion check", 1 ); \
+  TEST_RUN( testGamutCheck, "Batched gamut check", 1 ); \
+  TEST_RUN( testSpectralXYZ, "Spectral XYZ integration", 1 ); \
+  TEST_RUN( testMeasurementParse, "Measurement parsing", 1 ); \
+  TEST_RUN( testSharedCache, "Shared cache", 1 ); \
+  TEST_RUN( testIncrementalPrepare, "Incremental context preparation", 1 ); \
+  TEST_RUN( testNodeStats, "Filter node statistics", 1 ); \
+  TEST_RUN( testDisplayTiles, "Asynchronous display tiles", 1 ); \
+  TEST_RUN( testDBSnapshot, "Shared DB snapshot", 1 ); \
+  TEST_RUN( testProfilesScan, "Parallel profile scan", 1 ); \
+  TEST_RUN( testProfilesProbe, "Profile probing", 1 ); \
+  TEST_RUN( testICCTagViews, "ICC tag views", 1 ); \
+  TEST_RUN( testConfigMatch, "Config ranking", 1 ); \
   TEST_RUN( testCCorrectFlags, "Conversion Correct Option Flags", 1 ); \
   TEST_RUN( testCache, "Cache", 1 ); \
   TEST_RUN( testPaths, "Paths", 1 ); \
@@ -1361,6 +1380,107 @@ oyjlTESTRESULT_e testOptionInt ()
   return result;
 }
 
+oyjlTESTRESULT_e testOptionLists ()
+{
+  oyjlTESTRESULT_e result = oyjlTESTRESULT_UNKNOWN;
+  int i, n = 30000, error = 0, count;
+  double * values = (double*) calloc( sizeof(double), n ),
+         * back = (double*) calloc( sizeof(double), n ),
+         * list;
+  int32_t ints[4] = {1,2,3,4}, ints_back[5] = {0,0,0,0,0};
+  double clck;
+  oyOption_s * o;
+  OBJECT_COUNT_SETUP
+
+  fprintf(stdout, "\n" );
+
+  for(i = 0; i < n; ++i)
+    values[i] = i * 0.5;
+
+  /* one value after the other grows the list geometrically */
+  o = oyOption_FromRegistration( "//" OY_TYPE_STD "/filter/x", testobj );
+  clck = oyClock();
+  for(i = 0; i < n && !error; ++i)
+    error = oyOption_SetFromDouble( o, values[i], i, 0 );
+  clck = oyClock() - clck;
+  for(i = 0; i < n && !error; ++i)
+    if(oyOption_GetValueDouble( o, i ) != values[i])
+      error = -1 - i;
+  if(!error && oyOption_GetValueDouble( o, -1 ) == n)
+  { PRINT_SUB_PROFILING( oyjlTESTRESULT_SUCCESS, n,clck/(double)CLOCKS_PER_SEC,"val",
+    "oyOption_SetFromDouble() append" );
+  } else
+  { PRINT_SUB( oyjlTESTRESULT_FAIL,
+    "oyOption_SetFromDouble() append error: %d", error );
+  }
+  oyOption_Release( &o );
+
+  o = oyOption_FromRegistration( "//" OY_TYPE_STD "/filter/x", testobj );
+  clck = oyClock();
+  error = oyOption_SetFromDoubles( o, values, n, 0, 0 );
+  count = oyOption_GetValueDoubles( o, back, n, 0 );
+  clck = oyClock() - clck;
+  for(i = 0; i < n && !error; ++i)
+    if(back[i] != values[i])
+      error = -1 - i;
+  if(!error && count == n && oyOption_GetValueDouble( o, -1 ) == n)
+  { PRINT_SUB_PROFILING( oyjlTESTRESULT_SUCCESS, 2*n,clck/(double)CLOCKS_PER_SEC,"val",
+    "oyOption_SetFromDoubles()/GetValueDoubles()" );
+  } else
+  { PRINT_SUB( oyjlTESTRESULT_FAIL,
+    "oyOption_SetFromDoubles()/GetValueDoubles() error: %d count: %d", error, count );
+  }
+
+  /* extend the list in the middle and read a clipped range */
+  error = oyOption_SetFromDoubles( o, values, 10, n - 5, 0 );
+  count = oyOption_GetValueDoubles( o, back, 20, n - 5 );
+  if(!error && count == 10 && back[9] == values[9] &&
+     oyOption_GetValueDouble( o, n - 6 ) == values[n - 6])
+  { PRINT_SUB( oyjlTESTRESULT_SUCCESS,
+    "oyOption_SetFromDoubles() extend" );
+  } else
+  { PRINT_SUB( oyjlTESTRESULT_FAIL,
+    "oyOption_SetFromDoubles() extend error: %d count: %d", error, count );
+  }
+
+  /* take over a list without copying */
+  list = (double*) oyAllocateFunc_( sizeof(double) * (n + 1) );
+  memcpy( &list[1], values, sizeof(double) * n );
+  error = oyOption_MoveInDoubles( o, &list, n );
+  if(!error && !list && oyOption_GetValueDouble( o, -1 ) == n &&
+     oyOption_GetValueDouble( o, n - 1 ) == values[n - 1])
+  { PRINT_SUB( oyjlTESTRESULT_SUCCESS,
+    "oyOption_MoveInDoubles()" );
+  } else
+  { PRINT_SUB( oyjlTESTRESULT_FAIL,
+    "oyOption_MoveInDoubles() error: %d", error );
+  }
+  oyOption_Release( &o );
+
+  /* a scalar becomes the first list element */
+  o = oyOption_FromRegistration( "//" OY_TYPE_STD "/filter/y", testobj );
+  error = oyOption_SetFromInt( o, 7, 0, 0 );
+  if(!error)
+    error = oyOption_SetFromInts( o, ints, 4, 1, 0 );
+  count = oyOption_GetValueInts( o, ints_back, 5, 0 );
+  if(!error && count == 5 && ints_back[0] == 7 && ints_back[4] == 4 &&
+     oyOption_GetValueInt( o, -1 ) == 5)
+  { PRINT_SUB( oyjlTESTRESULT_SUCCESS,
+    "oyOption_SetFromInts()/GetValueInts()" );
+  } else
+  { PRINT_SUB( oyjlTESTRESULT_FAIL,
+    "oyOption_SetFromInts()/GetValueInts() error: %d count: %d", error, count );
+  }
+  oyOption_Release( &o );
+
+  free( values );
+  free( back );
+
+  OBJECT_COUNT_PRINT( oyjlTESTRESULT_FAIL, 1, 0, NULL )
+
+  return result;
+}
+
 oyjlTESTRESULT_e testOptionsSet ()
 {
   oyjlTESTRESULT_e result = oyjlTESTRESULT_UNKNOWN;
@@ -2057,6 +2177,78 @@ oyjlTESTRESULT_e testDAGbasic ()
   return result;
 }
 
+static int my_signal_count = 0;
+int myCountSignal( oyObserver_s *observer OY_UNUSED, oySIGNAL_e signal_type OY_UNUSED, oyStruct_s *signal_data OY_UNUSED )
+{
+  ++my_signal_count;
+  return 0;
+}
+
+oyjlTESTRESULT_e testObserverSignal ()
+{
+  oyjlTESTRESULT_e result = oyjlTESTRESULT_UNKNOWN;
+  int i, n = 1000000, error = 0;
+  double clck;
+  oyOption_s * o;
+  oyBlob_s * blob;
+  OBJECT_COUNT_SETUP
+
+  fprintf(stdout, "\n" );
+
+  o = oyOption_FromRegistration( "//" OY_TYPE_STD "/filter/x", testobj );
+  blob = oyBlob_New( testobj );
+
+  /* unobserved objects shall not pay for signalling */
+  clck = oyClock();
+  for(i = 0; i < n; ++i)
+    error = oyOption_SetFromDouble( o, i, 0, 0 );
+  clck = oyClock() - clck;
+  if(!error && !oyStruct_IsObserved( (oyStruct_s*)o, NULL ))
+  { PRINT_SUB_PROFILING( oyjlTESTRESULT_SUCCESS, n,clck/(double)CLOCKS_PER_SEC,"set",
+    "oyOption_SetFromDouble() unobserved" );
+  } else
+  { PRINT_SUB( oyjlTESTRESULT_FAIL,
+    "oyOption_SetFromDouble() unobserved error: %d", error );
+  }
+
+  error = oyStruct_ObserverAdd( (oyStruct_s*)o, (oyStruct_s*)blob,
+                                NULL, myCountSignal );
+  my_signal_count = 0;
+  clck = oyClock();
+  for(i = 0; i < n/10; ++i)
+    error = oyOption_SetFromDouble( o, i, 0, 0 );
+  clck = oyClock() - clck;
+  if(!error && my_signal_count == n/10 &&
+     oyStruct_IsObserved( (oyStruct_s*)o, (oyStruct_s*)blob ))
+  { PRINT_SUB_PROFILING( oyjlTESTRESULT_SUCCESS, n/10,clck/(double)CLOCKS_PER_SEC,"set",
+    "oyOption_SetFromDouble() observed" );
+  } else
+  { PRINT_SUB( oyjlTESTRESULT_FAIL,
+    "oyOption_SetFromDouble() observed error: %d signals: %d", error, my_signal_count );
+  }
+
+  /* removing the last observer returns to the fast path */
+  error = oyStruct_ObserverRemove( (oyStruct_s*)o, (oyStruct_s*)blob,
+                                   myCountSignal );
+  my_signal_count = 0;
+  oyOption_SetFromDouble( o, 1.0, 0, 0 );
+  if(!error && my_signal_count == 0 &&
+     !oyStruct_IsObserved( (oyStruct_s*)o, NULL ))
+  { PRINT_SUB( oyjlTESTRESULT_SUCCESS,
+    "oyStruct_ObserverRemove()" );
+  } else
+  { PRINT_SUB( oyjlTESTRESULT_FAIL,
+    "oyStruct_ObserverRemove() error: %d signals: %d", error, my_signal_count );
+  }
+
+  oyBlob_Release( &blob );
+  oyOption_Release( &o );
+
+  OBJECT_COUNT_PRINT( oyjlTESTRESULT_FAIL, 1, 0, NULL )
+
+  return result;
+}
+
 #ifdef HAVE_LIBXML2
 #include <libxml/parser.h>
 #ifdef LIBXML_WRITER_ENABLED
@@ -2380,6 +2572,73 @@ oyjlTESTRESULT_e testInterpolation ()
   return result;
 }
 
+oyjlTESTRESULT_e testHalfFloat ()
+{
+  oyjlTESTRESULT_e result = oyjlTESTRESULT_UNKNOWN;
+  int i, n = 0, error = 0;
+
+  fprintf(stdout, "\n" );
+
+  if(oyHalfToFloat( OY_IEEE16BIT_FLOAT_ONE ) == 1.0f &&
+     oyHalfToFloat( OY_IEEE16BIT_FLOAT_HALF ) == 0.5f &&
+     oyFloatToHalf( 1.0f ) == OY_IEEE16BIT_FLOAT_ONE &&
+     oyFloatToHalf( 0.5f ) == OY_IEEE16BIT_FLOAT_HALF &&
+     oyFloatToHalf( 1.0e6f ) == 0x7c00 &&
+     oyFloatToHalf( 1.0e-9f ) == 0)
+  { PRINT_SUB( oyjlTESTRESULT_SUCCESS,
+    "oyHalfToFloat()/oyFloatToHalf() constants" );
+  } else
+  { PRINT_SUB( oyjlTESTRESULT_FAIL,
+    "oyHalfToFloat()/oyFloatToHalf() constants" );
+  }
+
+  /* every non NaN half value must survive the round trip */
+  for(i = 0; i < 65536; ++i)
+  {
+    uint16_t h = i;
+    if((h & 0x7c00) == 0x7c00 && (h & 0x03ff))
+      continue;
+    ++n;
+    if(oyFloatToHalf( oyHalfToFloat( h ) ) != h)
+      ++error;
+  }
+  if( !error )
+  { PRINT_SUB( oyjlTESTRESULT_SUCCESS,
+    "half -> float -> half round trip %d", n );
+  } else
+  { PRINT_SUB( oyjlTESTRESULT_FAIL,
+    "half -> float -> half round trip %d failed: %d", n, error );
+  }
+
+  /* line kernels must match the scalar code; odd size covers the tail */
+  int count = 1024 * 1024 + 3;
+  uint16_t * halfs = (uint16_t*) malloc( count * sizeof(uint16_t) ),
+           * halfs2 = (uint16_t*) malloc( count * sizeof(uint16_t) );
+  float * floats = (float*) malloc( count * sizeof(float) );
+  for(i = 0; i < count; ++i)
+    halfs[i] = oyFloatToHalf( (float)i / count );
+
+  double clck = oyClock();
+  oyHalfToFloatLine( halfs, floats, count );
+  oyFloatToHalfLine( floats, halfs2, count );
+  clck = oyClock() - clck;
+
+  error = 0;
+  for(i = 0; i < count; ++i)
+    if(halfs[i] != halfs2[i] || floats[i] != oyHalfToFloat( halfs[i] ))
+      ++error;
+  if( !error )
+  { PRINT_SUB_PROFILING( oyjlTESTRESULT_SUCCESS, 2*count,clck/(double)CLOCKS_PER_SEC,"sample",
+    "oyHalfToFloatLine()/oyFloatToHalfLine()" );
+  } else
+  { PRINT_SUB( oyjlTESTRESULT_FAIL,
+    "oyHalfToFloatLine()/oyFloatToHalfLine() failed: %d", error );
+  }
+  free( halfs ); free( halfs2 ); free( floats );
+
+  return result;
+}
+
 #include "oyProfile_s.h"
 oyjlTESTRESULT_e testOptionsType ()
 {
@@ -6317,6 +6576,78 @@ oyjlTESTRESULT_e testCMMmonitorDBmatch ()
     oyConfig_Release( &device );
   }
 
+  /* the indexed oyConfig_GetDB() shall select as the plain DB scan */
+  oyConfig_s * pattern = oyConfig_FromRegistration( reg, testobj );
+  oyConfig_AddDBData( pattern, "model", "TEST-model2", OY_CREATE_NEW );
+  oyConfig_AddDBData( pattern, "system_port", "TEST-port2", OY_CREATE_NEW );
+  device = oyConfig_Copy( pattern, testobj );
+  int32_t rank_scan = 0;
+  error = oyConfig_SelectDB( device, configs, &rank_scan );
+  char * scan_text = oyStringCopy( oyOptions_GetText( *oyConfig_GetOptions(device,"db"), oyNAME_NICK ), oyAllocateFunc_ );
+  oyConfig_Release( &device );
+
+  device = oyConfig_Copy( pattern, testobj );
+  rank = 0;
+  error = oyConfig_GetDB( device, NULL, &rank );
+  const char * index_text = oyOptions_GetText( *oyConfig_GetOptions(device,"db"), oyNAME_NICK );
+  if( !error && rank == rank_scan && rank > 0 && scan_text && index_text &&
+      oyStrcmp_( scan_text, index_text ) == 0 &&
+      oyConfig_FindString( device, "system_port", "TEST-port2" ) )
+  { PRINT_SUB( oyjlTESTRESULT_SUCCESS,
+    "oyConfig_GetDB( indexed ) == oyConfig_SelectDB() %d", (int)rank );
+  } else
+  { PRINT_SUB( oyjlTESTRESULT_FAIL,
+    "oyConfig_GetDB( indexed ) == oyConfig_SelectDB() %d/%d", (int)rank, (int)rank_scan );
+  }
+  if(verbose) fprintf(zout, "  %s\n", oyNoEmptyString_m_(index_text) );
+
+  /* edits of a looked up device must not reach the index */
+  oyConfig_AddDBData( device, "system_port", "TEST-changed", OY_CREATE_NEW );
+  oyOptions_SetFromString( oyConfig_GetOptions(device,"db"), OY_STD "/device/test/model",
+                           "TEST-changed", OY_CREATE_NEW );
+  oyConfig_Release( &device );
+  device = oyConfig_Copy( pattern, testobj );
+  rank = 0;
+  error = oyConfig_GetDB( device, NULL, &rank );
+  index_text = oyOptions_GetText( *oyConfig_GetOptions(device,"db"), oyNAME_NICK );
+  if( !error && rank == rank_scan && scan_text && index_text &&
+      oyStrcmp_( scan_text, index_text ) == 0 )
+  { PRINT_SUB( oyjlTESTRESULT_SUCCESS,
+    "oyConfig_GetDB( indexed ) after device db edits" );
+  } else
+  { PRINT_SUB( oyjlTESTRESULT_FAIL,
+    "oyConfig_GetDB( indexed ) after device db edits %d/%d", (int)rank, (int)rank_scan );
+  }
+  oyConfig_Release( &device );
+  if(scan_text) oyFree_m_( scan_text );
+
+  int n = 100;
+  clck = oyClock();
+  for(k = 0; k < n; ++k)
+  {
+    oyConfigs_s * heap = NULL;
+    device = oyConfig_Copy( pattern, testobj );
+    oyConfigs_FromDB( reg, NULL, &heap, testobj );
+    oyConfig_SelectDB( device, heap, &rank );
+    oyConfigs_Release( &heap );
+    oyConfig_Release( &device );
+  }
+  clck = oyClock() - clck;
+  PRINT_SUB_PROFILING( oyjlTESTRESULT_SUCCESS, n, clck/(double)CLOCKS_PER_SEC, "lookup",
+    "oyConfigs_FromDB()+oyConfig_SelectDB()" );
+
+  clck = oyClock();
+  for(k = 0; k < n; ++k)
+  {
+    device = oyConfig_Copy( pattern, testobj );
+    oyConfig_GetDB( device, NULL, &rank );
+    oyConfig_Release( &device );
+  }
+  clck = oyClock() - clck;
+  PRINT_SUB_PROFILING( oyjlTESTRESULT_SUCCESS, n, clck/(double)CLOCKS_PER_SEC, "lookup",
+    "oyConfig_GetDB( indexed )" );
+  oyConfig_Release( &pattern );
+
   oyConfigs_Release( &configs );
 
   error = oyDBEraseKey( reg, oySCOPE_USER );
@@ -7691,385 +8022,856 @@ oyjlTESTRESULT_e testImagePixel()
   return result;
 }
 
-oyjlTESTRESULT_e testRectangles()
+/* count the layout nodes between the output and the root node */
+static int testCountLayoutNodes( oyConversion_s * cc )
+{
+  int count = 0;
+  oyFilterNode_s * node = oyConversion_GetNode( cc, OY_OUTPUT );
+  while(node)
+  {
+    oyFilterNode_s * next = oyFilterNode_GetPlugNode( node, 0 );
+    const char * reg = oyFilterNode_GetRegistration( node );
+    if(reg && strstr( reg, "/layout" ))
+      ++count;
+    oyFilterNode_Release( &node );
+    node = next;
+  }
+  return count;
+}
+
+/* normalised sample access for per line planar and interwoven buffers */
+static double testLayoutSample_( void * buf, oyPixel_t layout, int width,
+                                 int x, int y, int c, double * set )
+{
+  int ch = oyToChannels_m( layout ),
+      pos = y * width * ch + (oyToPlanar_m( layout ) ? c * width + x : x * ch + c);
+  double v = 0;
+  switch(oyToDataType_m( layout ))
+  {
+    case oyUINT8:  if(set) ((uint8_t*)buf)[pos] = OY_ROUND(*set * 255.0);
+                   v = ((uint8_t*)buf)[pos] / 255.0; break;
+    case oyUINT16: if(set) ((uint16_t*)buf)[pos] = OY_ROUND(*set * 65535.0);
+                   v = ((uint16_t*)buf)[pos] / 65535.0; break;
+    case oyFLOAT:  if(set) ((float*)buf)[pos] = *set;
+                   v = ((float*)buf)[pos]; break;
+    default: break;
+  }
+  return v;
+}
+
+/* run root -> layout -> output once */
+static int testLayoutRun_( oyImage_s * input, oyImage_s * output, const char * alpha )
+{
+  oyConversion_s * cc = oyConversion_New( testobj );
+  oyFilterNode_s * in = oyFilterNode_NewWith( "//" OY_TYPE_STD "/root", 0, testobj ),
+                 * node = oyFilterNode_NewWith( "//" OY_TYPE_STD "/layout", 0, testobj ),
+                 * out = oyFilterNode_NewWith( "//" OY_TYPE_STD "/output", 0, testobj );
+  oyOptions_s * options = oyFilterNode_GetOptions( node, OY_SELECT_FILTER );
+  int error = 0;
+
+  oyConversion_Set( cc, in, 0 );
+  oyFilterNode_SetData( in, (oyStruct_s*)input, 0, 0 );
+  if(alpha)
+    error = oyOptions_SetFromString( &options, "//" OY_TYPE_STD "/layout/alpha",
+                                     alpha, OY_CREATE_NEW );
+  oyOptions_Release( &options );
+  oyFilterNode_SetData( node, (oyStruct_s*)output, 0, 0 );
+  if(!error)
+    error = oyFilterNode_Connect( in, "//" OY_TYPE_STD "/data",
+                                  node, "//" OY_TYPE_STD "/data", 0 );
+  if(!error)
+    error = oyFilterNode_Connect( node, "//" OY_TYPE_STD "/data",
+                                  out, "//" OY_TYPE_STD "/data", 0 );
+  oyConversion_Set( cc, 0, out );
+
+  if(!error)
+    error = oyConversion_RunPixels( cc, 0 );
+
+  oyFilterNode_Release( &in );
+  oyFilterNode_Release( &node );
+  oyFilterNode_Release( &out );
+  oyConversion_Release( &cc );
+
+  return error;
+}
+
+oyjlTESTRESULT_e testPixelLayout()
 {
   oyjlTESTRESULT_e result = oyjlTESTRESULT_UNKNOWN;
-  OBJECT_COUNT_SETUP
   uint32_t icc_profile_flags =oyICCProfileSelectionFlagsFromOptions( OY_CMM_STD,
                                        "//" OY_TYPE_STD "/icc_color", NULL, 0 );
   oyProfile_s * p_web = oyProfile_FromStd( oyASSUMED_WEB, icc_profile_flags, testobj );
-  int error = 0;
-  uint16_t buf_16_3x3[27] = {
-  20000,20000,20000, 10000,10000,10000, 5000,5000,5000,
-  0,0,0,             65535,65535,65535, 32768,32768,32768,
-  1,1,1,             100,100,100,       1000,1000,1000
-  };
-  oyDATATYPE_e buf_type = oyUINT16;
-  oyImage_s *image;
-  oyRectangle_s * sample_rectangle = oyRectangle_New(testobj),
-                * pixel_rectangle = oyRectangle_New(testobj),
-                * roi = oyRectangle_New(testobj);
+  int i, error = 0, layouts, width = 512, height = 512;
+  uint32_t buf_u32[4*4];
+  uint8_t buf_bgra[4*4];
+  oyConversion_s * cc;
 
   fprintf(stdout, "\n" );
 
-  image =oyImage_Create( 3,3, 
-                         buf_16_3x3,
-                         oyChannels_m(oyProfile_GetChannelsCount(p_web)) |
-                          oyDataType_m(buf_type),
-                         p_web,
-                         testobj );
-  error = (image == NULL);
-  oyProfile_Release( &p_web );
-
-
-  oyImage_RoiToSamples( image, NULL, &sample_rectangle );
-  double x,y,w,h;
-  oyRectangle_GetGeo( sample_rectangle, &x,&y,&w,&h );
-
-  if(!error &&
-     x==0 && y == 0 && w == 9 && h == 3)
+  /* RGBA uint32 is not understood by the icc module */
+  for(i = 0; i < 4; ++i)
+  {
+    buf_u32[i*4+0] = i * 0x40000000u;
+    buf_u32[i*4+1] = UINT32_MAX - i * 0x40000000u;
+    buf_u32[i*4+2] = 0x80000000u;
+    buf_u32[i*4+3] = UINT32_MAX;
+  }
+  memset( buf_bgra, 0, sizeof(buf_bgra) );
+  cc = oyConversion_CreateBasicPixelsFromBuffers(
+                                   p_web, buf_u32, oyChannels_m(4) | oyDataType_m(oyUINT32),
+                                   p_web, buf_bgra, OY_TYPE_123A_8 | oySwapColorChannels_m(oyYES),
+                                   0, 4 );
+  layouts = testCountLayoutNodes( cc );
+  error = oyConversion_RunPixels( cc, 0 );
+  for(i = 0; i < 4; ++i)
+    if(abs( buf_bgra[i*4+2] - (int)(buf_u32[i*4+0] >> 24) ) > 2 ||
+       abs( buf_bgra[i*4+1] - (int)(buf_u32[i*4+1] >> 24) ) > 2 ||
+       abs( buf_bgra[i*4+0] - 128 ) > 2)
+      ++error;
+  oyConversion_Release( &cc );
+  if( !error && layouts == 1 )
   { PRINT_SUB( oyjlTESTRESULT_SUCCESS,
-    "oyImage_RoiToSamples( NULL )" );
+    "RGBA uint32 -> BGRA uint8 with %d layout node", layouts );
   } else
   { PRINT_SUB( oyjlTESTRESULT_FAIL,
-    "oyImage_RoiToSamples( NULL )" );
+    "RGBA uint32 -> BGRA uint8 with %d layout node error: %d", layouts, error );
   }
 
-
-  oyImage_SamplesToRoi( image, NULL, &roi );
-  oyRectangle_GetGeo( roi, &x,&y,&w,&h );
-
-  if(!error &&
-     x==0 && y == 0 && w == 1.0 && h == 1.0)
+  /* the icc module handles swapping itself */
+  cc = oyConversion_CreateBasicPixelsFromBuffers(
+                                   p_web, buf_bgra, OY_TYPE_123A_8 | oySwapColorChannels_m(oyYES),
+                                   p_web, buf_bgra, OY_TYPE_123A_8,
+                                   0, 4 );
+  layouts = testCountLayoutNodes( cc );
+  oyConversion_Release( &cc );
+  if( layouts == 0 )
   { PRINT_SUB( oyjlTESTRESULT_SUCCESS,
-    "oyImage_SamplesToRoi( NULL )" );
+    "BGRA uint8 -> RGBA uint8 fused into icc node" );
   } else
   { PRINT_SUB( oyjlTESTRESULT_FAIL,
-    "oyImage_SamplesToRoi( NULL )" );
+    "BGRA uint8 -> RGBA uint8 fused into icc node: %d", layouts );
   }
 
+  /* planar lines and premultiplied alpha through the layout node */
+  {
+    struct { const char * name; oyPixel_t in, out; const char * alpha; } tasks[] = {
+      { "RGBA uint8 -> planar RGBA uint16", OY_TYPE_123A_8, OY_TYPE_123A_16 | oyPlanar_m(oyYES), NULL },
+      { "planar RGBA uint16 -> RGBA uint8", OY_TYPE_123A_16 | oyPlanar_m(oyYES), OY_TYPE_123A_8, NULL },
+      { "planar RGBA uint8 -> planar BGRA uint8", OY_TYPE_123A_8 | oyPlanar_m(oyYES), OY_TYPE_123A_8 | oyPlanar_m(oyYES) | oySwapColorChannels_m(oyYES), NULL },
+      { "RGBA uint8 premultiply", OY_TYPE_123A_8, OY_TYPE_123A_8, "premultiply" },
+      { "planar RGBA uint8 -> RGBA float premultiply", OY_TYPE_123A_8 | oyPlanar_m(oyYES), OY_TYPE_123A_FLOAT, "premultiply" },
+      { "RGBA float -> planar RGBA uint16 unpremultiply", OY_TYPE_123A_FLOAT, OY_TYPE_123A_16 | oyPlanar_m(oyYES), "unpremultiply" },
+      { NULL, 0, 0, NULL } };
+    int t, x, y, c, w = 37, h = 5;
 
-  oyRectangle_SetGeo( roi, 1.0/3.0, 1.0/3.0, 1.0/3.0, 2.0/3.0 );
-  oyImage_RoiToSamples( image, roi, &sample_rectangle );
-  oyRectangle_GetGeo( sample_rectangle, &x,&y,&w,&h );
+    for(t = 0; tasks[t].name; ++t)
+    {
+      int swap = oyToSwapColorChannels_m( tasks[t].out );
+      void * buf_in = calloc( sizeof(float), w * h * 4 ),
+           * buf_out = calloc( sizeof(float), w * h * 4 );
+      oyImage_s * input = oyImage_Create( w, h, buf_in, tasks[t].in, p_web, testobj ),
+                * output = oyImage_Create( w, h, buf_out, tasks[t].out, p_web, testobj );
+      double diff = 0;
+
+      for(y = 0; y < h; ++y)
+        for(x = 0; x < w; ++x)
+          for(c = 0; c < 4; ++c)
+          {
+            double v = c == 3 ? (x + 1) / (double)w : ((x * 7 + y * 31 + c * 50) % 256) / 255.0;
+            if(tasks[t].alpha && strcmp(tasks[t].alpha, "unpremultiply") == 0 && c < 3)
+              v *= (x + 1) / (double)w;
+            testLayoutSample_( buf_in, tasks[t].in, w, x, y, c, &v );
+          }
 
-  if(!error &&
-     x==3 && y == 1 && w == 3 && h == 2)
-  { PRINT_SUB( oyjlTESTRESULT_SUCCESS,
-    "oyImage_RoiToSamples( roi )" );
-  } else
-  { PRINT_SUB( oyjlTESTRESULT_FAIL,
-    "oyImage_RoiToSamples( roi )" );
-  }
+      error = testLayoutRun_( input, output, tasks[t].alpha );
 
+      for(y = 0; y < h && !error; ++y)
+        for(x = 0; x < w; ++x)
+          for(c = 0; c < 4; ++c)
+          {
+            double a = testLayoutSample_( buf_in, tasks[t].in, w, x, y, 3, NULL ),
+                   v = testLayoutSample_( buf_in, tasks[t].in, w, x, y, c, NULL ),
+                   o = testLayoutSample_( buf_out, tasks[t].out, w, x, y,
+                                          swap && c < 3 ? 2 - c : c, NULL );
+            if(tasks[t].alpha && c < 3)
+              v = strcmp(tasks[t].alpha, "premultiply") == 0 ? v * a : v / a;
+            if(fabs( o - v ) > diff) diff = fabs( o - v );
+          }
 
-  oyRectangle_SetGeo( sample_rectangle, 6,2, 3,1 );
-  oyImage_SamplesToRoi( image, sample_rectangle, &roi );
-  oyRectangle_GetGeo( roi, &x,&y,&w,&h );
+      if( !error && diff < 1.5 / 255.0 )
+      { PRINT_SUB( oyjlTESTRESULT_SUCCESS,
+        "%s %dx%d", tasks[t].name, w, h );
+      } else
+      { PRINT_SUB( oyjlTESTRESULT_FAIL,
+        "%s %dx%d diff: %g error: %d", tasks[t].name, w, h, diff, error );
+      }
 
-  if(!error &&
-     x==2.0/3.0 && y == 2.0/3.0 && w == 1.0/3.0 && h == 1.0/3.0)
-  { PRINT_SUB( oyjlTESTRESULT_SUCCESS,
-    "oyImage_SamplesToRoi( sample_rectangle )" );
+      oyImage_Release( &input );
+      oyImage_Release( &output );
+      free( buf_in ); free( buf_out );
+      error = 0;
+    }
+  }
+
+  /* profile the layout node on a bigger image */
+  uint32_t * big_u32 = (uint32_t*) calloc( sizeof(uint32_t), width * height * 4 );
+  uint8_t * big_u8 = (uint8_t*) calloc( sizeof(uint8_t), width * height * 4 );
+  oyImage_s * input = oyImage_Create( width, height, big_u32,
+                                      oyChannels_m(4) | oyDataType_m(oyUINT32),
+                                      p_web, testobj ),
+            * output = oyImage_Create( width, height, big_u8,
+                                      oyChannels_m(4) | oyDataType_m(oyUINT8),
+                                      p_web, testobj );
+  cc = oyConversion_CreateBasicPixels( input, output, 0, testobj );
+  error = oyConversion_RunPixels( cc, 0 );
+  double clck = oyClock();
+  for(i = 0; i < 10 && !error; ++i)
+    error = oyConversion_RunPixels( cc, 0 );
+  clck = oyClock() - clck;
+  if( !error )
+  { PRINT_SUB_PROFILING( oyjlTESTRESULT_SUCCESS, i*width*height,clck/(double)CLOCKS_PER_SEC,"pixel",
+    "oyConversion_RunPixels() uint32 -> uint8 %dx%d", width, height );
   } else
   { PRINT_SUB( oyjlTESTRESULT_FAIL,
-    "oyImage_SamplesToRoi( sample_rectangle )" );
+    "oyConversion_RunPixels() uint32 -> uint8 %dx%d", width, height );
   }
+  oyConversion_Release( &cc );
+  oyImage_Release( &input );
+  oyImage_Release( &output );
+  free( big_u32 ); free( big_u8 );
+  oyProfile_Release( &p_web );
 
+  return result;
+}
 
-  oyRectangle_SetGeo( sample_rectangle, 3, 1, 3, 2 );
-  oyImage_SamplesToPixels( image, sample_rectangle, pixel_rectangle );
-  oyRectangle_GetGeo( pixel_rectangle, &x,&y,&w,&h );
-
-  if(!error &&
-     x==1 && y == 1 && w == 1 && h == 2)
-  { PRINT_SUB( oyjlTESTRESULT_SUCCESS,
-    "oyImage_SamplesToPixels( )" );
-  } else
-  { PRINT_SUB( oyjlTESTRESULT_FAIL,
-    "oyImage_SamplesToPixels( )" );
-  }
-
-  oyRectangle_SetGeo( pixel_rectangle, 1, 1, 2, 2 );
-  oyImage_PixelsToSamples( image, pixel_rectangle, sample_rectangle );
-  oyRectangle_GetGeo( sample_rectangle, &x,&y,&w,&h );
+oyjlTESTRESULT_e testImageScale()
+{
+  oyjlTESTRESULT_e result = oyjlTESTRESULT_UNKNOWN;
+  uint32_t icc_profile_flags =oyICCProfileSelectionFlagsFromOptions( OY_CMM_STD,
+                                       "//" OY_TYPE_STD "/icc_color", NULL, 0 );
+  oyProfile_s * p_web = oyProfile_FromStd( oyASSUMED_WEB, icc_profile_flags, testobj );
+  const char * methods[] = {"nearest", "box", "bilinear", "lanczos3", NULL};
+  int i, j, m, error = 0, width = 1024, height = 1024, w = width/4, h = height/4;
+  uint8_t * buf_in = (uint8_t*) calloc( sizeof(uint8_t), width * height * 4 ),
+          * buf_out = (uint8_t*) calloc( sizeof(uint8_t), w * h * 4 );
 
-  if(!error &&
-     x==3 && y == 1 && w == 6 && h == 2)
-  { PRINT_SUB( oyjlTESTRESULT_SUCCESS,
-    "oyImage_PixelsToSamples( )" );
-  } else
-  { PRINT_SUB( oyjlTESTRESULT_FAIL,
-    "oyImage_PixelsToSamples( )" );
-  }
+  fprintf(stdout, "\n" );
 
+  for(i = 0; i < width * height * 4; ++i)
+    buf_in[i] = (i / 4) % width % 256;
+
+  for(m = 0; methods[m]; ++m)
+  {
+    oyImage_s * input = oyImage_Create( width, height, buf_in, OY_TYPE_123A_8,
+                                        p_web, testobj ),
+              * output = oyImage_Create( w, h, buf_out, OY_TYPE_123A_8,
+                                        p_web, testobj );
+    oyConversion_s * cc = oyConversion_New( testobj );
+    oyFilterNode_s * in = oyFilterNode_NewWith( "//" OY_TYPE_STD "/root", 0, testobj ),
+                   * scale = oyFilterNode_NewWith( "//" OY_TYPE_STD "/scale", 0, testobj ),
+                   * sink = oyFilterNode_NewWith( "//" OY_TYPE_STD "/layout", 0, testobj ),
+                   * out = oyFilterNode_NewWith( "//" OY_TYPE_STD "/output", 0, testobj );
+    oyOptions_s * options = oyFilterNode_GetOptions( scale, OY_SELECT_FILTER );
+    double clck;
+
+    oyConversion_Set( cc, in, 0 );
+    oyFilterNode_SetData( in, (oyStruct_s*)input, 0, 0 );
+    error = oyOptions_SetFromDouble( &options, "//" OY_TYPE_STD "/scale/scale",
+                                     0.25, 0, OY_CREATE_NEW );
+    error = oyOptions_SetFromString( &options, "//" OY_TYPE_STD "/scale/interpolation",
+                                     methods[m], OY_CREATE_NEW );
+    oyOptions_Release( &options );
+    error = oyFilterNode_Connect( in, "//" OY_TYPE_STD "/data",
+                                  scale, "//" OY_TYPE_STD "/data", 0 );
+    oyFilterNode_SetData( sink, (oyStruct_s*)output, 0, 0 );
+    if(!error)
+      error = oyFilterNode_Connect( scale, "//" OY_TYPE_STD "/data",
+                                    sink, "//" OY_TYPE_STD "/data", 0 );
+    if(!error)
+      error = oyFilterNode_Connect( sink, "//" OY_TYPE_STD "/data",
+                                    out, "//" OY_TYPE_STD "/data", 0 );
+    oyConversion_Set( cc, 0, out );
 
-  oyImage_Release( &image );
-  oyRectangle_Release( &sample_rectangle );
-  oyRectangle_Release( &pixel_rectangle );
-  oyRectangle_Release( &roi );
+    if(!error)
+      error = oyConversion_RunPixels( cc, 0 );
+    clck = oyClock();
+    for(i = 0; i < 10 && !error; ++i)
+      error = oyConversion_RunPixels( cc, 0 );
+    clck = oyClock() - clck;
 
-  OBJECT_COUNT_PRINT( oyjlTESTRESULT_FAIL, 1, 0, NULL )
+    /* the horizontal ramp is kept within the filter footprint */
+    for(j = 8; j < w - 8 && !error; ++j)
+    {
+      int expect = (j*4 + 2) % 256;
+      if(expect > 8 && expect < 248 &&
+         abs( buf_out[(h/2*w + j)*4] - expect ) > 3)
+        error = -j;
+    }
+
+    if( !error )
+    { PRINT_SUB_PROFILING( oyjlTESTRESULT_SUCCESS, i*width*height,clck/(double)CLOCKS_PER_SEC,"pixel",
+      "scale %s %dx%d -> %dx%d", methods[m], width, height, w, h );
+    } else
+    { PRINT_SUB( oyjlTESTRESULT_FAIL,
+      "scale %s %dx%d -> %dx%d error: %d", methods[m], width, height, w, h, error );
+    }
+
+    /* the filters read a margin around each tile; four tiles must
+     * render as the whole image */
+    if(!error && m > 0)
+    {
+      uint8_t * full = (uint8_t*) malloc( w * h * 4 );
+      oyFilterPlug_s * plug = oyFilterNode_GetPlug( out, 0 );
+      oyPixelAccess_s * pixel_access = oyPixelAccess_Create( 0,0, plug,
+                                           oyPIXEL_ACCESS_IMAGE, testobj );
+      int t, diff = 0;
+
+      memcpy( full, buf_out, w * h * 4 );
+      memset( buf_out, 0, w * h * 4 );
+      for(t = 0; t < 4 && !error; ++t)
+      {
+        double tx = (t % 2) * 0.5, ty = (t / 2) * 0.5 * h / w;
+        oyRectangle_s * r = oyPixelAccess_GetArrayROI( pixel_access );
+        oyRectangle_SetGeo( r, tx, ty, 0.5, 0.5 * h / w );
+        oyPixelAccess_ChangeRectangle( pixel_access, tx, ty, r );
+        oyRectangle_Release( &r );
+        error = oyConversion_RunPixels( cc, pixel_access );
+      }
+      for(j = 0; j < w * h * 4 && !error; ++j)
+        if(abs( buf_out[j] - full[j] ) > diff)
+          diff = abs( buf_out[j] - full[j] );
+
+      if( !error && diff <= 1 )
+      { PRINT_SUB( oyjlTESTRESULT_SUCCESS,
+        "scale %s 2x2 tiles == whole image", methods[m] );
+      } else
+      { PRINT_SUB( oyjlTESTRESULT_FAIL,
+        "scale %s 2x2 tiles == whole image diff: %d error: %d", methods[m], diff, error );
+      }
+
+      oyPixelAccess_Release( &pixel_access );
+      oyFilterPlug_Release( &plug );
+      free( full );
+    }
+
+    oyFilterNode_Release( &in );
+    oyFilterNode_Release( &scale );
+    oyFilterNode_Release( &sink );
+    oyFilterNode_Release( &out );
+    oyConversion_Release( &cc );
+    oyImage_Release( &input );
+    oyImage_Release( &output );
+    error = 0;
+  }
+
+  free( buf_in ); free( buf_out );
+  oyProfile_Release( &p_web );
 
   return result;
 }
 
-int myNodeSignal( oyObserver_s *observer OY_UNUSED, oySIGNAL_e signal_type, oyStruct_s *signal_data )
+/* scalar reference of the expose module; a copy of its oySensibleClip(),
+ * which lives in a plugin and can not be linked here */
+static void testSensibleClip_( double * c, int n, int range_max, double expose )
 {
-  int count = oyOption_GetValueInt( (oyOption_s*) signal_data, -1 );
-  if(signal_data && signal_data->type_ == oyOBJECT_OPTION_S)
+  int max = 0, max_pos = 0, mid, mid_pos, min = range_max, min_pos = 0, i;
+
+  for(i = 0; i < n; ++i)
   {
-    ++count;
-    oyOption_SetFromInt( (oyOption_s*) signal_data, count, 0, 0 );
+    if(max < c[i]) { max = c[i]; max_pos = i; }
+    if(min > c[i]) { min = c[i]; min_pos = i; }
   }
 
-  if(verbose || oy_debug_signals)
+  if( min * expose > range_max)
+    for(i = 0; i < n; ++i)
+      c[i] = range_max;
+  else if(max * expose <= range_max)
+    for(i = 0; i < n; ++i)
+      c[i] *= expose;
+  else if(n > 1)
   {
-    const char * desc = oyStruct_GetText(signal_data, oyNAME_NAME, 0);
-    fprintf( zout, "%s - %s\n", oySignalToString(signal_type),
-                                oyNoEmptyString_m_(desc) );
+    double exposed_min = min * expose;
+    mid_pos = min_pos != 0 && max_pos != 0 ? 0 : min_pos != 1 && max_pos != 1 ? 1 : 2;
+    mid = c[mid_pos];
+    c[min_pos] = exposed_min + 0.5;
+    c[mid_pos] = exposed_min + (double)( mid - min )/(double)( max - min ) * (range_max - exposed_min) + 0.5;
+    c[max_pos] = range_max;
   }
-  return 0;
 }
 
-#include "../examples/image_display/oyranos_display_helpers.h"
-oyjlTESTRESULT_e testDAG2()
+/* run root -> expose -> layout -> output once over equally laid out images */
+static int testExposeRun_( oyImage_s * input, oyImage_s * output, double expose )
+{
+  oyConversion_s * cc = oyConversion_New( testobj );
+  oyFilterNode_s * in = oyFilterNode_NewWith( "//" OY_TYPE_STD "/root", 0, testobj ),
+                 * node = oyFilterNode_NewWith( "//" OY_TYPE_STD "/expose", 0, testobj ),
+                 * sink = oyFilterNode_NewWith( "//" OY_TYPE_STD "/layout", 0, testobj ),
+                 * out = oyFilterNode_NewWith( "//" OY_TYPE_STD "/output", 0, testobj );
+  oyOptions_s * options = oyFilterNode_GetOptions( node, OY_SELECT_FILTER );
+  int error;
+
+  oyConversion_Set( cc, in, 0 );
+  oyFilterNode_SetData( in, (oyStruct_s*)input, 0, 0 );
+  error = oyOptions_SetFromDouble( &options, "//" OY_TYPE_STD "/expose/expose",
+                                   expose, 0, OY_CREATE_NEW );
+  oyOptions_Release( &options );
+  if(!error)
+    error = oyFilterNode_Connect( in, "//" OY_TYPE_STD "/data",
+                                  node, "//" OY_TYPE_STD "/data", 0 );
+  oyFilterNode_SetData( sink, (oyStruct_s*)output, 0, 0 );
+  if(!error)
+    error = oyFilterNode_Connect( node, "//" OY_TYPE_STD "/data",
+                                  sink, "//" OY_TYPE_STD "/data", 0 );
+  if(!error)
+    error = oyFilterNode_Connect( sink, "//" OY_TYPE_STD "/data",
+                                  out, "//" OY_TYPE_STD "/data", 0 );
+  oyConversion_Set( cc, 0, out );
+
+  if(!error)
+    error = oyConversion_RunPixels( cc, 0 );
+
+  oyFilterNode_Release( &in );
+  oyFilterNode_Release( &node );
+  oyFilterNode_Release( &sink );
+  oyFilterNode_Release( &out );
+  oyConversion_Release( &cc );
+
+  return error;
+}
+
+oyjlTESTRESULT_e testImageExpose()
 {
   oyjlTESTRESULT_e result = oyjlTESTRESULT_UNKNOWN;
-  OBJECT_COUNT_SETUP
   uint32_t icc_profile_flags =oyICCProfileSelectionFlagsFromOptions( OY_CMM_STD,
                                        "//" OY_TYPE_STD "/icc_color", NULL, 0 );
-  oyProfile_s * p_in = NULL, * p_out = NULL;
-  int error = 0,
-      n = 10;
-  const int src_width  = 4 * 1024,
-      src_height =     512,
-      dst_width  = 2 * 1024,
-      dst_height =     256,
-      channels = 4;
-  int x,y;
-  uint16_t * buf_16in  = (uint16_t*) calloc(sizeof(uint16_t), src_width * src_height * channels);
-  uint16_t * buf_16out = (uint16_t*) calloc(sizeof(uint16_t), dst_width * dst_height * channels);
-  oyDATATYPE_e buf_type_in = oyUINT16,
-               data_type_request = oyUINT16;
-  oyImage_s *input = NULL, *output = NULL;
-  oyConversion_s * cc = NULL;
-  oyFilterNode_s * icc = NULL, * rectangles = NULL, * node = NULL, * input_node = NULL;
-  oyFilterSocket_s * socket = NULL;
-  oyOption_s * option = NULL;
+  oyProfile_s * p_web = oyProfile_FromStd( oyASSUMED_WEB, icc_profile_flags, testobj );
+  oyPixel_t layouts[] = {OY_TYPE_123_8, OY_TYPE_123_16, OY_TYPE_123_HALF, OY_TYPE_123_FLOAT, 0};
+  int i, j, t, error = 0, width = 1024, height = 1024, n = width * height * 3;
+  double expose = 1.5;
 
   fprintf(stdout, "\n" );
 
-  for(y = 0; y < src_height; ++y)
-    for(x = 0; x < src_width; ++x)
+  for(t = 0; layouts[t]; ++t)
+  {
+    oyDATATYPE_e data_type = oyToDataType_m( layouts[t] );
+    int bps = oyDataTypeGetSize( data_type );
+    char * buf_in = (char*) calloc( bps, n ),
+         * buf_out = (char*) calloc( bps, n );
+    /* stay below the clipping range, where all paths are linear */
+    for(i = 0; i < n; ++i)
     {
-      buf_16in[y*src_width*channels + x*channels + 0] = (y / (double)(src_height-1)) * 65535;
-      buf_16in[y*src_width*channels + x*channels + 1] = (1.0 - (y / (double)(src_height-1))) * 65535;
-      buf_16in[y*src_width*channels + x*channels + 2] = y;
-      buf_16in[y*src_width*channels + x*channels + 3] = x;
+      float v = (i % 150) / 255.0f;
+      switch(data_type)
+      {
+        case oyUINT8:  ((uint8_t*)buf_in)[i] = i % 150; break;
+        case oyUINT16: ((uint16_t*)buf_in)[i] = (i % 150) * 257; break;
+        case oyHALF:   ((uint16_t*)buf_in)[i] = oyFloatToHalf( v ); break;
+        case oyFLOAT:  ((float*)buf_in)[i] = v; break;
+        default: break;
+      }
     }
 
-  p_in = oyProfile_FromStd( oyEDITING_RGB, icc_profile_flags, testobj );
-  p_out = oyProfile_FromStd( oyASSUMED_WEB, icc_profile_flags, testobj );
-  input =oyImage_Create( src_width,src_height, 
-                         buf_16in,
-                         oyChannels_m(oyProfile_GetChannelsCount(p_in)+1) |
-                          oyDataType_m(buf_type_in),
-                         p_in,
-                         testobj );
-  output=oyImage_Create( dst_width,dst_height, 
-                         buf_16out,
-                         oyChannels_m(oyProfile_GetChannelsCount(p_out)+1) |
-                          oyDataType_m(data_type_request),
-                         p_out,
-                         testobj );
+    oyImage_s * input = oyImage_Create( width, height, buf_in, layouts[t],
+                                        p_web, testobj ),
+              * output = oyImage_Create( width, height, buf_out, layouts[t],
+                                        p_web, testobj );
+    oyConversion_s * cc = oyConversion_New( testobj );
+    oyFilterNode_s * in = oyFilterNode_NewWith( "//" OY_TYPE_STD "/root", 0, testobj ),
+                   * node = oyFilterNode_NewWith( "//" OY_TYPE_STD "/expose", 0, testobj ),
+                   * sink = oyFilterNode_NewWith( "//" OY_TYPE_STD "/layout", 0, testobj ),
+                   * out = oyFilterNode_NewWith( "//" OY_TYPE_STD "/output", 0, testobj );
+    oyOptions_s * options = oyFilterNode_GetOptions( node, OY_SELECT_FILTER );
+    double clck;
+
+    oyConversion_Set( cc, in, 0 );
+    oyFilterNode_SetData( in, (oyStruct_s*)input, 0, 0 );
+    error = oyOptions_SetFromDouble( &options, "//" OY_TYPE_STD "/expose/expose",
+                                     expose, 0, OY_CREATE_NEW );
+    oyOptions_Release( &options );
+    error = oyFilterNode_Connect( in, "//" OY_TYPE_STD "/data",
+                                  node, "//" OY_TYPE_STD "/data", 0 );
+    oyFilterNode_SetData( sink, (oyStruct_s*)output, 0, 0 );
+    if(!error)
+      error = oyFilterNode_Connect( node, "//" OY_TYPE_STD "/data",
+                                    sink, "//" OY_TYPE_STD "/data", 0 );
+    if(!error)
+      error = oyFilterNode_Connect( sink, "//" OY_TYPE_STD "/data",
+                                    out, "//" OY_TYPE_STD "/data", 0 );
+    oyConversion_Set( cc, 0, out );
 
-  cc = oyConversion_FromImageForDisplay( input, output,
-                                         &icc, oyOPTIONATTRIBUTE_ADVANCED,
-                                         oyUINT16, NULL, testobj );
-  if(verbose)
-    oyObjectTreePrint( 0x01 | 0x02 | 0x04 | 0x08, "display graph" );
+    if(!error)
+      error = oyConversion_RunPixels( cc, 0 );
+    clck = oyClock();
+    for(j = 0; j < 10 && !error; ++j)
+      error = oyConversion_RunPixels( cc, 0 );
+    clck = oyClock() - clck;
 
-  node = oyFilterNode_Copy( icc, 0 );
-  input_node = oyFilterNode_GetPlugNode( node, 0 );
+    /* the kernels must match the scalar exposure within rounding */
+    for(i = 0; i < 3 * 150 && !error; ++i)
+    {
+      float expect = (i % 150) / 255.0f * expose, v = 0;
+      switch(data_type)
+      {
+        case oyUINT8:  v = ((uint8_t*)buf_out)[i] / 255.0f; break;
+        case oyUINT16: v = ((uint16_t*)buf_out)[i] / 65535.0f; break;
+        case oyHALF:   v = oyHalfToFloat( ((uint16_t*)buf_out)[i] ); break;
+        case oyFLOAT:  v = ((float*)buf_out)[i]; break;
+        default: break;
+      }
+      if(fabs( v - expect ) > 1.5 / 255.0)
+        error = -1 - i;
+    }
 
-  /* insert a "rectangles" filter to handle multiple monitors */
-  rectangles = oyFilterNode_NewWith( "//" OY_TYPE_STD "/rectangles", 0, 0 );
-  /* insert "rectangles" between "display" and its input_node */
-  fprintf( zout, "%s -> %s\n", oyFilterNode_GetRegistration( input_node ), oyFilterNode_GetRegistration( node ) );
-  oyFilterNode_Disconnect( node, 0 );
-  error = oyFilterNode_Connect( input_node, "//" OY_TYPE_STD "/data",
-                                rectangles, "//" OY_TYPE_STD "/data",0 );
-  error = oyFilterNode_Connect( rectangles, "//" OY_TYPE_STD "/data",
-                                node, "//" OY_TYPE_STD "/data",0 );
-  oyFilterNode_Release( &node );
-  oyFilterNode_Release( &input_node );
-  if(verbose)
-    oyObjectTreePrint( 0x01 | 0x02 | 0x04 | 0x08, "rectangles connected" );
+    if( !error )
+    { PRINT_SUB_PROFILING( oyjlTESTRESULT_SUCCESS, j*width*height,clck/(double)CLOCKS_PER_SEC,"pixel",
+      "expose %s %dx%d", oyDataTypeToText( data_type ), width, height );
+    } else
+    { PRINT_SUB( oyjlTESTRESULT_FAIL,
+      "expose %s %dx%d error: %d", oyDataTypeToText( data_type ), width, height, error );
+    }
 
-  if( !error )
-  { PRINT_SUB( oyjlTESTRESULT_SUCCESS,
-    "insert node" );
-  } else
-  { PRINT_SUB( oyjlTESTRESULT_FAIL,
-    "insert node" );
+    oyFilterNode_Release( &in );
+    oyFilterNode_Release( &node );
+    oyFilterNode_Release( &sink );
+    oyFilterNode_Release( &out );
+    oyConversion_Release( &cc );
+    oyImage_Release( &input );
+    oyImage_Release( &output );
+    free( buf_in ); free( buf_out );
+    error = 0;
   }
 
+  /* random samples over the full range clip a good part of the pixels;
+   * the integer kernels must stay within one code value of the scalar path */
+  {
+    oyProfile_s * p_lab = oyProfile_FromStd( oyEDITING_LAB, icc_profile_flags, testobj ),
+                * p_cmyk = oyProfile_FromStd( oyEDITING_CMYK, icc_profile_flags, testobj );
+    struct { const char * name; oyProfile_s * p; int n, sensible; } spaces[] = {
+      { "RGB", p_web, 3, 3 }, { "Lab", p_lab, 3, 1 }, { "CMYK", p_cmyk, 4, 0 } };
+    oyDATATYPE_e types[] = { oyUINT8, oyUINT16 };
+    int s, w = 256, h = 64;
+    uint32_t seed = 1;
 
-  oyProfile_Release( &p_in );
-  oyProfile_Release( &p_out );
-  oyImage_Release( &input );
-  oyImage_Release( &output );
-  oyFilterNode_Release( &icc );
-  oyConversion_Release ( &cc );
+    for(s = 0; s < 3; ++s)
+    for(t = 0; t < 2; ++t)
+    {
+      int ch = spaces[s].n, count = w * h * ch, max = t ? 65535 : 255, diff = 0;
+      oyPixel_t layout = oyChannels_m(ch) | oyDataType_m(types[t]);
+      int bps = t ? 2 : 1;
+      char * buf_in = (char*) calloc( bps, count ),
+           * buf_out = (char*) calloc( bps, count );
+      oyImage_s * input, * output;
+
+      for(i = 0; i < count; ++i)
+      {
+        seed = seed * 1103515245 + 12345;
+        if(t) ((uint16_t*)buf_in)[i] = seed >> 16;
+        else  ((uint8_t*)buf_in)[i] = seed >> 24;
+      }
 
+      input = oyImage_Create( w, h, buf_in, layout, spaces[s].p, testobj );
+      output = oyImage_Create( w, h, buf_out, layout, spaces[s].p, testobj );
+      error = testExposeRun_( input, output, expose );
 
-  p_in = oyProfile_FromStd( oyEDITING_RGB, icc_profile_flags, testobj );
-  p_out = oyProfile_FromStd( oyASSUMED_WEB, icc_profile_flags, testobj );
-  input =oyImage_Create( src_width,src_height, 
-                         buf_16in,
-                         oyChannels_m(oyProfile_GetChannelsCount(p_in)+1) |
-                          oyDataType_m(buf_type_in),
-                         p_in,
-                         testobj );
-  output=oyImage_Create( dst_width,dst_height, 
-                         buf_16out,
-                         oyChannels_m(oyProfile_GetChannelsCount(p_out)+1) |
-                          oyDataType_m(data_type_request),
-                         p_out,
-                         testobj );
+      for(i = 0; i < w * h && !error; ++i)
+      {
+        double c[4];
+        for(j = 0; j < ch; ++j)
+          c[j] = t ? ((uint16_t*)buf_in)[i*ch+j] : ((uint8_t*)buf_in)[i*ch+j];
+        if(spaces[s].sensible)
+          testSensibleClip_( c, spaces[s].sensible, max, expose );
+        else
+          for(j = 0; j < ch; ++j)
+          { c[j] = (int)(c[j] * expose); if(c[j] > max) c[j] = max; }
+        for(j = 0; j < ch; ++j)
+        {
+          int v = t ? ((uint16_t*)buf_out)[i*ch+j] : ((uint8_t*)buf_out)[i*ch+j],
+              ref = t ? (uint16_t)c[j] : (uint8_t)c[j];
+          if(abs( v - ref ) > diff) diff = abs( v - ref );
+        }
+      }
 
-  cc = oyConversion_FromImageForDisplay( input, output,
-                                         &icc, oyOPTIONATTRIBUTE_ADVANCED,
-                                         oyUINT16, NULL, testobj );
-  const char * hash = oyFilterNode_GetText( icc, oyNAME_NAME );
+      if( !error && diff <= 1 )
+      { PRINT_SUB( oyjlTESTRESULT_SUCCESS,
+        "expose %s %s random == oySensibleClip() max diff: %d", spaces[s].name, oyDataTypeToText( types[t] ), diff );
+      } else
+      { PRINT_SUB( oyjlTESTRESULT_FAIL,
+        "expose %s %s random == oySensibleClip() max diff: %d error: %d", spaces[s].name, oyDataTypeToText( types[t] ), diff, error );
+      }
 
-  if( hash )
-  { PRINT_SUB( oyjlTESTRESULT_SUCCESS,
-    "hashed node" );
-  } else
-  { PRINT_SUB( oyjlTESTRESULT_FAIL,
-    "hashed node" );
+      oyImage_Release( &input );
+      oyImage_Release( &output );
+      free( buf_in ); free( buf_out );
+      error = 0;
+    }
+
+    oyProfile_Release( &p_lab );
+    oyProfile_Release( &p_cmyk );
   }
 
-  oyProfile_Release( &p_in );
-  oyProfile_Release( &p_out );
-  oyImage_Release( &input );
-  oyImage_Release( &output );
-  oyFilterNode_Release( &icc );
-  oyConversion_Release ( &cc );
-  OBJECT_COUNT_PRINT( oyjlTESTRESULT_FAIL, 0, 1, "objects hash" )
+  oyProfile_Release( &p_web );
 
+  return result;
+}
 
-  p_in = oyProfile_FromStd( oyEDITING_RGB, icc_profile_flags, testobj );
-  p_out = oyProfile_FromStd( oyASSUMED_WEB, icc_profile_flags, testobj );
-  input =oyImage_Create( src_width,src_height, 
-                         buf_16in,
-                         oyChannels_m(oyProfile_GetChannelsCount(p_in)+1) |
-                          oyDataType_m(buf_type_in),
-                         p_in,
-                         testobj );
-  output=oyImage_Create( dst_width,dst_height, 
-                         buf_16out,
-                         oyChannels_m(oyProfile_GetChannelsCount(p_out)+1) |
-                          oyDataType_m(data_type_request),
-                         p_out,
+oyjlTESTRESULT_e testImageChannel()
+{
+  oyjlTESTRESULT_e result = oyjlTESTRESULT_UNKNOWN;
+  uint32_t icc_profile_flags =oyICCProfileSelectionFlagsFromOptions( OY_CMM_STD,
+                                       "//" OY_TYPE_STD "/icc_color", NULL, 0 );
+  oyProfile_s * p_web = oyProfile_FromStd( oyASSUMED_WEB, icc_profile_flags, testobj );
+  /* alpha plate display and a channel swap, each with and without a data type change */
+  struct { const char * channels; oyPixel_t in, out; } tasks[] = {
+    { "[\"d\", \"d\", \"d\"]", OY_TYPE_123A_8, OY_TYPE_123A_8 },
+    { "[\"d\", \"d\", \"d\"]", OY_TYPE_123A_16, OY_TYPE_123_8 },
+    { "[\"c\", \"b\", \"a\"]", OY_TYPE_123_16, OY_TYPE_123_16 },
+    { "[\"c\", \"b\", \"a\"]", OY_TYPE_123_16, OY_TYPE_123_FLOAT },
+    { NULL, 0, 0 } };
+  int i, j, t, error = 0, width = 1024, height = 1024;
+
+  fprintf(stdout, "\n" );
+
+  for(t = 0; tasks[t].channels; ++t)
+  {
+    oyDATATYPE_e type_in = oyToDataType_m( tasks[t].in ),
+                 type_out = oyToDataType_m( tasks[t].out );
+    int channels_in = oyToChannels_m( tasks[t].in ),
+        channels_out = oyToChannels_m( tasks[t].out ),
+        n = width * height;
+    char * buf_in = (char*) calloc( oyDataTypeGetSize( type_in ), n * channels_in ),
+         * buf_out = (char*) calloc( oyDataTypeGetSize( type_out ), n * channels_out );
+    for(i = 0; i < n * channels_in; ++i)
+      if(type_in == oyUINT8)
+        ((uint8_t*)buf_in)[i] = i % 256;
+      else
+        ((uint16_t*)buf_in)[i] = (i % 256) * 257;
+
+    oyImage_s * input = oyImage_Create( width, height, buf_in, tasks[t].in,
+                                        p_web, testobj ),
+              * output = oyImage_Create( width, height, buf_out, tasks[t].out,
+                                        p_web, testobj );
+    oyConversion_s * cc = oyConversion_New( testobj );
+    oyFilterNode_s * in = oyFilterNode_NewWith( "//" OY_TYPE_STD "/root", 0, testobj ),
+                   * node = oyFilterNode_NewWith( "//" OY_TYPE_STD "/channel", 0, testobj ),
+                   * out = oyFilterNode_NewWith( "//" OY_TYPE_STD "/output", 0, testobj );
+    oyOptions_s * options = oyFilterNode_GetOptions( node, OY_SELECT_FILTER );
+    double clck;
+
+    oyConversion_Set( cc, in, 0 );
+    oyFilterNode_SetData( in, (oyStruct_s*)input, 0, 0 );
+    error = oyOptions_SetFromString( &options, "//" OY_TYPE_STD "/channel/channel",
+                                     tasks[t].channels, OY_CREATE_NEW );
+    oyOptions_Release( &options );
+    /* the channel node writes the output layout itself */
+    oyFilterNode_SetData( node, (oyStruct_s*)output, 0, 0 );
+    error = oyFilterNode_Connect( in, "//" OY_TYPE_STD "/data",
+                                  node, "//" OY_TYPE_STD "/data", 0 );
+    if(!error)
+      error = oyFilterNode_Connect( node, "//" OY_TYPE_STD "/data",
+                                    out, "//" OY_TYPE_STD "/data", 0 );
+    oyConversion_Set( cc, 0, out );
+
+    if(!error)
+      error = oyConversion_RunPixels( cc, 0 );
+    clck = oyClock();
+    for(j = 0; j < 10 && !error; ++j)
+      error = oyConversion_RunPixels( cc, 0 );
+    clck = oyClock() - clck;
+
+    /* compare normalised samples of the first pixels */
+    for(i = 0; i < 256 && !error; ++i)
+    {
+      int c;
+      for(c = 0; c < 3; ++c)
+      {
+        int pos = tasks[t].channels[2] == 'd' ? 3 : 2 - c;
+        double v = 0, expect = ((i * channels_in + pos) % 256) / 255.0;
+        switch(type_out)
+        {
+          case oyUINT8:  v = ((uint8_t*)buf_out)[i*channels_out + c] / 255.0; break;
+          case oyUINT16: v = ((uint16_t*)buf_out)[i*channels_out + c] / 65535.0; break;
+          case oyFLOAT:  v = ((float*)buf_out)[i*channels_out + c]; break;
+          default: break;
+        }
+        if(fabs( v - expect ) > 0.5 / 255.0)
+          error = -1 - i;
+      }
+    }
+
+    if( !error )
+    { PRINT_SUB_PROFILING( oyjlTESTRESULT_SUCCESS, j*width*height,clck/(double)CLOCKS_PER_SEC,"pixel",
+      "channel %s %s -> %s", tasks[t].channels, oyDataTypeToText( type_in ), oyDataTypeToText( type_out ) );
+    } else
+    { PRINT_SUB( oyjlTESTRESULT_FAIL,
+      "channel %s %s -> %s error: %d", tasks[t].channels, oyDataTypeToText( type_in ), oyDataTypeToText( type_out ), error );
+    }
+
+    oyFilterNode_Release( &in );
+    oyFilterNode_Release( &node );
+    oyFilterNode_Release( &out );
+    oyConversion_Release( &cc );
+    oyImage_Release( &input );
+    oyImage_Release( &output );
+    free( buf_in ); free( buf_out );
+    error = 0;
+  }
+
+  oyProfile_Release( &p_web );
+
+  return result;
+}
+
+oyjlTESTRESULT_e testRectangles()
+{
+  oyjlTESTRESULT_e result = oyjlTESTRESULT_UNKNOWN;
+  OBJECT_COUNT_SETUP
+  uint32_t icc_profile_flags =oyICCProfileSelectionFlagsFromOptions( OY_CMM_STD,
+                                       "//" OY_TYPE_STD "/icc_color", NULL, 0 );
+  oyProfile_s * p_web = oyProfile_FromStd( oyASSUMED_WEB, icc_profile_flags, testobj );
+  int error = 0;
+  uint16_t buf_16_3x3[27] = {
+  20000,20000,20000, 10000,10000,10000, 5000,5000,5000,
+  0,0,0,             65535,65535,65535, 32768,32768,32768,
+  1,1,1,             100,100,100,       1000,1000,1000
+  };
+  oyDATATYPE_e buf_type = oyUINT16;
+  oyImage_s *image;
+  oyRectangle_s * sample_rectangle = oyRectangle_New(testobj),
+                * pixel_rectangle = oyRectangle_New(testobj),
+                * roi = oyRectangle_New(testobj);
+
+  fprintf(stdout, "\n" );
+
+  image =oyImage_Create( 3,3, 
+                         buf_16_3x3,
+                         oyChannels_m(oyProfile_GetChannelsCount(p_web)) |
+                          oyDataType_m(buf_type),
+                         p_web,
                          testobj );
+  error = (image == NULL);
+  oyProfile_Release( &p_web );
 
-  cc = oyConversion_FromImageForDisplay( input, output,
-                                         &icc, oyOPTIONATTRIBUTE_ADVANCED,
-                                         oyUINT16, NULL, testobj );
-  oyProfile_Release( &p_in );
-  oyProfile_Release( &p_out );
-  oyImage_Release( &input );
-  oyImage_Release( &output );
-  oyFilterNode_Release( &icc );
 
-  input_node = oyConversion_GetNode( cc, OY_INPUT );
-  node = oyConversion_GetNode( cc, OY_OUTPUT );
-  option = oyOption_FromRegistration( OY_STD "/node/count", testobj );
-  error = oyStruct_ObserverAdd( (oyStruct_s*)node, (oyStruct_s*)node,
-                                (oyStruct_s*)option, myNodeSignal );
+  oyImage_RoiToSamples( image, NULL, &sample_rectangle );
+  double x,y,w,h;
+  oyRectangle_GetGeo( sample_rectangle, &x,&y,&w,&h );
 
-  //{ char * text = oyjlBT(-1); oyObjectTreePrint( 0x01 | 0x02 | 0x04 | 0x08, text ? text : __func__ ); oyFree_m_( text ) }
-#if 0
-  /* graph broadcast */
-  socket = oyFilterNode_GetSocket( input_node, 0 );
-  oyFilterSocket_SignalToGraph( socket, oyCONNECTOR_EVENT_DATA_CHANGED );
-#else
-  /* let oyFilterNode_Run() emit a signal on filter call and observe the ticket */
-  oyConversion_RunPixels( cc, NULL );
-#endif
-  //{ char * text = oyjlBT(-1); oyObjectTreePrint( 0x01 | 0x02 | 0x04 | 0x08, text ? text : __func__ ); oyFree_m_( text ) }
+  if(!error &&
+     x==0 && y == 0 && w == 9 && h == 3)
+  { PRINT_SUB( oyjlTESTRESULT_SUCCESS,
+    "oyImage_RoiToSamples( NULL )" );
+  } else
+  { PRINT_SUB( oyjlTESTRESULT_FAIL,
+    "oyImage_RoiToSamples( NULL )" );
+  }
 
-  n = oyOption_GetValueInt( option, -1 );
-  if( n > 0 )
+
+  oyImage_SamplesToRoi( image, NULL, &roi );
+  oyRectangle_GetGeo( roi, &x,&y,&w,&h );
+
+  if(!error &&
+     x==0 && y == 0 && w == 1.0 && h == 1.0)
   { PRINT_SUB( oyjlTESTRESULT_SUCCESS,
-    "oyConversion_s input is connected to output %d", n );
+    "oyImage_SamplesToRoi( NULL )" );
   } else
   { PRINT_SUB( oyjlTESTRESULT_FAIL,
-    "oyConversion_s input is connected to output %d", n );
+    "oyImage_SamplesToRoi( NULL )" );
   }
-  oyFilterNode_Release( &node );
-  oyFilterNode_Release( &input_node );
-  oyFilterSocket_Release( &socket );
-  oyOption_Release( &option );
 
-  oyConversion_Release ( &cc );
-  OBJECT_COUNT_PRINT( oyjlTESTRESULT_FAIL, 0, 1, "objects run" )
 
+  oyRectangle_SetGeo( roi, 1.0/3.0, 1.0/3.0, 1.0/3.0, 2.0/3.0 );
+  oyImage_RoiToSamples( image, roi, &sample_rectangle );
+  oyRectangle_GetGeo( sample_rectangle, &x,&y,&w,&h );
+
+  if(!error &&
+     x==3 && y == 1 && w == 3 && h == 2)
+  { PRINT_SUB( oyjlTESTRESULT_SUCCESS,
+    "oyImage_RoiToSamples( roi )" );
+  } else
+  { PRINT_SUB( oyjlTESTRESULT_FAIL,
+    "oyImage_RoiToSamples( roi )" );
+  }
 
-  p_in = oyProfile_FromStd( oyEDITING_RGB, icc_profile_flags, testobj );
-  p_out = oyProfile_FromStd( oyASSUMED_WEB, icc_profile_flags, testobj );
-  input =oyImage_Create( src_width,src_height, 
-                         buf_16in,
-                         oyChannels_m(oyProfile_GetChannelsCount(p_in)+1) |
-                          oyDataType_m(buf_type_in),
-                         p_in,
-                         testobj );
-  output=oyImage_Create( dst_width,dst_height, 
-                         buf_16out,
-                         oyChannels_m(oyProfile_GetChannelsCount(p_out)+1) |
-                          oyDataType_m(data_type_request),
-                         p_out,
-                         testobj );
 
-  cc = oyConversion_FromImageForDisplay( input, output,
-                                         &icc, oyOPTIONATTRIBUTE_ADVANCED,
-                                         oyUINT16, NULL, testobj );
-  oyProfile_Release( &p_in );
-  oyProfile_Release( &p_out );
-  oyImage_Release( &input );
-  oyImage_Release( &output );
+  oyRectangle_SetGeo( sample_rectangle, 6,2, 3,1 );
+  oyImage_SamplesToRoi( image, sample_rectangle, &roi );
+  oyRectangle_GetGeo( roi, &x,&y,&w,&h );
 
-  socket = oyFilterNode_GetSocket( icc, 0 );
-  oyFilterSocket_Release( &socket );
-  oyFilterNode_Release( &icc );
+  if(!error &&
+     x==2.0/3.0 && y == 2.0/3.0 && w == 1.0/3.0 && h == 1.0/3.0)
+  { PRINT_SUB( oyjlTESTRESULT_SUCCESS,
+    "oyImage_SamplesToRoi( sample_rectangle )" );
+  } else
+  { PRINT_SUB( oyjlTESTRESULT_FAIL,
+    "oyImage_SamplesToRoi( sample_rectangle )" );
+  }
 
-  input_node = oyConversion_GetNode( cc, OY_INPUT );
-  socket = oyFilterNode_GetSocket( input_node, 0 );
-  oyFilterSocket_Release( &socket );
-  oyFilterNode_Release( &input_node );
-  oyConversion_Release ( &cc );
 
-  oyFree_m_(buf_16in);
-  oyFree_m_(buf_16out);
-  OBJECT_COUNT_PRINT( oyjlTESTRESULT_FAIL, 0, 1, "objects release" )
+  oyRectangle_SetGeo( sample_rectangle, 3, 1, 3, 2 );
+  oyImage_SamplesToPixels( image, sample_rectangle, pixel_rectangle );
+  oyRectangle_GetGeo( pixel_rectangle, &x,&y,&w,&h );
+
+  if(!error &&
+     x==1 && y == 1 && w == 1 && h == 2)
+  { PRINT_SUB( oyjlTESTRESULT_SUCCESS,
+    "oyImage_SamplesToPixels( )" );
+  } else
+  { PRINT_SUB( oyjlTESTRESULT_FAIL,
+    "oyImage_SamplesToPixels( )" );
+  }
+
+  oyRectangle_SetGeo( pixel_rectangle, 1, 1, 2, 2 );
+  oyImage_PixelsToSamples( image, pixel_rectangle, sample_rectangle );
+  oyRectangle_GetGeo( sample_rectangle, &x,&y,&w,&h );
+
+  if(!error &&
+     x==3 && y == 1 && w == 6 && h == 2)
+  { PRINT_SUB( oyjlTESTRESULT_SUCCESS,
+    "oyImage_PixelsToSamples( )" );
+  } else
+  { PRINT_SUB( oyjlTESTRESULT_FAIL,
+    "oyImage_PixelsToSamples( )" );
+  }
+
+
+  oyImage_Release( &image );
+  oyRectangle_Release( &sample_rectangle );
+  oyRectangle_Release( &pixel_rectangle );
+  oyRectangle_Release( &roi );
+
+  OBJECT_COUNT_PRINT( oyjlTESTRESULT_FAIL, 1, 0, NULL )
 
   return result;
 }
 
-oyjlTESTRESULT_e testScreenPixel()
+int myNodeSignal( oyObserver_s *observer OY_UNUSED, oySIGNAL_e signal_type, oyStruct_s *signal_data )
+{
+  int count = oyOption_GetValueInt( (oyOption_s*) signal_data, -1 );
+  if(signal_data && signal_data->type_ == oyOBJECT_OPTION_S)
+  {
+    ++count;
+    oyOption_SetFromInt( (oyOption_s*) signal_data, count, 0, 0 );
+  }
+
+  if(verbose || oy_debug_signals)
+  {
+    const char * desc = oyStruct_GetText(signal_data, oyNAME_NAME, 0);
+    fprintf( zout, "%s - %s\n", oySignalToString(signal_type),
+                                oyNoEmptyString_m_(desc) );
+  }
+  return 0;
+}
+
+#include "../examples/image_display/oyranos_display_helpers.h"
+oyjlTESTRESULT_e testDAG2()
 {
   oyjlTESTRESULT_e result = oyjlTESTRESULT_UNKNOWN;
   OBJECT_COUNT_SETUP
   uint32_t icc_profile_flags =oyICCProfileSelectionFlagsFromOptions( OY_CMM_STD,
                                        "//" OY_TYPE_STD "/icc_color", NULL, 0 );
-  oyProfile_s * p_rgb = oyProfile_FromStd( oyEDITING_RGB, icc_profile_flags, testobj );
-  oyProfile_s * p_web = oyProfile_FromStd( oyASSUMED_WEB, icc_profile_flags, testobj );
   oyProfile_s * p_in = NULL, * p_out = NULL;
   int error = 0,
-      i = 2,n = 10;
+      n = 10;
   const int src_width  = 4 * 1024,
       src_height =     512,
       dst_width  = 2 * 1024,
@@ -8081,10 +8883,13 @@ oyjlTESTRESULT_e testScreenPixel()
   oyDATATYPE_e buf_type_in = oyUINT16,
                data_type_request = oyUINT16;
   oyImage_s *input = NULL, *output = NULL;
+  oyConversion_s * cc = NULL;
+  oyFilterNode_s * icc = NULL, * rectangles = NULL, * node = NULL, * input_node = NULL;
+  oyFilterSocket_s * socket = NULL;
+  oyOption_s * option = NULL;
 
   fprintf(stdout, "\n" );
 
-  double clck = oyClock();
   for(y = 0; y < src_height; ++y)
     for(x = 0; x < src_width; ++x)
     {
@@ -8094,8 +8899,8 @@ oyjlTESTRESULT_e testScreenPixel()
       buf_16in[y*src_width*channels + x*channels + 3] = x;
     }
 
-  p_in = p_web;
-  p_out = p_rgb;
+  p_in = oyProfile_FromStd( oyEDITING_RGB, icc_profile_flags, testobj );
+  p_out = oyProfile_FromStd( oyASSUMED_WEB, icc_profile_flags, testobj );
   input =oyImage_Create( src_width,src_height, 
                          buf_16in,
                          oyChannels_m(oyProfile_GetChannelsCount(p_in)+1) |
@@ -8108,16 +8913,241 @@ oyjlTESTRESULT_e testScreenPixel()
                           oyDataType_m(data_type_request),
                          p_out,
                          testobj );
-  clck = oyClock() - clck;
-  fprintf( zout, "%s\n",
-    oyjlPrintSubProfiling( -1, 1,clck/(double)CLOCKS_PER_SEC,"in+out-images",
-      "Preparation finished") );
 
-  if(getenv("OY_DEBUG_WRITE"))
-  {
-    const char * fn = "test2-oyDrawScreenImage-src.ppm";
-    fprintf( zout, "wrote PPM               %s\n", fn );
-    oyImage_WritePPM( input, fn, "test2::screen source image" );
+  cc = oyConversion_FromImageForDisplay( input, output,
+                                         &icc, oyOPTIONATTRIBUTE_ADVANCED,
+                                         oyUINT16, NULL, testobj );
+  if(verbose)
+    oyObjectTreePrint( 0x01 | 0x02 | 0x04 | 0x08, "display graph" );
+
+  node = oyFilterNode_Copy( icc, 0 );
+  input_node = oyFilterNode_GetPlugNode( node, 0 );
+
+  /* insert a "rectangles" filter to handle multiple monitors */
+  rectangles = oyFilterNode_NewWith( "//" OY_TYPE_STD "/rectangles", 0, 0 );
+  /* insert "rectangles" between "display" and its input_node */
+  fprintf( zout, "%s -> %s\n", oyFilterNode_GetRegistration( input_node ), oyFilterNode_GetRegistration( node ) );
+  oyFilterNode_Disconnect( node, 0 );
+  error = oyFilterNode_Connect( input_node, "//" OY_TYPE_STD "/data",
+                                rectangles, "//" OY_TYPE_STD "/data",0 );
+  error = oyFilterNode_Connect( rectangles, "//" OY_TYPE_STD "/data",
+                                node, "//" OY_TYPE_STD "/data",0 );
+  oyFilterNode_Release( &node );
+  oyFilterNode_Release( &input_node );
+  if(verbose)
+    oyObjectTreePrint( 0x01 | 0x02 | 0x04 | 0x08, "rectangles connected" );
+
+  if( !error )
+  { PRINT_SUB( oyjlTESTRESULT_SUCCESS,
+    "insert node" );
+  } else
+  { PRINT_SUB( oyjlTESTRESULT_FAIL,
+    "insert node" );
+  }
+
+
+  oyProfile_Release( &p_in );
+  oyProfile_Release( &p_out );
+  oyImage_Release( &input );
+  oyImage_Release( &output );
+  oyFilterNode_Release( &icc );
+  oyConversion_Release ( &cc );
+
+
+  p_in = oyProfile_FromStd( oyEDITING_RGB, icc_profile_flags, testobj );
+  p_out = oyProfile_FromStd( oyASSUMED_WEB, icc_profile_flags, testobj );
+  input =oyImage_Create( src_width,src_height, 
+                         buf_16in,
+                         oyChannels_m(oyProfile_GetChannelsCount(p_in)+1) |
+                          oyDataType_m(buf_type_in),
+                         p_in,
+                         testobj );
+  output=oyImage_Create( dst_width,dst_height, 
+                         buf_16out,
+                         oyChannels_m(oyProfile_GetChannelsCount(p_out)+1) |
+                          oyDataType_m(data_type_request),
+                         p_out,
+                         testobj );
+
+  cc = oyConversion_FromImageForDisplay( input, output,
+                                         &icc, oyOPTIONATTRIBUTE_ADVANCED,
+                                         oyUINT16, NULL, testobj );
+  const char * hash = oyFilterNode_GetText( icc, oyNAME_NAME );
+
+  if( hash )
+  { PRINT_SUB( oyjlTESTRESULT_SUCCESS,
+    "hashed node" );
+  } else
+  { PRINT_SUB( oyjlTESTRESULT_FAIL,
+    "hashed node" );
+  }
+
+  oyProfile_Release( &p_in );
+  oyProfile_Release( &p_out );
+  oyImage_Release( &input );
+  oyImage_Release( &output );
+  oyFilterNode_Release( &icc );
+  oyConversion_Release ( &cc );
+  OBJECT_COUNT_PRINT( oyjlTESTRESULT_FAIL, 0, 1, "objects hash" )
+
+
+  p_in = oyProfile_FromStd( oyEDITING_RGB, icc_profile_flags, testobj );
+  p_out = oyProfile_FromStd( oyASSUMED_WEB, icc_profile_flags, testobj );
+  input =oyImage_Create( src_width,src_height, 
+                         buf_16in,
+                         oyChannels_m(oyProfile_GetChannelsCount(p_in)+1) |
+                          oyDataType_m(buf_type_in),
+                         p_in,
+                         testobj );
+  output=oyImage_Create( dst_width,dst_height, 
+                         buf_16out,
+                         oyChannels_m(oyProfile_GetChannelsCount(p_out)+1) |
+                          oyDataType_m(data_type_request),
+                         p_out,
+                         testobj );
+
+  cc = oyConversion_FromImageForDisplay( input, output,
+                                         &icc, oyOPTIONATTRIBUTE_ADVANCED,
+                                         oyUINT16, NULL, testobj );
+  oyProfile_Release( &p_in );
+  oyProfile_Release( &p_out );
+  oyImage_Release( &input );
+  oyImage_Release( &output );
+  oyFilterNode_Release( &icc );
+
+  input_node = oyConversion_GetNode( cc, OY_INPUT );
+  node = oyConversion_GetNode( cc, OY_OUTPUT );
+  option = oyOption_FromRegistration( OY_STD "/node/count", testobj );
+  error = oyStruct_ObserverAdd( (oyStruct_s*)node, (oyStruct_s*)node,
+                                (oyStruct_s*)option, myNodeSignal );
+
+  //{ char * text = oyjlBT(-1); oyObjectTreePrint( 0x01 | 0x02 | 0x04 | 0x08, text ? text : __func__ ); oyFree_m_( text ) }
+#if 0
+  /* graph broadcast */
+  socket = oyFilterNode_GetSocket( input_node, 0 );
+  oyFilterSocket_SignalToGraph( socket, oyCONNECTOR_EVENT_DATA_CHANGED );
+#else
+  /* let oyFilterNode_Run() emit a signal on filter call and observe the ticket */
+  oyConversion_RunPixels( cc, NULL );
+#endif
+  //{ char * text = oyjlBT(-1); oyObjectTreePrint( 0x01 | 0x02 | 0x04 | 0x08, text ? text : __func__ ); oyFree_m_( text ) }
+
+  n = oyOption_GetValueInt( option, -1 );
+  if( n > 0 )
+  { PRINT_SUB( oyjlTESTRESULT_SUCCESS,
+    "oyConversion_s input is connected to output %d", n );
+  } else
+  { PRINT_SUB( oyjlTESTRESULT_FAIL,
+    "oyConversion_s input is connected to output %d", n );
+  }
+  oyFilterNode_Release( &node );
+  oyFilterNode_Release( &input_node );
+  oyFilterSocket_Release( &socket );
+  oyOption_Release( &option );
+
+  oyConversion_Release ( &cc );
+  OBJECT_COUNT_PRINT( oyjlTESTRESULT_FAIL, 0, 1, "objects run" )
+
+
+  p_in = oyProfile_FromStd( oyEDITING_RGB, icc_profile_flags, testobj );
+  p_out = oyProfile_FromStd( oyASSUMED_WEB, icc_profile_flags, testobj );
+  input =oyImage_Create( src_width,src_height, 
+                         buf_16in,
+                         oyChannels_m(oyProfile_GetChannelsCount(p_in)+1) |
+                          oyDataType_m(buf_type_in),
+                         p_in,
+                         testobj );
+  output=oyImage_Create( dst_width,dst_height, 
+                         buf_16out,
+                         oyChannels_m(oyProfile_GetChannelsCount(p_out)+1) |
+                          oyDataType_m(data_type_request),
+                         p_out,
+                         testobj );
+
+  cc = oyConversion_FromImageForDisplay( input, output,
+                                         &icc, oyOPTIONATTRIBUTE_ADVANCED,
+                                         oyUINT16, NULL, testobj );
+  oyProfile_Release( &p_in );
+  oyProfile_Release( &p_out );
+  oyImage_Release( &input );
+  oyImage_Release( &output );
+
+  socket = oyFilterNode_GetSocket( icc, 0 );
+  oyFilterSocket_Release( &socket );
+  oyFilterNode_Release( &icc );
+
+  input_node = oyConversion_GetNode( cc, OY_INPUT );
+  socket = oyFilterNode_GetSocket( input_node, 0 );
+  oyFilterSocket_Release( &socket );
+  oyFilterNode_Release( &input_node );
+  oyConversion_Release ( &cc );
+
+  oyFree_m_(buf_16in);
+  oyFree_m_(buf_16out);
+  OBJECT_COUNT_PRINT( oyjlTESTRESULT_FAIL, 0, 1, "objects release" )
+
+  return result;
+}
+
+oyjlTESTRESULT_e testScreenPixel()
+{
+  oyjlTESTRESULT_e result = oyjlTESTRESULT_UNKNOWN;
+  OBJECT_COUNT_SETUP
+  uint32_t icc_profile_flags =oyICCProfileSelectionFlagsFromOptions( OY_CMM_STD,
+                                       "//" OY_TYPE_STD "/icc_color", NULL, 0 );
+  oyProfile_s * p_rgb = oyProfile_FromStd( oyEDITING_RGB, icc_profile_flags, testobj );
+  oyProfile_s * p_web = oyProfile_FromStd( oyASSUMED_WEB, icc_profile_flags, testobj );
+  oyProfile_s * p_in = NULL, * p_out = NULL;
+  int error = 0,
+      i = 2,n = 10;
+  const int src_width  = 4 * 1024,
+      src_height =     512,
+      dst_width  = 2 * 1024,
+      dst_height =     256,
+      channels = 4;
+  int x,y;
+  uint16_t * buf_16in  = (uint16_t*) calloc(sizeof(uint16_t), src_width * src_height * channels);
+  uint16_t * buf_16out = (uint16_t*) calloc(sizeof(uint16_t), dst_width * dst_height * channels);
+  oyDATATYPE_e buf_type_in = oyUINT16,
+               data_type_request = oyUINT16;
+  oyImage_s *input = NULL, *output = NULL;
+
+  fprintf(stdout, "\n" );
+
+  double clck = oyClock();
+  for(y = 0; y < src_height; ++y)
+    for(x = 0; x < src_width; ++x)
+    {
+      buf_16in[y*src_width*channels + x*channels + 0] = (y / (double)(src_height-1)) * 65535;
+      buf_16in[y*src_width*channels + x*channels + 1] = (1.0 - (y / (double)(src_height-1))) * 65535;
+      buf_16in[y*src_width*channels + x*channels + 2] = y;
+      buf_16in[y*src_width*channels + x*channels + 3] = x;
+    }
+
+  p_in = p_web;
+  p_out = p_rgb;
+  input =oyImage_Create( src_width,src_height, 
+                         buf_16in,
+                         oyChannels_m(oyProfile_GetChannelsCount(p_in)+1) |
+                          oyDataType_m(buf_type_in),
+                         p_in,
+                         testobj );
+  output=oyImage_Create( dst_width,dst_height, 
+                         buf_16out,
+                         oyChannels_m(oyProfile_GetChannelsCount(p_out)+1) |
+                          oyDataType_m(data_type_request),
+                         p_out,
+                         testobj );
+  clck = oyClock() - clck;
+  fprintf( zout, "%s\n",
+    oyjlPrintSubProfiling( -1, 1,clck/(double)CLOCKS_PER_SEC,"in+out-images",
+      "Preparation finished") );
+
+  if(getenv("OY_DEBUG_WRITE"))
+  {
+    const char * fn = "test2-oyDrawScreenImage-src.ppm";
+    fprintf( zout, "wrote PPM               %s\n", fn );
+    oyImage_WritePPM( input, fn, "test2::screen source image" );
   }
 
   oyFilterPlug_s * plug = NULL;
@@ -9485,193 +10515,1621 @@ oyjlTESTRESULT_e testICCsCheck()
     /* Is the float conversion ~ equal to the integer math? */
     if(!error && (max <= delta))
     { PRINT_SUB( oyjlTESTRESULT_SUCCESS,
-      "relative colorimetric intent, integer equal float %3.5f[%g]", max*100.0, delta*100.0 );
+      "relative colorimetric intent, integer equal float %3.5f[%g]", max*100.0, delta*100.0 );
+    } else
+    { PRINT_SUB( oyjlTESTRESULT_XFAIL,
+      "relative colorimetric intent, integer equal float %3.5f[%g] %%", max*100.0, delta*100.0 );
+      show_details = 1;
+    }
+
+    if(show_details)
+    {
+      fprintf( zout, "buf_f32in  %g %g %g   %g %g %g\n           %g %g %g   %g %g %g\n",
+               buf_f32in2x2[0], buf_f32in2x2[1], buf_f32in2x2[2],
+               buf_f32in2x2[3], buf_f32in2x2[4], buf_f32in2x2[5],
+               buf_f32in2x2[6], buf_f32in2x2[7], buf_f32in2x2[8],
+               buf_f32in2x2[9], buf_f32in2x2[10], buf_f32in2x2[11]);
+      fprintf( zout, "buf_f32out %g %g %g   %g %g %g\n           %g %g %g   %g %g %g\n",
+               buf_f32out2x2[0], buf_f32out2x2[1], buf_f32out2x2[2],
+               buf_f32out2x2[3], buf_f32out2x2[4], buf_f32out2x2[5],
+               buf_f32out2x2[6], buf_f32out2x2[7], buf_f32out2x2[8],
+               buf_f32out2x2[9], buf_f32out2x2[10], buf_f32out2x2[11]);
+
+      oyBlob_s * b = getDL( cc, reg_nick, i );
+      oyBlob_Release( &b );
+
+      fprintf( zout, "options where: %s\n", oyOptions_GetText( options, oyNAME_NICK ) );
+    } show_details = verbose;
+
+    buf_f32in2x2[0] = 0.0;
+    buf_f32in2x2[1] = 0.0;
+    buf_f32in2x2[2] = 1.0;
+    error = oyConversion_RunPixels( cc, NULL );
+    if(error) PRINT_SUB( oyjlTESTRESULT_XFAIL, "oyConversion_RunPixels() error: %d", error )
+    float blue[3] = { buf_f32out2x2[0], buf_f32out2x2[1], buf_f32out2x2[2] };
+    oyOptions_Release( &options );
+    oyConversion_Release( &cc );
+
+
+    oyOptions_SetFromString( &options, OY_DEFAULT_CMM_CONTEXT, reg_pattern, OY_CREATE_NEW );
+    oyOptions_SetFromString( &options, OY_DEFAULT_RENDERING_INTENT, "1", OY_CREATE_NEW );
+    oyOptions_SetFromString( &options, OY_DEFAULT_PROOF_SOFT, "1", OY_CREATE_NEW );
+    p_in = oyProfile_FromStd( oyASSUMED_WEB, icc_profile_flags, testobj );
+    cc = oyConversion_CreateBasicPixelsFromBuffers(
+                              p_in, buf_f32in2x2, oyDataType_m(buf_type_in),
+                              p_out, buf_f32out2x2, oyDataType_m(buf_type_out),
+                                                    options, 4 );
+    oyProfile_Release( &p_in );
+    error = oyOptions_SetFromString( &options,
+                                     "//" OY_TYPE_STD "/config/display_mode", "1",
+                                     OY_CREATE_NEW );
+    if(error) PRINT_SUB( oyjlTESTRESULT_XFAIL, "oyOptions_SetFromString() error: %d", error )
+    /* activate policy */
+    error = oyConversion_Correct( cc, "//" OY_TYPE_STD "/icc_color", oyOPTIONATTRIBUTE_ADVANCED, options);
+    if(error) PRINT_SUB( oyjlTESTRESULT_XFAIL, "oyConversion_Correct() error: %d", error )
+    error = oyConversion_RunPixels( cc, NULL );
+    /* Is the float conversion ~ equal to the integer math? */
+    if(!error && (blue[0] != buf_f32out2x2[0] ||
+                  blue[1] != buf_f32out2x2[1] ||
+                  blue[2] != buf_f32out2x2[2]    ))
+    { PRINT_SUB( oyjlTESTRESULT_SUCCESS,
+      "relative colorimetric intent, simulation blue  %g %g %g -> %g %g %g", blue[0], blue[1], blue[2], buf_f32out2x2[0], buf_f32out2x2[1], buf_f32out2x2[2] );
+    } else
+    { PRINT_SUB( oyjlTESTRESULT_XFAIL,
+      "relative colorimetric intent, simulation blue  %g %g", blue[0], buf_f32out2x2[0] );
+      show_details = 1;
+    }
+
+    if(show_details)
+    {
+      fprintf( zout, "buf_f32in  %g %g %g\n",
+               buf_f32in2x2[0], buf_f32in2x2[1], buf_f32in2x2[2]);
+      fprintf( zout, "previous   %g %g %g\n",
+               blue[0], blue[1], blue[2]);
+      fprintf( zout, "simulation %g %g %g\n",
+               buf_f32out2x2[0], buf_f32out2x2[1], buf_f32out2x2[2]);
+    } show_details = verbose;
+    oyOptions_Release( &options );
+    oyConversion_Release( &cc );
+
+
+    /* test multi profile transforms */
+    oyOptions_SetFromString( &options, OY_DEFAULT_CMM_CONTEXT, reg_pattern, OY_CREATE_NEW );
+    oyOptions_SetFromString( &options, OY_DEFAULT_RENDERING_INTENT, "0", OY_CREATE_NEW );
+    oyOptions_SetFromString( &options, OY_DEFAULT_PROOF_SOFT, "1", OY_CREATE_NEW );
+    oyProfile_s * p_cmyk = oyProfile_FromStd( oyEDITING_CMYK, icc_profile_flags, NULL );
+    proofing = oyProfiles_New(NULL);
+    oyProfiles_MoveIn( proofing, &p_cmyk, -1 );
+    error = oyOptions_MoveInStruct ( &options,
+                                     OY_PROFILES_SIMULATION,
+                                     (oyStruct_s**) &proofing,
+                                     OY_CREATE_NEW );
+    cc = oyConversion_CreateFromImage (
+                                input, options,
+                                p_out, oyUINT16, 0, 0 );
+    oyImage_Release( &input );
+    oyBlob_s * blob = getDL( cc, reg_nick, show_details?i:-1 );
+    if(!show_details)
+      oyWriteMemToFile_( "test-getDL-non-verbose.icc", oyBlob_GetPointer( blob ), oyBlob_GetSize( blob) );
+
+    oyProfile_s * dl;
+    dl = oyProfile_FromMem( oyBlob_GetSize( blob ),
+                            oyBlob_GetPointer( blob ), 0,0 );
+    const char * fn;
+    j = 0;
+    if(verbose)
+    {
+      while((fn = oyProfile_GetFileName( dl, j )) != NULL)
+        fprintf( zout, " -> \"%s\"[%d]", oyNoEmptyString_m_(fn), j++ );
+      fprintf( zout, "\n" );
+    } else
+    {
+      oyProfileTag_s * psid = oyProfile_GetTagById( dl, (icTagSignature)icSigProfileSequenceIdentifierTag );
+      int texts_n = 0;
+      char ** texts = oyProfileTag_GetText( psid, &texts_n, 0,0,0,0);
+      if(texts_n && texts[0])
+      {
+        long l = 0;
+        if(oyjlStringToLong( texts[0], &l, 0 ) <= 0)
+          j = l;
+      }
+      oyjlStringListRelease( &texts, texts_n, oyDeAllocateFunc_ );
+      if((texts_n -1) / 5 != j)
+      { PRINT_SUB( oyjlTESTRESULT_XFAIL,
+        "dl psid texts = %d (1+5*nProfiles) but announced psid profiles: %d", texts_n, j );
+      }
+      oyProfileTag_Release( &psid );
+    }
+    oyBlob_Release( &blob );
+    oyProfile_Release( &dl );
+
+    if(!error && j == 3)
+    { PRINT_SUB( oyjlTESTRESULT_SUCCESS,
+      "device link contains 2 profiles + simulation == %d", j );
+    } else
+    { PRINT_SUB( oyjlTESTRESULT_XFAIL,
+      "device link contains 2 profiles + simulation == %d", j );
+    }
+
+    oyOptions_s * node_opts = oyFilterNode_GetOptions( icc, oyOPTIONATTRIBUTE_ADVANCED );
+    char * ui_text = NULL;
+    char ** namespaces = NULL;
+    oyFilterNode_GetUi( icc, oyNAME_JSON, &ui_text, &namespaces, malloc );
+    const char * data = NULL;
+    int text_type = oyjlDataFormat(ui_text);
+    if(text_type != oyNAME_JSON)
+    { PRINT_SUB( oyjlTESTRESULT_XFAIL,
+      "text type of oyFilterNode_GetUi(%s) not JSON: 7|%d", reg_nick, text_type );
+    } else
+    {
+      data = oyOptions_GetText( node_opts, (oyNAME_e) oyNAME_JSON );
+      char * text = NULL;
+      text = oyJsonFromModelAndUi( data, ui_text, malloc );
+      if(oyjlDataFormat(text) == oyNAME_JSON)
+      { PRINT_SUB( oyjlTESTRESULT_SUCCESS,
+        "oyJsonFromModelAndUi()                   len=%d", (int)strlen(text) );
+      } else
+      { PRINT_SUB( oyjlTESTRESULT_FAIL,
+        "oyJsonFromModelAndUi()                  type=%d", oyjlDataFormat(text) );
+      }
+      oyFree_m_( text );
+    }
+    oyOptions_Release( &node_opts );
+    oyFree_m_( ui_text );
+
+    oyOptions_Release( &options );
+    oyConversion_Release( &cc );
+
+    oyProfile_Release( &p_in );
+    oyProfile_Release( &p_out );
+
+
+    ++i;
+
+    oyFree_m_( reg_pattern );
+    oyFree_m_( reg_nick );
+    oyFree_m_( reg );
+    oyFilterNode_Release( &icc );
+    oyFilterGraph_Release( &cc_graph );
+  }
+
+  i = 0;
+  if(list)
+  {
+    while(list[i])
+      free(list[i++]);
+    free(list);
+  }
+
+  OBJECT_COUNT_PRINT( oyjlTESTRESULT_XFAIL, 1, 0, NULL )
+
+  return result;
+}
+
+oyjlTESTRESULT_e testGamutCheck()
+{
+  oyjlTESTRESULT_e result = oyjlTESTRESULT_UNKNOWN;
+  int i, n = 1000000, outside = 0;
+  oyProfile_s * proof = oyProfile_FromStd( oyASSUMED_WEB, 0, testobj );
+  oyProfiles_s * proofing = oyProfiles_New( testobj );
+  oyConversion_s * gc;
+  double * lab = (double*) calloc( sizeof(double), 3*n ),
+         * dE = (double*) calloc( sizeof(double), n ),
+         clck;
+  int * is_outside = (int*) calloc( sizeof(int), n );
+  OBJECT_COUNT_SETUP
+
+  fprintf(stdout, "\n" );
+
+  oyProfiles_MoveIn( proofing, &proof, -1 );
+
+  clck = oyClock();
+  gc = oyConversion_CreateGamutCheck( NULL, proofing, NULL, testobj );
+  clck = oyClock() - clck;
+  if(gc)
+  { PRINT_SUB_PROFILING( oyjlTESTRESULT_SUCCESS, 1,clck/(double)CLOCKS_PER_SEC,"ctx",
+    "oyConversion_CreateGamutCheck()" );
+  } else
+  { PRINT_SUB( oyjlTESTRESULT_FAIL,
+    "oyConversion_CreateGamutCheck()" );
+  }
+
+  /* grey axis inside, saturated red and blue far outside of sRGB */
+  for(i = 0; i < 3; ++i)
+  {
+    lab[i*3+0] = 0.2 + 0.3 * i; lab[i*3+1] = lab[i*3+2] = 0.5;
+  }
+  lab[ 9] = 0.5; lab[10] = 0.95; lab[11] = 0.5;
+  lab[12] = 0.3; lab[13] = 0.5; lab[14] = 0.02;
+  outside = oyConversion_GamutCheck( gc, lab, 5, is_outside, dE );
+  if(outside == 2 &&
+     !is_outside[0] && !is_outside[1] && !is_outside[2] &&
+     is_outside[3] && is_outside[4] &&
+     dE[1] < 2.0 && dE[3] > 10.0)
+  { PRINT_SUB( oyjlTESTRESULT_SUCCESS,
+    "oyConversion_GamutCheck() grey inside, primaries outside" );
+  } else
+  { PRINT_SUB( oyjlTESTRESULT_XFAIL,
+    "oyConversion_GamutCheck() grey inside, primaries outside: %d", outside );
+  }
+  if(verbose)
+    for(i = 0; i < 5; ++i)
+      fprintf( zout, "Lab %g %g %g outside: %d dE: %g\n",
+               lab[i*3+0], lab[i*3+1], lab[i*3+2], is_outside[i], dE[i] );
+
+  for(i = 0; i < n; ++i)
+  {
+    lab[i*3+0] = (i % 101) / 100.0;
+    lab[i*3+1] = ((i / 101) % 97) / 96.0;
+    lab[i*3+2] = ((i / 9797) % 89) / 88.0;
+  }
+  clck = oyClock();
+  outside = oyConversion_GamutCheck( gc, lab, n, is_outside, NULL );
+  clck = oyClock() - clck;
+  if(outside > 0 && outside < n)
+  { PRINT_SUB_PROFILING( oyjlTESTRESULT_SUCCESS, n,clck/(double)CLOCKS_PER_SEC,"color",
+    "oyConversion_GamutCheck() %d outside", outside );
+  } else
+  { PRINT_SUB( oyjlTESTRESULT_XFAIL,
+    "oyConversion_GamutCheck() %d outside", outside );
+  }
+
+  clck = oyClock();
+  outside = oyConversion_GamutCheck( gc, lab, n, is_outside, dE );
+  clck = oyClock() - clck;
+  if(outside >= 0)
+  { PRINT_SUB_PROFILING( oyjlTESTRESULT_SUCCESS, n,clck/(double)CLOCKS_PER_SEC,"color",
+    "oyConversion_GamutCheck() + dE" );
+  } else
+  { PRINT_SUB( oyjlTESTRESULT_XFAIL,
+    "oyConversion_GamutCheck() + dE" );
+  }
+
+  oyConversion_Release( &gc );
+  oyProfiles_Release( &proofing );
+  free( lab );
+  free( dE );
+  free( is_outside );
+
+  OBJECT_COUNT_PRINT( oyjlTESTRESULT_FAIL, 1, 0, NULL )
+
+  return result;
+}
+
+oyjlTESTRESULT_e testSpectralXYZ()
+{
+  oyjlTESTRESULT_e result = oyjlTESTRESULT_UNKNOWN;
+  int i, j, k, n = 10000, bands = 36, repeat = 100, nan_count = 0;
+  double * spectra = (double*) calloc( sizeof(double), bands*n ),
+         * XYZ = (double*) calloc( sizeof(double), 3*n ),
+         ref[3] = {0,0,0},
+         clck;
+  oySpectralWeights_s * w;
+  OBJECT_COUNT_SETUP
+
+  fprintf(stdout, "\n" );
+
+  /* 380-730nm in 10nm steps, equal energy illuminant */
+  w = oySpectralWeightsCreate( 380, 10, bands, 2, NULL );
+  for(i = 0; i < bands; ++i)
+    spectra[i] = 1.0;
+  nan_count = oySpectralToXYZ( w, spectra, 1, 0, XYZ );
+  if(w && nan_count == 0 && fabs(XYZ[1] - 1.0) < 1e-9)
+  { PRINT_SUB( oyjlTESTRESULT_SUCCESS,
+    "oySpectralToXYZ() perfect reflector Y = %g", XYZ[1] );
+  } else
+  { PRINT_SUB( oyjlTESTRESULT_FAIL,
+    "oySpectralToXYZ() perfect reflector Y = %g", XYZ[1] );
+  }
+
+  for(j = 0; j < n; ++j)
+    for(i = 0; i < bands; ++i)
+      spectra[j*bands + i] = 0.5 + 0.5 * sin( (j % 97) * 0.1 + i * 0.2 );
+
+  /* plain per band sums */
+  for(i = 0; i < bands; ++i)
+    for(k = 0; k < 3; ++k)
+      ref[k] += spectra[5*bands + i] * w->weights[k*bands + i];
+  nan_count = oySpectralToXYZ( w, spectra, n, 0, XYZ );
+  if(nan_count == 0 &&
+     fabs(XYZ[5*3+0] - ref[0]) < 1e-9 &&
+     fabs(XYZ[5*3+1] - ref[1]) < 1e-9 &&
+     fabs(XYZ[5*3+2] - ref[2]) < 1e-9)
+  { PRINT_SUB( oyjlTESTRESULT_SUCCESS,
+    "oySpectralToXYZ() matches per band sums" );
+  } else
+  { PRINT_SUB( oyjlTESTRESULT_FAIL,
+    "oySpectralToXYZ() matches per band sums %g %g %g",
+    XYZ[5*3+0] - ref[0], XYZ[5*3+1] - ref[1], XYZ[5*3+2] - ref[2] );
+  }
+
+  clck = oyClock();
+  for(i = 0; i < repeat; ++i)
+    nan_count += oySpectralToXYZ( w, spectra, n, 0, XYZ );
+  clck = oyClock() - clck;
+  if(nan_count == 0)
+  { PRINT_SUB_PROFILING( oyjlTESTRESULT_SUCCESS, n*repeat,clck/(double)CLOCKS_PER_SEC,"spectra",
+    "oySpectralToXYZ() %d bands", bands );
+  } else
+  { PRINT_SUB( oyjlTESTRESULT_FAIL,
+    "oySpectralToXYZ() %d bands", bands );
+  }
+
+  clck = oyClock();
+  for(i = 0; i < repeat; ++i)
+    nan_count += oySpectralToLab( w, spectra, n, 0, XYZ );
+  clck = oyClock() - clck;
+  if(nan_count == 0 && XYZ[0] > 0.0)
+  { PRINT_SUB_PROFILING( oyjlTESTRESULT_SUCCESS, n*repeat,clck/(double)CLOCKS_PER_SEC,"spectra",
+    "oySpectralToLab() %d bands", bands );
+  } else
+  { PRINT_SUB( oyjlTESTRESULT_FAIL,
+    "oySpectralToLab() %d bands", bands );
+  }
+
+  spectra[3] = NAN;
+  nan_count = oySpectralToXYZ( w, spectra, n, 0, XYZ );
+  if(nan_count == 1)
+  { PRINT_SUB( oyjlTESTRESULT_SUCCESS,
+    "oySpectralToXYZ() counts missing values" );
+  } else
+  { PRINT_SUB( oyjlTESTRESULT_FAIL,
+    "oySpectralToXYZ() counts missing values: %d", nan_count );
+  }
+
+  oySpectralWeightsRelease( &w );
+  free( spectra );
+  free( XYZ );
+
+  OBJECT_COUNT_PRINT( oyjlTESTRESULT_FAIL, 1, 0, NULL )
+
+  return result;
+}
+
+#include "oyranos_measurement.h"
+oyjlTESTRESULT_e testMeasurementParse()
+{
+  oyjlTESTRESULT_e result = oyjlTESTRESULT_UNKNOWN;
+  int i, j, n = 10000, bands = 36, repeat = 10;
+  const char * cgats = "CGATS.17\n"
+                       "DESCRIPTOR \"two patches\"\n"
+                       "NUMBER_OF_FIELDS 6\n"
+                       "BEGIN_DATA_FORMAT\n"
+                       "SAMPLE_ID SAMPLE_NAME LAB_L LAB_A SPECTRAL_NM380 SPECTRAL_NM390\n"
+                       "END_DATA_FORMAT\n"
+                       "NUMBER_OF_SETS 2\n"
+                       "BEGIN_DATA\n"
+                       "1 \"A 1\" 50.5 -2e1 0.25 0.5\n"
+                       "2 B2 10 3 .75 1\n"
+                       "END_DATA\n",
+             * csv = "nm,\"p1\",\"p2\"\n"
+                     "380,0.1,0.2\n"
+                     "390,0.3,0.4\r\n",
+             * cxf = "<?xml version=\"1.0\"?>\n<cc:CxF xmlns:cc=\"http://colorexchangeformat.com/CxF3-core\">"
+                     "<cc:Resources><cc:ObjectCollection>"
+                     "<cc:Object ObjectType=\"Standard\" Name=\"Red\" Id=\"1\"><cc:ColorValues>"
+                     "<cc:ReflectanceSpectrum ColorSpecification=\"s\" StartWL=\"400\">0.1 0.2 0.3</cc:ReflectanceSpectrum>"
+                     "</cc:ColorValues></cc:Object>"
+                     "</cc:ObjectCollection>"
+                     "<cc:ColorSpecificationCollection><cc:ColorSpecification><cc:MeasurementSpec>"
+                     "<cc:WavelengthRange StartWL=\"400\" Increment=\"20\"/>"
+                     "</cc:MeasurementSpec></cc:ColorSpecification></cc:ColorSpecificationCollection>"
+                     "</cc:Resources></cc:CxF>";
+  char * text = NULL;
+  size_t size = 0;
+  double clck;
+  oyMeasurement_s * m;
+  oyjl_val root;
+  OBJECT_COUNT_SETUP
+
+  fprintf(stdout, "\n" );
+
+  m = oyMeasurementParse( cgats, 0, oyMEASUREMENT_UNKNOWN );
+  if(m && m->format == oyMEASUREMENT_CGATS && m->count == 2 && m->columns == 4 &&
+     m->bands == 2 && m->spectral == 2 && m->start == 380 && m->lambda == 10 &&
+     m->values[1] == -20.0 && m->values[4+3] == 1.0 &&
+     m->names[0] && strcmp(m->names[0], "A 1") == 0 &&
+     oyMeasurementFindColumn( m, "LAB_L" ) == 0 &&
+     m->description && strcmp(m->description, "two patches") == 0)
+  { PRINT_SUB( oyjlTESTRESULT_SUCCESS,
+    "oyMeasurementParse( CGATS )" );
+  } else
+  { PRINT_SUB( oyjlTESTRESULT_FAIL,
+    "oyMeasurementParse( CGATS )" );
+  }
+
+  root = oyMeasurementToTree( m );
+  {
+    oyjl_val v = oyjlTreeGetValue( root, 0, "collection/[0]/colors/[1]/spectral/[0]/data/[0]" );
+    if(v && OYJL_GET_DOUBLE(v) == 0.75 &&
+       oyjlValueCount( oyjlTreeGetValue( root, 0, "collection/[0]/colors" ) ) == 2 &&
+       oyjlTreeGetValue( root, 0, "collection/[0]/colors/[0]/lab/[0]/data/[2]" ) == NULL)
+    { PRINT_SUB( oyjlTESTRESULT_SUCCESS,
+      "oyMeasurementToTree()" );
+    } else
+    { PRINT_SUB( oyjlTESTRESULT_FAIL,
+      "oyMeasurementToTree()" );
+    }
+  }
+  oyjlTreeFree( root );
+  oyMeasurementRelease( &m );
+
+  m = oyMeasurementParse( csv, 0, oyMEASUREMENT_UNKNOWN );
+  if(m && m->format == oyMEASUREMENT_CSV && m->count == 2 && m->bands == 2 &&
+     m->values[1] == 0.3 && m->values[2] == 0.2 &&
+     m->names[1] && strcmp(m->names[1], "p2") == 0)
+  { PRINT_SUB( oyjlTESTRESULT_SUCCESS,
+    "oyMeasurementParse( CSV )" );
+  } else
+  { PRINT_SUB( oyjlTESTRESULT_FAIL,
+    "oyMeasurementParse( CSV )" );
+  }
+  oyMeasurementRelease( &m );
+
+  m = oyMeasurementParse( cxf, 0, oyMEASUREMENT_UNKNOWN );
+  if(m && m->format == oyMEASUREMENT_CXF && m->count == 1 && m->bands == 3 &&
+     m->start == 400 && m->lambda == 20 && m->values[2] == 0.3 &&
+     m->names[0] && strcmp(m->names[0], "Red") == 0)
+  { PRINT_SUB( oyjlTESTRESULT_SUCCESS,
+    "oyMeasurementParse( CxF )" );
+  } else
+  { PRINT_SUB( oyjlTESTRESULT_FAIL,
+    "oyMeasurementParse( CxF )" );
+  }
+  oyMeasurementRelease( &m );
+
+  /* a second data format in one table is malformed */
+  m = oyMeasurementParse( "CGATS.17\n"
+                          "BEGIN_DATA_FORMAT\nSAMPLE_ID LAB_L\nEND_DATA_FORMAT\n"
+                          "BEGIN_DATA_FORMAT\nSAMPLE_ID LAB_L LAB_A LAB_B\nEND_DATA_FORMAT\n"
+                          "BEGIN_DATA\n1 50 0 0\nEND_DATA\n", 0, oyMEASUREMENT_UNKNOWN );
+  if(!m)
+  { PRINT_SUB( oyjlTESTRESULT_SUCCESS,
+    "oyMeasurementParse( repeated BEGIN_DATA_FORMAT )" );
+  } else
+  { PRINT_SUB( oyjlTESTRESULT_FAIL,
+    "oyMeasurementParse( repeated BEGIN_DATA_FORMAT )" );
+  }
+  oyMeasurementRelease( &m );
+
+  /* the text after size continues the last number or white space */
+  {
+    char buf[512];
+    int ok = 1;
+
+    snprintf( buf, sizeof(buf), "%s%s", "nm,p1,p2\n380,0.1,0.2\n390,0.3, ", "7\n" );
+    m = oyMeasurementParse( buf, strlen(buf) - 2, oyMEASUREMENT_CSV );
+    if(!m || m->count != 2 || m->bands != 2 || m->values[1] != 0.3 ||
+       !isnan(m->values[3]))
+      ok = 0;
+    oyMeasurementRelease( &m );
+
+    snprintf( buf, sizeof(buf), "%s%s", "nm,p1,p2\n380,0.1,0.2\n390,0.3,0.4", "99" );
+    m = oyMeasurementParse( buf, strlen(buf) - 2, oyMEASUREMENT_CSV );
+    if(!m || m->count != 2 || m->values[3] != 0.4)
+      ok = 0;
+    oyMeasurementRelease( &m );
+
+    snprintf( buf, sizeof(buf), "%s", cgats );
+    size = strstr( buf, "1\nEND_DATA" ) + 1 - buf;
+    buf[size] = '5';
+    m = oyMeasurementParse( buf, size, oyMEASUREMENT_CGATS );
+    if(!m || m->count != 2 || m->values[4+3] != 1.0)
+      ok = 0;
+    oyMeasurementRelease( &m );
+
+    if(ok)
+    { PRINT_SUB( oyjlTESTRESULT_SUCCESS,
+      "oyMeasurementParse() stops at size" );
+    } else
+    { PRINT_SUB( oyjlTESTRESULT_FAIL,
+      "oyMeasurementParse() stops at size" );
+    }
+  }
+
+  /* large patch set */
+  oyjlStringAdd( &text, 0,0, "CGATS.17\nNUMBER_OF_SETS %d\nBEGIN_DATA_FORMAT\nSAMPLE_ID", n );
+  for(j = 0; j < bands; ++j)
+    oyjlStringAdd( &text, 0,0, " SPECTRAL_NM%d", 380 + j*10 );
+  oyjlStringAdd( &text, 0,0, "\nEND_DATA_FORMAT\nBEGIN_DATA\n" );
+  {
+    oyjl_str str = oyjlStr_New( 10 * n * bands, 0,0 );
+    oyjlStr_Push( str, text );
+    for(i = 0; i < n; ++i)
+    {
+      oyjlStr_Add( str, "%d", i + 1 );
+      for(j = 0; j < bands; ++j)
+        oyjlStr_Add( str, " %.5f", (i % 100) / 100.0 + j * 0.001 );
+      oyjlStr_Push( str, "\n" );
+    }
+    oyjlStr_Push( str, "END_DATA\n" );
+    free( text );
+    text = oyjlStr_Pull( str );
+    oyjlStr_Release( &str );
+  }
+  size = strlen( text );
+
+  clck = oyClock();
+  for(i = 0; i < repeat; ++i)
+  {
+    oyMeasurementRelease( &m );
+    m = oyMeasurementParse( text, size, oyMEASUREMENT_CGATS );
+  }
+  clck = oyClock() - clck;
+  if(m && m->count == n && m->bands == bands &&
+     fabs(m->values[5*bands + 3] - (0.05 + 0.003)) < 1e-9)
+  { PRINT_SUB_PROFILING( oyjlTESTRESULT_SUCCESS, repeat,clck/(double)CLOCKS_PER_SEC,"parse",
+    "oyMeasurementParse( %d x %d ) %d kB", n, bands, (int)(size/1024) );
+  } else
+  { PRINT_SUB( oyjlTESTRESULT_FAIL,
+    "oyMeasurementParse( %d x %d )", n, bands );
+  }
+
+  clck = oyClock();
+  root = oyMeasurementToTree( m );
+  clck = oyClock() - clck;
+  if(oyjlValueCount( oyjlTreeGetValue( root, 0, "collection/[0]/colors" ) ) == n)
+  { PRINT_SUB_PROFILING( oyjlTESTRESULT_SUCCESS, 1,clck/(double)CLOCKS_PER_SEC,"tree",
+    "oyMeasurementToTree( %d x %d )", n, bands );
+  } else
+  { PRINT_SUB( oyjlTESTRESULT_FAIL,
+    "oyMeasurementToTree( %d x %d )", n, bands );
+  }
+  oyjlTreeFree( root );
+  oyMeasurementRelease( &m );
+  free( text );
+
+  OBJECT_COUNT_PRINT( oyjlTESTRESULT_FAIL, 1, 0, NULL )
+
+  return result;
+}
+
+#include "oyranos_cache.h"
+#include <sys/wait.h>
+#include <unistd.h>
+oyjlTESTRESULT_e testSharedCache()
+{
+  oyjlTESTRESULT_e result = oyjlTESTRESULT_UNKNOWN;
+  int i, n = 100, repeat = 1000, error;
+  size_t block_size = 256*1024, size = 0;
+  char * path = NULL, * block, * data = NULL;
+  oyHash_s * entry[100];
+  pid_t pid;
+  double clck;
+  OBJECT_COUNT_SETUP
+
+  fprintf(stdout, "\n" );
+
+  oyjlStringAdd( &path, 0,0, "/tmp/oy_test_shared_cache_%d", (int)getpid() );
+  unlink( path );
+  setenv( OY_SHARED_CACHE, path, 1 );
+  oySharedCacheRelease_();
+
+  block = (char*) malloc( block_size );
+  for(i = 0; i < (int)block_size; ++i)
+    block[i] = (char)(i * 7);
+
+  for(i = 0; i < n; ++i)
+  {
+    char * text = NULL;
+    oyjlStringAdd( &text, 0,0, "shared_cache_test:profile-%d:mtime-1234567", i );
+    entry[i] = oyHash_Create( text, NULL );
+    free( text );
+  }
+
+  /* write from a other process */
+  pid = fork();
+  if(pid == 0)
+  {
+    oySharedCacheRelease_();
+    error = 0;
+    for(i = 0; i < n; ++i)
+    {
+      block[0] = (char)i;
+      error |= oySharedCacheSet_( entry[i], oySHARED_CACHE_PROFILE, block, block_size );
+    }
+    _exit( error ? 1 : 0 );
+  }
+  waitpid( pid, &error, 0 );
+
+  error = oySharedCacheGet_( entry[42], oySHARED_CACHE_PROFILE, &size, (oyPointer*)&data, malloc );
+  if(!error && size == block_size && data && data[0] == 42 &&
+     memcmp( data + 1, block + 1, block_size - 1 ) == 0)
+  { PRINT_SUB( oyjlTESTRESULT_SUCCESS,
+    "oySharedCacheGet_() from other process" );
+  } else
+  { PRINT_SUB( oyjlTESTRESULT_FAIL,
+    "oySharedCacheGet_() from other process %d %d", error, (int)size );
+  }
+  free( data ); data = NULL;
+
+  error = oySharedCacheGet_( entry[42], oySHARED_CACHE_DEVICE_LINK, &size, (oyPointer*)&data, malloc );
+  if(error == -1 && !data &&
+     oySharedCacheSet_( entry[1], oySHARED_CACHE_PROFILE, "x", 1 ) == 0)
+  { PRINT_SUB( oyjlTESTRESULT_SUCCESS,
+    "oySharedCacheGet_() type miss; keep first entry" );
+  } else
+  { PRINT_SUB( oyjlTESTRESULT_FAIL,
+    "oySharedCacheGet_() type miss; keep first entry" );
+  }
+
+  /* the parent has the cache open before fork(); both write in parallel */
+  {
+    int m = 400, ok = 0;
+    size_t small = 16*1024;
+    oyHash_s * both[400];
+    for(i = 0; i < m; ++i)
+    {
+      char * text = NULL;
+      oyjlStringAdd( &text, 0,0, "shared_cache_test:fork-%d:mtime-1234567", i );
+      both[i] = oyHash_Create( text, NULL );
+      free( text );
+    }
+    pid = fork();
+    for(i = pid == 0 ? 1 : 0; i < m; i += 2)
+    {
+      block[0] = (char)i;
+      oySharedCacheSet_( both[i], oySHARED_CACHE_PROFILE, block, small );
+    }
+    if(pid == 0)
+      _exit( 0 );
+    waitpid( pid, &error, 0 );
+
+    for(i = 0; i < m; ++i)
+    {
+      error = oySharedCacheGet_( both[i], oySHARED_CACHE_PROFILE, &size, (oyPointer*)&data, malloc );
+      if(!error && size == small && data[0] == (char)i &&
+         memcmp( data + 1, block + 1, small - 1 ) == 0)
+        ++ok;
+      free( data ); data = NULL;
+      oyHash_Release( &both[i] );
+    }
+    if(ok == m)
+    { PRINT_SUB( oyjlTESTRESULT_SUCCESS,
+      "oySharedCacheSet_() parallel after fork()" );
+    } else
+    { PRINT_SUB( oyjlTESTRESULT_FAIL,
+      "oySharedCacheSet_() parallel after fork() %d/%d", ok, m );
+    }
+  }
+
+  clck = oyClock();
+  for(i = 0; i < repeat; ++i)
+  {
+    oySharedCacheGet_( entry[i%n], oySHARED_CACHE_PROFILE, &size, (oyPointer*)&data, malloc );
+    free( data ); data = NULL;
+  }
+  clck = oyClock() - clck;
+  if(size == block_size)
+  { PRINT_SUB_PROFILING( oyjlTESTRESULT_SUCCESS, repeat,clck/(double)CLOCKS_PER_SEC,"get",
+    "oySharedCacheGet_( %d kB )", (int)(block_size/1024) );
+  } else
+  { PRINT_SUB( oyjlTESTRESULT_FAIL,
+    "oySharedCacheGet_( %d kB )", (int)(block_size/1024) );
+  }
+
+  for(i = 0; i < n; ++i)
+    oyHash_Release( &entry[i] );
+  free( block );
+  oySharedCacheRelease_();
+  unsetenv( OY_SHARED_CACHE );
+  unlink( path );
+  free( path );
+
+  OBJECT_COUNT_PRINT( oyjlTESTRESULT_FAIL, 1, 0, NULL )
+
+  return result;
+}
+
+static int testPreparedCount        ( oyFilterGraph_s   * graph )
+{
+  oyOptions_s * opts = oyFilterGraph_GetOptions( graph );
+  const char * t = oyOptions_FindString( opts, "prepared", 0 );
+  int n = 0;
+  while(t && (t = strchr( t, '\n' )) != NULL)
+  { ++n; ++t; }
+  oyOptions_Release( &opts );
+  return n;
+}
+
+oyjlTESTRESULT_e testIncrementalPrepare()
+{
+  oyjlTESTRESULT_e result = oyjlTESTRESULT_UNKNOWN;
+  int i, n = 100, prepared;
+  uint16_t buf_in[12] = { 20000,20000,20000, 10000,10000,10000,
+                          0,0,0,             65535,65535,65535 };
+  uint16_t buf_out[12];
+  double clck;
+  OBJECT_COUNT_SETUP
+
+  fprintf(stdout, "\n" );
+
+  oyProfile_s * p_web = oyProfile_FromStd( oyASSUMED_WEB, 0, testobj ),
+              * p_lab = oyProfile_FromStd( oyEDITING_LAB, 0, testobj );
+  oyConversion_s * cc = oyConversion_CreateBasicPixelsFromBuffers(
+                              p_web, buf_in, oyDataType_m(oyUINT16),
+                              p_lab, buf_out, oyDataType_m(oyUINT16),
+                                                    NULL, 4 );
+  oyFilterGraph_s * graph = oyConversion_GetGraph( cc );
+  oyFilterNode_s * icc = oyFilterGraph_GetNode( graph, -1, "///icc_color", 0 );
+  oyOptions_s * node_opts = oyFilterNode_GetOptions( icc, 0 );
+
+  oyFilterGraph_PrepareContexts( graph, 0 );
+  prepared = testPreparedCount( graph );
+  oyFilterGraph_PrepareContexts( graph, 0 );
+  if(prepared == 1 && testPreparedCount( graph ) == 0)
+  { PRINT_SUB( oyjlTESTRESULT_SUCCESS,
+    "oyFilterGraph_PrepareContexts() keeps valid contexts" );
+  } else
+  { PRINT_SUB( oyjlTESTRESULT_FAIL,
+    "oyFilterGraph_PrepareContexts() keeps valid contexts %d", prepared );
+  }
+
+  oyOptions_SetFromString( &node_opts, "////rendering_intent", "1", OY_CREATE_NEW );
+  oyFilterGraph_PrepareContexts( graph, 0 );
+  prepared = testPreparedCount( graph );
+  oyOptions_SetFromString( &node_opts, "////rendering_intent", "1", OY_CREATE_NEW );
+  oyFilterGraph_PrepareContexts( graph, 0 );
+  if(prepared == 1 && testPreparedCount( graph ) == 0)
+  { PRINT_SUB( oyjlTESTRESULT_SUCCESS,
+    "oyFilterGraph_PrepareContexts() only changed hashes" );
+  } else
+  { PRINT_SUB( oyjlTESTRESULT_FAIL,
+    "oyFilterGraph_PrepareContexts() only changed hashes %d", prepared );
+  }
+
+  /* toggle between two cached contexts; each prepare replaces the node
+   * context, which must not leak the old one (see OBJECT_COUNT_PRINT) */
+  prepared = 0;
+  for(i = 0; i < 10; ++i)
+  {
+    oyOptions_SetFromString( &node_opts, "////rendering_intent", i%2 ? "1" : "0", OY_CREATE_NEW );
+    oyFilterGraph_PrepareContexts( graph, 0 );
+    prepared += testPreparedCount( graph );
+  }
+  if(prepared == 10)
+  { PRINT_SUB( oyjlTESTRESULT_SUCCESS,
+    "oyFilterGraph_PrepareContexts() change context and back" );
+  } else
+  { PRINT_SUB( oyjlTESTRESULT_FAIL,
+    "oyFilterGraph_PrepareContexts() change context and back %d", prepared );
+  }
+
+  if(oyConversion_RunPixels( cc, NULL ) == 0)
+  { PRINT_SUB( oyjlTESTRESULT_SUCCESS,
+    "oyConversion_RunPixels() after option change" );
+  } else
+  { PRINT_SUB( oyjlTESTRESULT_FAIL,
+    "oyConversion_RunPixels() after option change" );
+  }
+
+  clck = oyClock();
+  for(i = 0; i < n; ++i)
+    oyFilterGraph_PrepareContexts( graph, 0 );
+  clck = oyClock() - clck;
+  PRINT_SUB_PROFILING( testPreparedCount( graph ) == 0 ? oyjlTESTRESULT_SUCCESS : oyjlTESTRESULT_FAIL,
+    n,clck/(double)CLOCKS_PER_SEC,"check",
+    "oyFilterGraph_PrepareContexts( unchanged )" );
+
+  clck = oyClock();
+  for(i = 0; i < n; ++i)
+    oyFilterGraph_PrepareContexts( graph, 1 );
+  clck = oyClock() - clck;
+  PRINT_SUB_PROFILING( testPreparedCount( graph ) == 1 ? oyjlTESTRESULT_SUCCESS : oyjlTESTRESULT_FAIL,
+    n,clck/(double)CLOCKS_PER_SEC,"prep",
+    "oyFilterGraph_PrepareContexts( enforce )" );
+
+  oyOptions_Release( &node_opts );
+  oyFilterNode_Release( &icc );
+  oyFilterGraph_Release( &graph );
+  oyConversion_Release( &cc );
+  oyProfile_Release( &p_web );
+  oyProfile_Release( &p_lab );
+
+  OBJECT_COUNT_PRINT( oyjlTESTRESULT_FAIL, 1, 0, NULL )
+
+  return result;
+}
+
+oyjlTESTRESULT_e testNodeStats()
+{
+  oyjlTESTRESULT_e result = oyjlTESTRESULT_UNKNOWN;
+  int i, n = 100, count, runs = 0, contexts = 0, old_stats = oy_stats;
+  long long pixels = 0;
+  uint16_t buf_in[12] = { 20000,20000,20000, 10000,10000,10000,
+                          0,0,0,             65535,65535,65535 };
+  uint16_t buf_out[12];
+  char * json;
+  oyjl_val root;
+  double clck;
+  OBJECT_COUNT_SETUP
+
+  fprintf(stdout, "\n" );
+
+  oyProfile_s * p_web = oyProfile_FromStd( oyASSUMED_WEB, 0, testobj ),
+              * p_lab = oyProfile_FromStd( oyEDITING_LAB, 0, testobj );
+  oyConversion_s * cc = oyConversion_CreateBasicPixelsFromBuffers(
+                              p_web, buf_in, oyDataType_m(oyUINT16),
+                              p_lab, buf_out, oyDataType_m(oyUINT16),
+                                                    NULL, 4 );
+
+  oy_stats = 0;
+  json = oyConversion_GetStats( cc, 0, oyAllocateFunc_ );
+  root = oyjlTreeParse2( json, 0, __func__, NULL );
+  if(json && root && OYJL_GET_INTEGER( oyjlTreeGetValue( root, 0, "enabled" ) ) == 0 &&
+     OYJL_GET_INTEGER( oyjlTreeGetValue( root, 0, "nodes/[0]/runs" ) ) == 0)
+  { PRINT_SUB( oyjlTESTRESULT_SUCCESS,
+    "oyConversion_GetStats() disabled" );
+  } else
+  { PRINT_SUB( oyjlTESTRESULT_FAIL,
+    "oyConversion_GetStats() disabled" );
+  }
+  oyjlTreeFree( root );
+  oyFree_m_( json );
+
+  clck = oyClock();
+  for(i = 0; i < n; ++i)
+    oyConversion_RunPixels( cc, NULL );
+  clck = oyClock() - clck;
+  PRINT_SUB_PROFILING( oyjlTESTRESULT_SUCCESS, n,clck/(double)CLOCKS_PER_SEC,"run",
+    "oyConversion_RunPixels() without stats" );
+
+  oy_stats = 1;
+  clck = oyClock();
+  for(i = 0; i < n; ++i)
+    oyConversion_RunPixels( cc, NULL );
+  clck = oyClock() - clck;
+  PRINT_SUB_PROFILING( oyjlTESTRESULT_SUCCESS, n,clck/(double)CLOCKS_PER_SEC,"run",
+    "oyConversion_RunPixels() with stats" );
+
+  json = oyConversion_GetStats( cc, 0x01, oyAllocateFunc_ );
+  root = oyjlTreeParse2( json, 0, __func__, NULL );
+  count = oyjlValueCount( oyjlTreeGetValue( root, 0, "nodes" ) );
+  for(i = 0; i < count; ++i)
+  {
+    const char * reg = OYJL_GET_STRING( oyjlTreeGetValueF( root, 0, "nodes/[%d]/registration", i ) );
+    if(reg && strstr( reg, "icc_color" ))
+    {
+      runs = OYJL_GET_INTEGER( oyjlTreeGetValueF( root, 0, "nodes/[%d]/runs", i ) );
+      pixels = OYJL_GET_INTEGER( oyjlTreeGetValueF( root, 0, "nodes/[%d]/pixels", i ) );
+      contexts = OYJL_GET_INTEGER( oyjlTreeGetValueF( root, 0, "nodes/[%d]/contexts", i ) );
+    }
+  }
+  if(verbose && json)
+    fprintf( zout, "%s\n", json );
+  if(count >= 2 && runs == n && pixels == 4*n)
+  { PRINT_SUB( oyjlTESTRESULT_SUCCESS,
+    "oyConversion_GetStats() runs: %d pixels: %lld contexts: %d", runs, pixels, contexts );
+  } else
+  { PRINT_SUB( oyjlTESTRESULT_FAIL,
+    "oyConversion_GetStats() runs: %d pixels: %lld contexts: %d", runs, pixels, contexts );
+  }
+  oyjlTreeFree( root );
+  oyFree_m_( json );
+
+  json = oyConversion_GetStats( cc, 0, oyAllocateFunc_ );
+  root = oyjlTreeParse2( json, 0, __func__, NULL );
+  if(root && OYJL_GET_INTEGER( oyjlTreeGetValue( root, 0, "nodes/[0]/runs" ) ) == 0)
+  { PRINT_SUB( oyjlTESTRESULT_SUCCESS,
+    "oyConversion_GetStats() reset" );
+  } else
+  { PRINT_SUB( oyjlTESTRESULT_FAIL,
+    "oyConversion_GetStats() reset" );
+  }
+  oyjlTreeFree( root );
+  oyFree_m_( json );
+  oy_stats = old_stats;
+
+  oyConversion_Release( &cc );
+  oyProfile_Release( &p_web );
+  oyProfile_Release( &p_lab );
+
+  OBJECT_COUNT_PRINT( oyjlTESTRESULT_FAIL, 1, 0, NULL )
+
+  return result;
+}
+
+static int testTileEqual             ( oyDisplayTiles_s  * tiles,
+                                       int                 column,
+                                       int                 row,
+                                       uint16_t          * ref,
+                                       int                 width,
+                                       int                 height )
+{
+  oyArray2d_s * a = oyDisplayTiles_Get( tiles, column, row );
+  uint16_t ** rows;
+  int x0 = column * 64, y0 = row * 64,
+      w = OY_MIN( 64, width - x0 ), h = OY_MIN( 64, height - y0 ), x, y;
+
+  if(!a)
+    return 0;
+
+  rows = (uint16_t**) oyArray2d_GetData( a );
+  for(y = 0; y < h; ++y)
+    for(x = 0; x < w * 3; ++x)
+      if(rows[y][x] != ref[((y0 + y) * width + x0) * 3 + x])
+      {
+        oyArray2d_Release( &a );
+        return 0;
+      }
+
+  oyArray2d_Release( &a );
+  return 1;
+}
+
+oyjlTESTRESULT_e testDisplayTiles()
+{
+  oyjlTESTRESULT_e result = oyjlTESTRESULT_UNKNOWN;
+  int width = 300, height = 200, i, missing, pending,
+      rendered = 0, cancelled = 0, hits = 0, n = 20;
+  uint16_t * buf_in = (uint16_t*) calloc( width * height * 3, sizeof(uint16_t) ),
+           * buf_ref = (uint16_t*) calloc( width * height * 3, sizeof(uint16_t) );
+  double clck;
+  OBJECT_COUNT_SETUP
+
+  fprintf(stdout, "\n" );
+
+  for(i = 0; i < width * height * 3; ++i)
+    buf_in[i] = (i * 257) % 65536;
+
+  oyProfile_s * p_web = oyProfile_FromStd( oyASSUMED_WEB, 0, testobj ),
+              * p_lab = oyProfile_FromStd( oyEDITING_LAB, 0, testobj );
+  oyImage_s * input = oyImage_Create( width, height, buf_in, OY_TYPE_123_16,
+                                      p_web, testobj ),
+            * output = oyImage_Create( width, height, buf_ref, OY_TYPE_123_16,
+                                       p_lab, testobj );
+  oyConversion_s * cc = oyConversion_CreateBasicPixels( input, output, NULL,
+                                                        testobj );
+  /* reference from a synchronous full image run */
+  oyConversion_RunPixels( cc, NULL );
+
+  oyRectangle_s * view = oyRectangle_NewWith( 0,0, 128,128, testobj );
+  oyDisplayTiles_s * tiles = oyDisplayTiles_New( cc, 64, 32 );
+
+  clck = oyClock();
+  missing = oyDisplayTiles_Request( tiles, view, 1.0, 0.0,
+                                    OY_DISPLAY_TILES_SYNC );
+  clck = oyClock() - clck;
+  if(tiles && missing == 0 &&
+     testTileEqual( tiles, 0, 0, buf_ref, width, height ) &&
+     testTileEqual( tiles, 1, 1, buf_ref, width, height ))
+  { PRINT_SUB_PROFILING( oyjlTESTRESULT_SUCCESS, 4,clck/(double)CLOCKS_PER_SEC,"tile",
+    "oyDisplayTiles_Request() visible" );
+  } else
+  { PRINT_SUB( oyjlTESTRESULT_FAIL,
+    "oyDisplayTiles_Request() visible %d", missing );
+  }
+
+  clck = oyClock();
+  pending = oyDisplayTiles_Wait( tiles, 10.0 );
+  clck = oyClock() - clck;
+  if(pending == 0 &&
+     testTileEqual( tiles, 2, 0, buf_ref, width, height ) &&
+     testTileEqual( tiles, 3, 1, buf_ref, width, height ))
+  { PRINT_SUB_PROFILING( oyjlTESTRESULT_SUCCESS, 4,clck/(double)CLOCKS_PER_SEC,"tile",
+    "oyDisplayTiles_Wait() prefetch" );
+  } else
+  { PRINT_SUB( oyjlTESTRESULT_FAIL,
+    "oyDisplayTiles_Wait() prefetch %d", pending );
+  }
+
+  /* the right bottom border tiles are only partially covered */
+  oyRectangle_SetGeo( view, width - 128, height - 128, 128, 128 );
+  oyDisplayTiles_Request( tiles, view, 0.0, 1.0, 0 );
+  pending = oyDisplayTiles_Wait( tiles, 10.0 );
+  if(pending == 0 &&
+     testTileEqual( tiles, 4, 3, buf_ref, width, height ) &&
+     testTileEqual( tiles, 2, 1, buf_ref, width, height ))
+  { PRINT_SUB( oyjlTESTRESULT_SUCCESS,
+    "oyDisplayTiles_Request() border tiles" );
+  } else
+  { PRINT_SUB( oyjlTESTRESULT_FAIL,
+    "oyDisplayTiles_Request() border tiles %d", pending );
+  }
+
+  /* fast panning makes most queued tickets stale */
+  oyDisplayTiles_GetCounts( tiles, &rendered, &cancelled, &hits );
+  clck = oyClock();
+  for(i = 0; i < n; ++i)
+  {
+    oyRectangle_SetGeo( view, (i * 37) % (width - 64), (i * 23) % (height - 64),
+                        64, 64 );
+    oyDisplayTiles_Cancel( tiles );
+    oyDisplayTiles_Request( tiles, view, 1.0, 1.0, 0 );
+  }
+  pending = oyDisplayTiles_Wait( tiles, 10.0 );
+  clck = oyClock() - clck;
+  missing = oyDisplayTiles_Request( tiles, view, 0.0, 0.0, 0 );
+  {
+    int r = rendered, c = cancelled, h = hits;
+    oyDisplayTiles_GetCounts( tiles, &rendered, &cancelled, &hits );
+    rendered -= r; cancelled -= c; hits -= h;
+  }
+  if(pending == 0 && missing == 0)
+  { PRINT_SUB_PROFILING( oyjlTESTRESULT_SUCCESS, n,clck/(double)CLOCKS_PER_SEC,"pan",
+    "oyDisplayTiles_Cancel() rendered: %d cancelled: %d hits: %d",
+    rendered, cancelled, hits );
+  } else
+  { PRINT_SUB( oyjlTESTRESULT_FAIL,
+    "oyDisplayTiles_Cancel() rendered: %d cancelled: %d hits: %d pending: %d missing: %d",
+    rendered, cancelled, hits, pending, missing );
+  }
+
+  /* a view crossing tile borders into a frame buffer */
+  oyRectangle_SetGeo( view, 50, 30, 100, 80 );
+  oyDisplayTiles_Request( tiles, view, 0.0, 0.0, OY_DISPLAY_TILES_SYNC );
+  {
+    uint16_t * frame = (uint16_t*) calloc( 100 * 80 * 3, sizeof(uint16_t) );
+    int x, y, diff = 0;
+    missing = oyDisplayTiles_Blit( tiles, view, frame,
+                                   100 * 3 * sizeof(uint16_t) );
+    for(y = 0; y < 80; ++y)
+      for(x = 0; x < 100 * 3; ++x)
+        if(frame[y * 100 * 3 + x] != buf_ref[((30 + y) * width + 50) * 3 + x])
+          ++diff;
+    free( frame );
+    if(missing == 0 && diff == 0)
+    { PRINT_SUB( oyjlTESTRESULT_SUCCESS,
+      "oyDisplayTiles_Blit()" );
+    } else
+    { PRINT_SUB( oyjlTESTRESULT_FAIL,
+      "oyDisplayTiles_Blit() missing: %d diff: %d", missing, diff );
+    }
+  }
+
+  /* changed source pixels drop the cached tiles */
+  oyDisplayTiles_Invalidate( tiles );
+  {
+    oyArray2d_s * a = oyDisplayTiles_Get( tiles, 1, 1 );
+    int dropped = a == NULL;
+    oyArray2d_Release( &a );
+    missing = oyDisplayTiles_Request( tiles, view, 0.0, 0.0,
+                                      OY_DISPLAY_TILES_SYNC );
+    if(dropped && missing == 0 &&
+       testTileEqual( tiles, 1, 1, buf_ref, width, height ))
+    { PRINT_SUB( oyjlTESTRESULT_SUCCESS,
+      "oyDisplayTiles_Invalidate()" );
+    } else
+    { PRINT_SUB( oyjlTESTRESULT_FAIL,
+      "oyDisplayTiles_Invalidate() dropped: %d missing: %d", dropped, missing );
+    }
+  }
+
+  oyDisplayTiles_Release( &tiles );
+  oyRectangle_Release( &view );
+  oyConversion_Release( &cc );
+  oyImage_Release( &input );
+  oyImage_Release( &output );
+  oyProfile_Release( &p_web );
+  oyProfile_Release( &p_lab );
+  free( buf_in );
+  free( buf_ref );
+
+  OBJECT_COUNT_PRINT( oyjlTESTRESULT_FAIL, 1, 0, NULL )
+
+  return result;
+}
+
+oyjlTESTRESULT_e testDBSnapshot()
+{
+  oyjlTESTRESULT_e result = oyjlTESTRESULT_UNKNOWN;
+  OBJECT_COUNT_SETUP
+
+  fprintf(stdout, "\n" );
+
+  const char * key_domain = TEST_DOMAIN,
+             * key_name = TEST_DOMAIN "/snapshot_key";
+  int i, n = 100, error;
+  char * value = NULL;
+  double clck;
+
+  error = oyDBSetString( key_name, oySCOPE_USER, "first", "test snapshot" );
+  if(error) PRINT_SUB( oyjlTESTRESULT_XFAIL, "oyDBSetString() error: %d", error )
+
+  /* a handle held over a write keeps its parsed state */
+  oyDB_s * held = oyDB_newFrom( key_domain, oySCOPE_USER_SYS, oyAllocateFunc_, oyDeAllocateFunc_ );
+
+  clck = oyClock();
+  for(i = 0; i < n; ++i)
+  {
+    oyDB_s * db = oyDB_newFrom( key_domain, oySCOPE_USER_SYS, oyAllocateFunc_, oyDeAllocateFunc_ );
+    value = oyDB_getString( db, key_name );
+    oyDB_release( &db );
+    if(!value || strcmp(value, "first") != 0)
+      break;
+    oyFree_m_( value );
+  }
+  clck = oyClock() - clck;
+  if( i == n )
+  { PRINT_SUB_PROFILING( oyjlTESTRESULT_SUCCESS, i,clck/(double)CLOCKS_PER_SEC,"lookup",
+    "oyDB_newFrom()+oyDB_getString()" );
+  } else
+  { PRINT_SUB( oyjlTESTRESULT_FAIL,
+    "oyDB_newFrom()+oyDB_getString() %s", oyNoEmptyString_m_(value) );
+  }
+  oyFree_m_( value );
+
+  error = oyDBSetString( key_name, oySCOPE_USER, "second", "test snapshot" );
+  oyDB_s * db = oyDB_newFrom( key_domain, oySCOPE_USER_SYS, oyAllocateFunc_, oyDeAllocateFunc_ );
+  value = oyDB_getString( db, key_name );
+  oyDB_release( &db );
+  if( !error && value && strcmp(value, "second") == 0 )
+  { PRINT_SUB( oyjlTESTRESULT_SUCCESS,
+    "new handle sees written value      %s", value );
+  } else
+  { PRINT_SUB( oyjlTESTRESULT_FAIL,
+    "new handle sees written value      %s", oyNoEmptyString_m_(value) );
+  }
+  oyFree_m_( value );
+
+  value = oyDB_getString( held, key_name );
+  oyDB_release( &held );
+  if( value && strcmp(value, "first") == 0 )
+  { PRINT_SUB( oyjlTESTRESULT_SUCCESS,
+    "held handle keeps old snapshot     %s", value );
+  } else
+  { PRINT_SUB( oyjlTESTRESULT_FAIL,
+    "held handle keeps old snapshot     %s", oyNoEmptyString_m_(value) );
+  }
+  oyFree_m_( value );
+
+  oyDBEraseKey( key_name, oySCOPE_USER );
+
+  /* repeated device profile lookups go through oyConfigs_FromDB() */
+  int count = -1;
+  clck = oyClock();
+  for(i = 0; i < n; ++i)
+  {
+    oyConfigs_s * configs = NULL;
+    error = oyConfigs_FromDB( OY_DEVICE_STD "/monitor", NULL, &configs, testobj );
+    if(i == 0)
+      count = oyConfigs_Count( configs );
+    else if(count != oyConfigs_Count( configs ))
+      error = 1;
+    oyConfigs_Release( &configs );
+    if(error) break;
+  }
+  clck = oyClock() - clck;
+  if( i == n )
+  { PRINT_SUB_PROFILING( oyjlTESTRESULT_SUCCESS, i,clck/(double)CLOCKS_PER_SEC,"lookup",
+    "oyConfigs_FromDB( monitor ) %d", count );
+  } else
+  { PRINT_SUB( oyjlTESTRESULT_XFAIL,
+    "oyConfigs_FromDB( monitor ) error: %d", error );
+  }
+
+  OBJECT_COUNT_PRINT( oyjlTESTRESULT_FAIL, 1, 0, NULL )
+
+  return result;
+}
+
+#include "oyranos_cache.h" /* oy_profile_list_cache_ */
+static char *      profilesOrder     ( oyProfiles_s      * profs )
+{
+  char * text = NULL;
+  int i, n = oyProfiles_Count( profs );
+  for(i = 0; i < n; ++i)
+  {
+    oyProfile_s * p = oyProfiles_Get( profs, i );
+    oyStringAddPrintf( &text, 0,0, "%s %s\n", oyNoEmptyString_m_(oyProfile_GetFileName( p, -1 )),
+                       oyNoEmptyString_m_(oyProfile_GetID( p )) );
+    oyProfile_Release( &p );
+  }
+  return text;
+}
+oyjlTESTRESULT_e testProfilesScan()
+{
+  oyjlTESTRESULT_e result = oyjlTESTRESULT_UNKNOWN;
+  OBJECT_COUNT_SETUP
+
+  fprintf(stdout, "\n" );
+
+  uint32_t icc_profile_flags = oyICCProfileSelectionFlagsFromOptions( OY_CMM_STD, "//" OY_TYPE_STD "/icc_color", NULL, 0 );
+  char * jobs = getenv("OY_PROFILES_SCAN_JOBS") ? strdup(getenv("OY_PROFILES_SCAN_JOBS")) : NULL;
+  char * serial_order, * parallel_order;
+  oyProfiles_s * profs;
+  double clck;
+  int count;
+
+  /* rebuild the installed profiles list in the calling thread only */
+  setenv( "OY_PROFILES_SCAN_JOBS", "0", 1 );
+  oyProfiles_Release( &oy_profile_list_cache_ );
+  clck = oyClock();
+  profs = oyProfiles_Create( NULL, icc_profile_flags, NULL );
+  clck = oyClock() - clck;
+  count = oyProfiles_Count( profs );
+  serial_order = profilesOrder( profs );
+  oyProfiles_Release( &profs );
+  if(count)
+  { PRINT_SUB_PROFILING( oyjlTESTRESULT_SUCCESS, count,clck/(double)CLOCKS_PER_SEC,"icc",
+    "oyProfiles_Create() serial scan   %d", count );
+  } else
+  { PRINT_SUB( oyjlTESTRESULT_XFAIL,
+    "oyProfiles_Create() serial scan   %d", count );
+  }
+
+  /* and with the oyJob_s workers; a set variable takes effect
+   * even for less than 32 files per job */
+  setenv( "OY_PROFILES_SCAN_JOBS", "4", 1 );
+  oyProfiles_Release( &oy_profile_list_cache_ );
+  clck = oyClock();
+  profs = oyProfiles_Create( NULL, icc_profile_flags, NULL );
+  clck = oyClock() - clck;
+  count = oyProfiles_Count( profs );
+  parallel_order = profilesOrder( profs );
+  oyProfiles_Release( &profs );
+  if(count)
+  { PRINT_SUB_PROFILING( oyjlTESTRESULT_SUCCESS, count,clck/(double)CLOCKS_PER_SEC,"icc",
+    "oyProfiles_Create() parallel scan %d", count );
+  } else
+  { PRINT_SUB( oyjlTESTRESULT_XFAIL,
+    "oyProfiles_Create() parallel scan %d", count );
+  }
+
+  if(serial_order && parallel_order && strcmp( serial_order, parallel_order ) == 0)
+  { PRINT_SUB( oyjlTESTRESULT_SUCCESS,
+    "same order and IDs                %d", count );
+  } else
+  { PRINT_SUB( oyjlTESTRESULT_FAIL,
+    "same order and IDs                %d", count );
+    if(verbose)
+      fprintf( zout, "serial:\n%s\nparallel:\n%s\n", oyNoEmptyString_m_(serial_order), oyNoEmptyString_m_(parallel_order) );
+  }
+  oyFree_m_( serial_order );
+  oyFree_m_( parallel_order );
+
+  /* the verified blocks from the workers equal a plain file load */
+  {
+    int i, n, diff = 0;
+    profs = oyProfiles_Create( NULL, icc_profile_flags, NULL );
+    n = oyProfiles_Count( profs );
+    for(i = 0; i < n; ++i)
+    {
+      oyProfile_s * p = oyProfiles_Get( profs, i ), * ref;
+      const char * fn = oyProfile_GetFileName( p, -1 );
+      size_t size = 0, ref_size = 0;
+      char * mem, * ref_mem;
+      ref = oyProfile_FromFile( fn, OY_NO_CACHE_READ | OY_NO_CACHE_WRITE |
+                                    OY_COMPUTE | icc_profile_flags, testobj );
+      mem = (char*) oyProfile_GetMem( p, &size, 0, oyAllocateFunc_ );
+      ref_mem = (char*) oyProfile_GetMem( ref, &ref_size, 0, oyAllocateFunc_ );
+      if(!oyProfile_Equal( p, ref ) || size != ref_size ||
+         !mem || !ref_mem || memcmp( mem, ref_mem, size ) != 0 ||
+         oyStrcmp_( oyProfile_GetText( p, oyNAME_DESCRIPTION ),
+                    oyProfile_GetText( ref, oyNAME_DESCRIPTION ) ) != 0)
+      {
+        ++diff;
+        if(verbose)
+          fprintf( zout, "differs: %s\n", oyNoEmptyString_m_(fn) );
+      }
+      if(mem) oyFree_m_( mem );
+      if(ref_mem) oyFree_m_( ref_mem );
+      oyProfile_Release( &ref );
+      oyProfile_Release( &p );
+    }
+    oyProfiles_Release( &profs );
+    if(n && diff == 0)
+    { PRINT_SUB( oyjlTESTRESULT_SUCCESS,
+      "same as oyProfile_FromFile()      %d", n );
+    } else
+    { PRINT_SUB( n ? oyjlTESTRESULT_FAIL : oyjlTESTRESULT_XFAIL,
+      "same as oyProfile_FromFile()      %d differ: %d", n, diff );
+    }
+  }
+
+  if(jobs)
+  {
+    setenv( "OY_PROFILES_SCAN_JOBS", jobs, 1 );
+    free( jobs );
+  } else
+    unsetenv( "OY_PROFILES_SCAN_JOBS" );
+
+  OBJECT_COUNT_PRINT( oyjlTESTRESULT_FAIL, 1, 0, NULL )
+
+  return result;
+}
+
+static char *      profilesTexts     ( oyProfiles_s      * profs,
+                                       size_t            * mem )
+{
+  char * text = NULL;
+  int i, n = oyProfiles_Count( profs );
+  if(mem) *mem = 0;
+  for(i = 0; i < n; ++i)
+  {
+    oyProfile_s * p = oyProfiles_Get( profs, i );
+    oyStringAddPrintf( &text, 0,0, "%s %s\n", oyNoEmptyString_m_(oyProfile_GetFileName( p, -1 )),
+                       oyNoEmptyString_m_(oyProfile_GetText( p, oyNAME_DESCRIPTION )) );
+    if(mem) *mem += ((oyProfile_s_*)p)->size_;
+    oyProfile_Release( &p );
+  }
+  return text;
+}
+oyjlTESTRESULT_e testProfilesProbe()
+{
+  oyjlTESTRESULT_e result = oyjlTESTRESULT_UNKNOWN;
+  OBJECT_COUNT_SETUP
+
+  fprintf(stdout, "\n" );
+
+  uint32_t icc_profile_flags = oyICCProfileSelectionFlagsFromOptions( OY_CMM_STD, "//" OY_TYPE_STD "/icc_color", NULL, 0 ) | OY_ALLOW_DUPLICATES;
+  char * full_texts, * probe_texts;
+  size_t full_mem = 0, probe_mem = 0;
+  oyProfiles_s * full, * probes;
+  double clck;
+  int count, probe_count, i, probed = 0;
+
+  oyProfiles_Release( &oy_profile_list_cache_ );
+  clck = oyClock();
+  full = oyProfiles_Create( NULL, icc_profile_flags, NULL );
+  clck = oyClock() - clck;
+  count = oyProfiles_Count( full );
+  full_texts = profilesTexts( full, &full_mem );
+  if(count)
+  { PRINT_SUB_PROFILING( oyjlTESTRESULT_SUCCESS, count,clck/(double)CLOCKS_PER_SEC,"icc",
+    "oyProfiles_Create() full  %d %lu bytes", count, (unsigned long)full_mem );
+  } else
+  { PRINT_SUB( oyjlTESTRESULT_XFAIL,
+    "oyProfiles_Create() full  %d", count );
+  }
+
+  /* probes do not use a not yet filled list cache */
+  oyProfiles_Release( &oy_profile_list_cache_ );
+  clck = oyClock();
+  probes = oyProfiles_Create( NULL, icc_profile_flags | OY_PROBE, NULL );
+  clck = oyClock() - clck;
+  probe_count = oyProfiles_Count( probes );
+  probe_texts = profilesTexts( probes, &probe_mem );
+  for(i = 0; i < probe_count; ++i)
+  {
+    oyProfile_s * p = oyProfiles_Get( probes, i );
+    if(((oyProfile_s_*)p)->probe_)
+      ++probed;
+    oyProfile_Release( &p );
+  }
+  if(probe_count && probed == probe_count && !oy_profile_list_cache_)
+  { PRINT_SUB_PROFILING( oyjlTESTRESULT_SUCCESS, probe_count,clck/(double)CLOCKS_PER_SEC,"icc",
+    "oyProfiles_Create(OY_PROBE) %d %lu bytes", probe_count, (unsigned long)probe_mem );
+  } else
+  { PRINT_SUB( count ? oyjlTESTRESULT_FAIL : oyjlTESTRESULT_XFAIL,
+    "oyProfiles_Create(OY_PROBE) %d/%d probes", probed, probe_count );
+  }
+
+  if(count == probe_count && full_texts && probe_texts && strcmp( full_texts, probe_texts ) == 0)
+  { PRINT_SUB( oyjlTESTRESULT_SUCCESS,
+    "same order and descriptions     %d", count );
+  } else
+  { PRINT_SUB( count ? oyjlTESTRESULT_FAIL : oyjlTESTRESULT_XFAIL,
+    "same order and descriptions     %d/%d", count, probe_count );
+    if(verbose)
+      fprintf( zout, "full:\n%s\nprobe:\n%s\n", oyNoEmptyString_m_(full_texts), oyNoEmptyString_m_(probe_texts) );
+  }
+
+  if(count && probe_mem < full_mem)
+  { PRINT_SUB( oyjlTESTRESULT_SUCCESS,
+    "probe memory %lu < %lu", (unsigned long)probe_mem, (unsigned long)full_mem );
+  } else
+  { PRINT_SUB( oyjlTESTRESULT_XFAIL,
+    "probe memory %lu < %lu", (unsigned long)probe_mem, (unsigned long)full_mem );
+  }
+
+  if(count && probe_count == count)
+  {
+    /* the full profile is loaded on request */
+    oyProfile_s * p = oyProfiles_Get( probes, 0 ),
+                * f = oyProfiles_Get( full, 0 );
+    size_t psize = 0, fsize = 0;
+    char * pmem = (char*) oyProfile_GetMem( p, &psize, 0, oyAllocateFunc_ ),
+         * fmem = (char*) oyProfile_GetMem( f, &fsize, 0, oyAllocateFunc_ );
+    if(pmem && psize == fsize && memcmp( pmem, fmem, psize ) == 0 &&
+       !((oyProfile_s_*)p)->probe_)
+    { PRINT_SUB( oyjlTESTRESULT_SUCCESS,
+      "oyProfile_GetMem(probe) loads   %lu", (unsigned long)psize );
     } else
-    { PRINT_SUB( oyjlTESTRESULT_XFAIL,
-      "relative colorimetric intent, integer equal float %3.5f[%g] %%", max*100.0, delta*100.0 );
-      show_details = 1;
+    { PRINT_SUB( oyjlTESTRESULT_FAIL,
+      "oyProfile_GetMem(probe) loads   %lu/%lu", (unsigned long)psize, (unsigned long)fsize );
     }
+    oyFree_m_( pmem );
+    oyFree_m_( fmem );
+    oyProfile_Release( &p );
+    oyProfile_Release( &f );
+  }
 
-    if(show_details)
-    {
-      fprintf( zout, "buf_f32in  %g %g %g   %g %g %g\n           %g %g %g   %g %g %g\n",
-               buf_f32in2x2[0], buf_f32in2x2[1], buf_f32in2x2[2],
-               buf_f32in2x2[3], buf_f32in2x2[4], buf_f32in2x2[5],
-               buf_f32in2x2[6], buf_f32in2x2[7], buf_f32in2x2[8],
-               buf_f32in2x2[9], buf_f32in2x2[10], buf_f32in2x2[11]);
-      fprintf( zout, "buf_f32out %g %g %g   %g %g %g\n           %g %g %g   %g %g %g\n",
-               buf_f32out2x2[0], buf_f32out2x2[1], buf_f32out2x2[2],
-               buf_f32out2x2[3], buf_f32out2x2[4], buf_f32out2x2[5],
-               buf_f32out2x2[6], buf_f32out2x2[7], buf_f32out2x2[8],
-               buf_f32out2x2[9], buf_f32out2x2[10], buf_f32out2x2[11]);
+  oyFree_m_( full_texts );
+  oyFree_m_( probe_texts );
+  oyProfiles_Release( &full );
+  oyProfiles_Release( &probes );
 
-      oyBlob_s * b = getDL( cc, reg_nick, i );
-      oyBlob_Release( &b );
+  OBJECT_COUNT_PRINT( oyjlTESTRESULT_FAIL, 1, 0, NULL )
 
-      fprintf( zout, "options where: %s\n", oyOptions_GetText( options, oyNAME_NICK ) );
-    } show_details = verbose;
+  return result;
+}
 
-    buf_f32in2x2[0] = 0.0;
-    buf_f32in2x2[1] = 0.0;
-    buf_f32in2x2[2] = 1.0;
-    error = oyConversion_RunPixels( cc, NULL );
-    if(error) PRINT_SUB( oyjlTESTRESULT_XFAIL, "oyConversion_RunPixels() error: %d", error )
-    float blue[3] = { buf_f32out2x2[0], buf_f32out2x2[1], buf_f32out2x2[2] };
-    oyOptions_Release( &options );
-    oyConversion_Release( &cc );
+oyjlTESTRESULT_e testICCTagViews()
+{
+  oyjlTESTRESULT_e result = oyjlTESTRESULT_UNKNOWN;
+  OBJECT_COUNT_SETUP
 
+  fprintf(stdout, "\n" );
 
-    oyOptions_SetFromString( &options, OY_DEFAULT_CMM_CONTEXT, reg_pattern, OY_CREATE_NEW );
-    oyOptions_SetFromString( &options, OY_DEFAULT_RENDERING_INTENT, "1", OY_CREATE_NEW );
-    oyOptions_SetFromString( &options, OY_DEFAULT_PROOF_SOFT, "1", OY_CREATE_NEW );
-    p_in = oyProfile_FromStd( oyASSUMED_WEB, icc_profile_flags, testobj );
-    cc = oyConversion_CreateBasicPixelsFromBuffers(
-                              p_in, buf_f32in2x2, oyDataType_m(buf_type_in),
-                              p_out, buf_f32out2x2, oyDataType_m(buf_type_out),
-                                                    options, 4 );
-    oyProfile_Release( &p_in );
-    error = oyOptions_SetFromString( &options,
-                                     "//" OY_TYPE_STD "/config/display_mode", "1",
-                                     OY_CREATE_NEW );
-    if(error) PRINT_SUB( oyjlTESTRESULT_XFAIL, "oyOptions_SetFromString() error: %d", error )
-    /* activate policy */
-    error = oyConversion_Correct( cc, "//" OY_TYPE_STD "/icc_color", oyOPTIONATTRIBUTE_ADVANCED, options);
-    if(error) PRINT_SUB( oyjlTESTRESULT_XFAIL, "oyConversion_Correct() error: %d", error )
-    error = oyConversion_RunPixels( cc, NULL );
-    /* Is the float conversion ~ equal to the integer math? */
-    if(!error && (blue[0] != buf_f32out2x2[0] ||
-                  blue[1] != buf_f32out2x2[1] ||
-                  blue[2] != buf_f32out2x2[2]    ))
-    { PRINT_SUB( oyjlTESTRESULT_SUCCESS,
-      "relative colorimetric intent, simulation blue  %g %g %g -> %g %g %g", blue[0], blue[1], blue[2], buf_f32out2x2[0], buf_f32out2x2[1], buf_f32out2x2[2] );
-    } else
-    { PRINT_SUB( oyjlTESTRESULT_XFAIL,
-      "relative colorimetric intent, simulation blue  %g %g", blue[0], buf_f32out2x2[0] );
-      show_details = 1;
-    }
+  uint32_t icc_profile_flags = oyICCProfileSelectionFlagsFromOptions( OY_CMM_STD, "//" OY_TYPE_STD "/icc_color", NULL, 0 );
+  oyProfile_s * p = oyProfile_FromStd( oyASSUMED_WEB, icc_profile_flags, testobj ),
+              * lab = oyProfile_FromStd( oyASSUMED_LAB, icc_profile_flags, testobj );
+  oyProfileTag_s * tag;
+  oyICCTagView_s view;
+  oyICCLutView_s lut;
+  double XYZ[3], params[7], clck;
+  int i, n = 1000, error, count = 0, type = 0;
+  size_t size = 0, bytes = 0;
+  const char * text = NULL;
+  oyPointer block = NULL;
+
+  error = oyProfile_GetTagView( p, icSigMediaWhitePointTag, &view );
+  tag = oyProfile_GetTagById( p, icSigMediaWhitePointTag );
+  oyProfileTag_GetBlock( tag, &block, &size, oyAllocateFunc_ );
+  if(!error && view.size == size && block && memcmp( view.data, block, size ) == 0 &&
+     oyICCTagViewGetXYZ( &view, 0, XYZ ) == 0 && fabs(XYZ[1] - 1.0) < 0.001)
+  { PRINT_SUB( oyjlTESTRESULT_SUCCESS,
+    "oyProfile_GetTagView(wtpt)      %.04f %.04f %.04f", XYZ[0], XYZ[1], XYZ[2] );
+  } else
+  { PRINT_SUB( oyjlTESTRESULT_FAIL,
+    "oyProfile_GetTagView(wtpt)      %d %lu/%lu", error, (unsigned long)view.size, (unsigned long)size );
+  }
+  oyFree_m_( block );
+  oyProfileTag_Release( &tag );
 
-    if(show_details)
-    {
-      fprintf( zout, "buf_f32in  %g %g %g\n",
-               buf_f32in2x2[0], buf_f32in2x2[1], buf_f32in2x2[2]);
-      fprintf( zout, "previous   %g %g %g\n",
-               blue[0], blue[1], blue[2]);
-      fprintf( zout, "simulation %g %g %g\n",
-               buf_f32out2x2[0], buf_f32out2x2[1], buf_f32out2x2[2]);
-    } show_details = verbose;
-    oyOptions_Release( &options );
-    oyConversion_Release( &cc );
+  error = oyProfile_GetTagView( p, icSigRedTRCTag, &view );
+  count = oyICCTagViewCount( &view );
+  if(!error && (count > 1 || oyICCTagViewGetParametric( &view, &type, params ) > 0))
+  { PRINT_SUB( oyjlTESTRESULT_SUCCESS,
+    "oyICCTagViewCount(rTRC)         %d", count );
+  } else
+  { PRINT_SUB( oyjlTESTRESULT_FAIL,
+    "oyICCTagViewCount(rTRC)         %d %d", error, count );
+  }
 
+  error = oyProfile_GetTagView( p, icSigProfileDescriptionTag, &view );
+  if(!error && oyICCTagViewGetString( &view, 0, NULL, &text, &bytes, NULL ) == 0 && bytes)
+  { PRINT_SUB( oyjlTESTRESULT_SUCCESS,
+    "oyICCTagViewGetString(desc)     %lu bytes", (unsigned long)bytes );
+  } else
+  { PRINT_SUB( oyjlTESTRESULT_FAIL,
+    "oyICCTagViewGetString(desc)     %d", error );
+  }
 
-    /* test multi profile transforms */
-    oyOptions_SetFromString( &options, OY_DEFAULT_CMM_CONTEXT, reg_pattern, OY_CREATE_NEW );
-    oyOptions_SetFromString( &options, OY_DEFAULT_RENDERING_INTENT, "0", OY_CREATE_NEW );
-    oyOptions_SetFromString( &options, OY_DEFAULT_PROOF_SOFT, "1", OY_CREATE_NEW );
-    oyProfile_s * p_cmyk = oyProfile_FromStd( oyEDITING_CMYK, icc_profile_flags, NULL );
-    proofing = oyProfiles_New(NULL);
-    oyProfiles_MoveIn( proofing, &p_cmyk, -1 );
-    error = oyOptions_MoveInStruct ( &options,
-                                     OY_PROFILES_SIMULATION,
-                                     (oyStruct_s**) &proofing,
-                                     OY_CREATE_NEW );
-    cc = oyConversion_CreateFromImage (
-                                input, options,
-                                p_out, oyUINT16, 0, 0 );
-    oyImage_Release( &input );
-    oyBlob_s * blob = getDL( cc, reg_nick, show_details?i:-1 );
-    if(!show_details)
-      oyWriteMemToFile_( "test-getDL-non-verbose.icc", oyBlob_GetPointer( blob ), oyBlob_GetSize( blob) );
+  error = oyProfile_GetTagView( lab, icSigAToB0Tag, &view );
+  if(!error && oyICCTagViewGetLut( &view, &lut ) == 0 && lut.clut &&
+     lut.channels_in == 3 && lut.channels_out == 3)
+  { PRINT_SUB( oyjlTESTRESULT_SUCCESS,
+    "oyICCTagViewGetLut(A2B0)        %d->%d grid %d clut %lu", lut.channels_in, lut.channels_out, lut.grid[0], (unsigned long)lut.clut_size );
+  } else
+  { PRINT_SUB( oyjlTESTRESULT_XFAIL,
+    "oyICCTagViewGetLut(A2B0)        %d", error );
+  }
 
-    oyProfile_s * dl;
-    dl = oyProfile_FromMem( oyBlob_GetSize( blob ),
-                            oyBlob_GetPointer( blob ), 0,0 );
-    const char * fn;
-    j = 0;
-    if(verbose)
-    {
-      while((fn = oyProfile_GetFileName( dl, j )) != NULL)
-        fprintf( zout, " -> \"%s\"[%d]", oyNoEmptyString_m_(fn), j++ );
-      fprintf( zout, "\n" );
-    } else
-    {
-      oyProfileTag_s * psid = oyProfile_GetTagById( dl, (icTagSignature)icSigProfileSequenceIdentifierTag );
-      int texts_n = 0;
-      char ** texts = oyProfileTag_GetText( psid, &texts_n, 0,0,0,0);
-      if(texts_n && texts[0])
-      {
-        long l = 0;
-        if(oyjlStringToLong( texts[0], &l, 0 ) <= 0)
-          j = l;
-      }
-      oyjlStringListRelease( &texts, texts_n, oyDeAllocateFunc_ );
-      if((texts_n -1) / 5 != j)
-      { PRINT_SUB( oyjlTESTRESULT_XFAIL,
-        "dl psid texts = %d (1+5*nProfiles) but announced psid profiles: %d", texts_n, j );
-      }
-      oyProfileTag_Release( &psid );
-    }
-    oyBlob_Release( &blob );
-    oyProfile_Release( &dl );
+  if(oyProfile_GetTagView( p, (icTagSignature)0x41414141, &view ) == -1)
+  { PRINT_SUB( oyjlTESTRESULT_SUCCESS,
+    "oyProfile_GetTagView(missed)    -1" );
+  } else
+  { PRINT_SUB( oyjlTESTRESULT_FAIL,
+    "oyProfile_GetTagView(missed)" );
+  }
 
-    if(!error && j == 3)
-    { PRINT_SUB( oyjlTESTRESULT_SUCCESS,
-      "device link contains 2 profiles + simulation == %d", j );
-    } else
-    { PRINT_SUB( oyjlTESTRESULT_XFAIL,
-      "device link contains 2 profiles + simulation == %d", j );
-    }
+  /* views against copying tags */
+  clck = oyClock();
+  for(i = 0; i < n; ++i)
+  {
+    oyProfile_GetTagView( p, icSigMediaWhitePointTag, &view );
+    oyICCTagViewGetXYZ( &view, 0, XYZ );
+  }
+  clck = oyClock() - clck;
+  PRINT_SUB_PROFILING( oyjlTESTRESULT_SUCCESS, n,clck/(double)CLOCKS_PER_SEC,"view",
+    "oyProfile_GetTagView(wtpt)" );
+  clck = oyClock();
+  for(i = 0; i < n; ++i)
+  {
+    char ** texts;
+    int32_t texts_n = 0;
+    tag = oyProfile_GetTagById( p, icSigMediaWhitePointTag );
+    texts = oyProfileTag_GetText( tag, &texts_n, NULL, NULL, NULL, oyAllocateFunc_ );
+    oyStringListRelease_( &texts, texts_n, oyDeAllocateFunc_ );
+    oyProfileTag_Release( &tag );
+  }
+  clck = oyClock() - clck;
+  PRINT_SUB_PROFILING( oyjlTESTRESULT_SUCCESS, n,clck/(double)CLOCKS_PER_SEC,"tag",
+    "oyProfile_GetTagById(wtpt)" );
 
-    oyOptions_s * node_opts = oyFilterNode_GetOptions( icc, oyOPTIONATTRIBUTE_ADVANCED );
-    char * ui_text = NULL;
-    char ** namespaces = NULL;
-    oyFilterNode_GetUi( icc, oyNAME_JSON, &ui_text, &namespaces, malloc );
-    const char * data = NULL;
-    int text_type = oyjlDataFormat(ui_text);
-    if(text_type != oyNAME_JSON)
-    { PRINT_SUB( oyjlTESTRESULT_XFAIL,
-      "text type of oyFilterNode_GetUi(%s) not JSON: 7|%d", reg_nick, text_type );
-    } else
-    {
-      data = oyOptions_GetText( node_opts, (oyNAME_e) oyNAME_JSON );
-      char * text = NULL;
-      text = oyJsonFromModelAndUi( data, ui_text, malloc );
-      if(oyjlDataFormat(text) == oyNAME_JSON)
-      { PRINT_SUB( oyjlTESTRESULT_SUCCESS,
-        "oyJsonFromModelAndUi()                   len=%d", (int)strlen(text) );
-      } else
-      { PRINT_SUB( oyjlTESTRESULT_FAIL,
-        "oyJsonFromModelAndUi()                  type=%d", oyjlDataFormat(text) );
-      }
-      oyFree_m_( text );
-    }
-    oyOptions_Release( &node_opts );
-    oyFree_m_( ui_text );
+  oyProfile_Release( &p );
+  oyProfile_Release( &lab );
 
-    oyOptions_Release( &options );
-    oyConversion_Release( &cc );
+  OBJECT_COUNT_PRINT( oyjlTESTRESULT_FAIL, 1, 0, NULL )
 
-    oyProfile_Release( &p_in );
-    oyProfile_Release( &p_out );
+  return result;
+}
 
+oyjlTESTRESULT_e testConfigMatch()
+{
+  oyjlTESTRESULT_e result = oyjlTESTRESULT_UNKNOWN;
+  OBJECT_COUNT_SETUP
 
-    ++i;
+  fprintf(stdout, "\n" );
 
-    oyFree_m_( reg_pattern );
-    oyFree_m_( reg_nick );
-    oyFree_m_( reg );
-    oyFilterNode_Release( &icc );
-    oyFilterGraph_Release( &cc_graph );
+  const char * reg = OY_STD "/device/test";
+  oyRankMap rank_map[] = {
+    {(char*)"manufacturer", 1, -1, 0},
+    {(char*)"model", 5, -5, 0},
+    {(char*)"serial", 10, -2, 0},
+    {(char*)"gamma", 1, 0, 0},
+    {NULL, 0, 0, 0}
+  };
+  oyConfig_s * device = oyConfig_FromRegistration( reg, testobj ),
+             * config = NULL;
+  oyConfigs_s * configs = oyConfigs_New( testobj );
+  oyOptions_s ** core = oyConfig_GetOptions( device, "backend_core" );
+  int i, n = 1000, best = 777, error = 0;
+  int32_t rank = 0, rank_best = 0, rank_other = 0;
+  double clck;
+  char num[24];
+
+  oyOptions_SetFromString( core, OY_STD "/device/test/manufacturer", "EIZO", OY_CREATE_NEW );
+  oyOptions_SetFromString( core, OY_STD "/device/test/model", "CG777", OY_CREATE_NEW );
+  oyOptions_SetFromString( core, OY_STD "/device/test/serial", "777", OY_CREATE_NEW );
+  oyOptions_SetFromString( core, OY_STD "/device/test/gamma", "2.2", OY_CREATE_NEW );
+  oyConfig_SetRankMap( device, rank_map );
+
+  for(i = 0; i < n; ++i)
+  {
+    config = oyConfig_FromRegistration( reg, testobj );
+    oyConfig_AddDBData( config, "manufacturer", "EIZO", OY_CREATE_NEW );
+    sprintf( num, "CG%d", i );
+    oyConfig_AddDBData( config, "model", num, OY_CREATE_NEW );
+    sprintf( num, "%d", i );
+    oyConfig_AddDBData( config, "serial", num, OY_CREATE_NEW );
+    /* numbers match within oyTextIccDictMatch() tolerance */
+    oyConfig_AddDBData( config, "gamma", "2.2000", OY_CREATE_NEW );
+    oyConfigs_MoveIn( configs, &config, -1 );
   }
 
-  i = 0;
-  if(list)
+  config = oyConfigs_Get( configs, best );
+  error = oyConfig_Match( device, config, '/', ',', 0, &rank_best );
+  oyConfig_Release( &config );
+  config = oyConfigs_Get( configs, 0 );
+  error = oyConfig_Match( device, config, '/', ',', 0, &rank_other );
+  oyConfig_Release( &config );
+  if( !error && rank_best == 17 && rank_other == -5 )
+  { PRINT_SUB( oyjlTESTRESULT_SUCCESS,
+    "oyConfig_Match()                %d %d", (int)rank_best, (int)rank_other );
+  } else
+  { PRINT_SUB( oyjlTESTRESULT_FAIL,
+    "oyConfig_Match()                %d %d", (int)rank_best, (int)rank_other );
+  }
+
+  clck = oyClock();
+  for(i = 0; i < n; ++i)
   {
-    while(list[i])
-      free(list[i++]);
-    free(list);
+    config = oyConfigs_Get( configs, i );
+    oyConfig_Match( device, config, '/', ',', 0, &rank );
+    oyConfig_Release( &config );
   }
+  clck = oyClock() - clck;
+  PRINT_SUB_PROFILING( oyjlTESTRESULT_SUCCESS, n, clck/(double)CLOCKS_PER_SEC, "match",
+    "oyConfig_Match()" );
 
-  OBJECT_COUNT_PRINT( oyjlTESTRESULT_XFAIL, 1, 0, NULL )
+  clck = oyClock();
+  error = oyConfig_SelectDB( device, configs, &rank );
+  clck = oyClock() - clck;
+  if( !error && rank == rank_best && oyConfig_FindString( device, "serial", "777" ) )
+  { PRINT_SUB_PROFILING( oyjlTESTRESULT_SUCCESS, n, clck/(double)CLOCKS_PER_SEC, "match",
+    "oyConfig_SelectDB()             %d", (int)rank );
+  } else
+  { PRINT_SUB( oyjlTESTRESULT_FAIL,
+    "oyConfig_SelectDB()             %d", (int)rank );
+  }
+
+  oyConfigs_Release( &configs );
+  oyConfig_Release( &device );
+
+  OBJECT_COUNT_PRINT( oyjlTESTRESULT_FAIL, 1, 0, NULL )
 
   return result;
 }
@@ -10025,6 +12483,28 @@ oyjlTESTRESULT_e testCache()
   { PRINT_SUB( oyjlTESTRESULT_FAIL,
     "oyMiscBlobGetHash_(oyHASH_MD5) = %s", t );
   }
+  oyFree_m_( t );
+  double md5_clck = clck;
+
+  memset( id, 0, sizeof(id) );
+  clck = oyClock();
+  for(int j = 0; j < repeat; ++j)
+  for(i = 0; i < count; ++i)
+    oyMiscBlobGetHash_(hash_texts[7], strlen(hash_texts[7]), 0, (unsigned char*)id);
+  clck = oyClock() - clck;
+  oyjlStringAdd( &t, oyAllocateFunc_, oyDeAllocateFunc_,
+                          "%08x%08x%08x%08x",
+                          id[0],id[1],id[2],id[3] );
+  /* host endian result; the reference is for little endian machines */
+  if( strcmp( t, "6040593cc17860b31a2bd049d6353b43" ) == 0 &&
+      id[4] == 0 && id[7] == 0 )
+  { PRINT_SUB_PROFILING( oyjlTESTRESULT_SUCCESS, repeat,clck/(double)CLOCKS_PER_SEC,"entries",
+    "oyMiscBlobGetHash_(oyHASH_FAST) = %s %.01fx", t, clck > 0 ? md5_clck/clck : 0.0 );
+  } else
+  { PRINT_SUB( oyjlTESTRESULT_XFAIL,
+    "oyMiscBlobGetHash_(oyHASH_FAST) = %s", t );
+  }
+  oyFree_m_( t );
 
   OBJECT_COUNT_PRINT( oyjlTESTRESULT_FAIL, 1, 0, NULL )
 
@@ -3,7 +3,7 @@
  *  Oyranos is an open source Color Management System 
  *
  *  @par Copyright:
- *            2012-2021 (C) Kai-Uwe Behrmann
+ *            2012-2026 (C) Kai-Uwe Behrmann
  *
  *  @brief    ICC conversion - on the command line
  *  @internal
@@ -27,11 +27,13 @@
 #include "oyranos_config.h"
 #include "oyranos_sentinel.h"
 #include "oyranos_string.h"
+#include "oyranos_threads.h"
 #include "oyranos_version.h"
 
 #include <stdlib.h>
 #include <stdio.h>
 #include <string.h>
+#include <unistd.h> /* usleep() */
 
 #include "oyjl.h"
 #include "oyjl_version.h"
@@ -120,6 +122,16 @@ static oyjlOptionChoice_s * listSimulationProfiles ( oyjlOption_s * x OYJL_UNUSE
 static oyjlOptionChoice_s * listOutputProfiles ( oyjlOption_s * x OYJL_UNUSED, int * y OYJL_UNUSED, oyjlOptions_s * z OYJL_UNUSED )
 { return listProfiles(icSigOutputClass, icSigDisplayClass, icSigColorSpaceClass); }
 
+static void printStats ( oyConversion_s * cc )
+{
+  char * json = oyConversion_GetStats( cc, 0, malloc );
+  if(json)
+  {
+    fprintf( stderr, "%s\n", json );
+    free( json );
+  }
+}
+
 static oyjlOptionChoice_s * listIccNodes ( oyjlOption_s * o OYJL_UNUSED, int * y OYJL_UNUSED, oyjlOptions_s * opts OYJL_UNUSED )
 {
   oyjlOptionChoice_s * c = NULL;
@@ -368,6 +380,374 @@ int          oyImage_WriteCUBE       ( oyImage_s         * image,
   return error;
 }
 
+/* batch mode: convert many files in one process
+ *
+ * The main thread decodes each file, links its conversion and prepares
+ * the node contexts. So only the main thread touches the CMM cache, which
+ * makes the link cheap after the first file. oyJob_s workers run the
+ * pixel conversion. The main thread encodes finished images from
+ * the oyJob_s::finish callback. Decoding the next file overlaps with the
+ * conversion of the previous ones. The count of images in flight is
+ * capped, as each keeps its input and output buffers in memory.
+ */
+typedef struct {
+  oyOptions_s    * module_options;
+  oyProfile_s    * output_profile;
+  oyProfile_s    * device_link;
+  uint32_t         flags;
+  uint32_t         icc_profile_flags;
+  const char     * output_dir;
+  int              verbose;
+  int              in_flight;          /* main thread only */
+  int              done;
+  int              converted;
+  int              failed;
+  double           decode;             /* accumulated micro seconds */
+  double           link;
+  double           convert;
+  double           encode;
+} oyBatch_s;
+
+/* oyJob_s::context; oyJob_Release() frees it with release() */
+typedef struct {
+  oyOBJECT_e           type_;
+  oyStruct_Copy_f      copy;
+  oyStruct_Release_f   release;
+  oyObject_s           oy_;
+  oyBatch_s          * batch;
+  char               * input;
+  char               * output;
+  oyConversion_s     * cc;
+  double               convert;        /* written by the worker */
+  int                  error;
+} oyBatchItem_s;
+
+static int oyBatchItem_Release_      ( oyStruct_s       ** item )
+{
+  if(item && *item)
+  {
+    oyBatchItem_s * s = (oyBatchItem_s*) *item;
+    oyConversion_Release( &s->cc );
+    if(s->input) free( s->input );
+    if(s->output) oyDeAllocateFunc_( s->output );
+    free( s );
+    *item = NULL;
+  }
+  return 0;
+}
+
+/* oyJob_s::work; runs in a worker thread */
+static int oyBatchItem_Work_         ( oyJob_s           * job )
+{
+  oyBatchItem_s * item = (oyBatchItem_s*) job->context;
+  double clck = oyClock();
+
+  item->error = oyConversion_RunPixels( item->cc, 0 );
+  item->convert = oyClock() - clck;
+
+  return item->error;
+}
+
+/* oyJob_s::finish; runs in the main thread */
+static int oyBatchItem_Finish_       ( oyJob_s           * job )
+{
+  oyBatchItem_s * item = (oyBatchItem_s*) job->context;
+  oyBatch_s * batch = item->batch;
+  oyImage_s * image = NULL;
+  oyOptions_s * opts = NULL;
+  char * comment = NULL;
+  double clck = oyClock();
+  int error = item->error > 0;
+
+  batch->convert += item->convert;
+
+  if(!error)
+  {
+    image = oyConversion_GetImage( item->cc, OY_OUTPUT );
+    /* drop the input buffer before encoding */
+    oyConversion_Release( &item->cc );
+
+    oyStringAddPrintf_( &comment, oyAllocateFunc_, oyDeAllocateFunc_,
+                        "source image was %s", item->input );
+    oyOptions_SetFromString( &opts, "//" OY_TYPE_STD "/file_write/comment",
+                             comment, OY_CREATE_NEW );
+    error = oyImage_ToFile( image, item->output, opts ) > 0;
+    oyOptions_Release( &opts );
+    oyImage_Release( &image );
+    oyFree_m_( comment );
+  }
+
+  if(error)
+  {
+    WARNc2_S( "%s: %s", _("Could not convert"), item->input );
+    ++batch->failed;
+  }
+  else
+  {
+    ++batch->converted;
+    if(batch->verbose)
+      fprintf( stderr, "%s -> %s\n", item->input, item->output );
+  }
+
+  batch->encode += oyClock() - clck;
+  ++batch->done;
+  --batch->in_flight;
+
+  return error;
+}
+
+static int isImageFileName           ( const char        * file_name )
+{
+  const char * ext = strrchr( file_name, '.' ),
+             * exts[] = {"png","ppm","pnm","pgm","pfm","jpg","jpeg","tif","tiff",NULL};
+  int i;
+
+  if(!ext || strchr( ext, '/' ))
+    return 0;
+
+  for(i = 0; exts[i]; ++i)
+    if(oyStringCaseCmp_( ext + 1, exts[i] ) == 0)
+      return 1;
+
+  return 0;
+}
+
+/* collect image files from a directory or from a file with one name per line */
+static char ** listBatch             ( const char        * batch,
+                                       int               * count )
+{
+  char ** list = NULL, ** names = NULL;
+  int n = 0, i,
+      is_dir = oyIsDir_( batch );
+
+  *count = 0;
+
+  if(is_dir)
+    names = oyGetFiles_( batch, &n );
+  else
+  {
+    size_t size = 0;
+    char * text = oyReadFileToMem_( batch, &size, oyAllocateFunc_ );
+    if(text)
+    {
+      names = oyStringSplit_( text, '\n', &n, oyAllocateFunc_ );
+      oyDeAllocateFunc_( text );
+    }
+  }
+
+  for(i = 0; i < n; ++i)
+  {
+    char * name = names[i];
+    int len = strlen( name );
+
+    if(len && name[len-1] == '\r')
+      name[--len] = 0;
+    if(!len || name[0] == '#')
+      continue;
+    if(!isImageFileName( name ))
+    {
+      if(!is_dir)
+        WARNc2_S( "%s: %s", _("Skip unknown image file format"), name );
+      continue;
+    }
+    oyStringListAddStaticString( &list, count, name, oyAllocateFunc_, oyDeAllocateFunc_ );
+  }
+  oyStringListRelease_( &names, n, oyDeAllocateFunc_ );
+
+  return list;
+}
+
+/* keep the input base name; only PNG and PPM can be written */
+static char * batchOutputName        ( const char        * output_dir,
+                                       const char        * input )
+{
+  const char * base = strrchr( input, '/' );
+  const char * ext;
+  char * name = NULL;
+
+  base = base ? base + 1 : input;
+  ext = strrchr( base, '.' );
+  oyStringAddPrintf_( &name, oyAllocateFunc_, oyDeAllocateFunc_,
+                      "%s/%s", output_dir, base );
+  if(ext && oyStringCaseCmp_( ext, ".png" ) != 0 && oyStringCaseCmp_( ext, ".ppm" ) != 0)
+    strcpy( strrchr( name, '.' ), ".png" );
+
+  return name;
+}
+
+/* decode one file and link its conversion; NULL on failure */
+static oyBatchItem_s * batchItemNew  ( oyBatch_s         * batch,
+                                       const char        * input )
+{
+  oyBatchItem_s * item = NULL;
+  oyImage_s * image = NULL;
+  oyPixel_t pixel_layout;
+  oyConversion_s * cc = NULL;
+  double clck = oyClock();
+
+  oyImage_FromFile( input, batch->icc_profile_flags, &image, NULL );
+  batch->decode += oyClock() - clck;
+  if(!image)
+  {
+    WARNc2_S( "%s: %s", _("Could not open image"), input );
+    return NULL;
+  }
+
+  clck = oyClock();
+  if(batch->device_link)
+    oyImage_SetCritical( image, 0, batch->device_link, 0, -1,-1 );
+  pixel_layout = oyImage_GetPixelLayout( image, oyLAYOUT );
+  cc = oyConversion_CreateFromImage( image, batch->module_options,
+                                     batch->output_profile,
+                                     oyToDataType_m(pixel_layout),
+                                     batch->flags, 0 );
+  oyImage_Release( &image );
+  if(cc)
+  {
+    /* oyConversion_RunPixels() would prepare the contexts lazily inside the
+     * worker and touch the CMM cache in parallel to the next link */
+    oyFilterGraph_s * graph = oyConversion_GetGraph( cc );
+    oyFilterGraph_PrepareContexts( graph, 0 );
+    oyFilterGraph_Release( &graph );
+  }
+  batch->link += oyClock() - clck;
+  if(!cc)
+  {
+    WARNc2_S( "%s: %s", _("Could not create conversion"), input );
+    return NULL;
+  }
+
+  item = (oyBatchItem_s*) calloc( 1, sizeof(oyBatchItem_s) );
+  item->release = oyBatchItem_Release_;
+  item->batch = batch;
+  item->input = strdup( input );
+  item->output = batchOutputName( batch->output_dir, input );
+  item->cc = cc;
+
+  return item;
+}
+
+/* convert all files from batch into output_dir; return error */
+static int convertBatch              ( const char        * batch_name,
+                                       const char        * output_dir,
+                                       const char        * output_profile,
+                                       const char        * device_link,
+                                       oyOptions_s       * module_options,
+                                       uint32_t            icc_profile_flags,
+                                       uint32_t            flags,
+                                       int                 jobs,
+                                       int                 verbose )
+{
+  oyBatch_s batch;
+  char ** files;
+  int n = 0, i = 0, error = 0;
+  double clck = oyClock();
+
+  memset( &batch, 0, sizeof(batch) );
+  batch.module_options = module_options;
+  batch.icc_profile_flags = icc_profile_flags;
+  batch.flags = flags;
+  batch.output_dir = output_dir;
+  batch.verbose = verbose;
+  if(jobs < 1)
+    jobs = 4;
+
+  if(!output_dir || !oyIsDir_( output_dir ))
+  {
+    WARNc2_S( "%s: %s", _("Output directory not found"), oyNoEmptyString_m_(output_dir) );
+    return 1;
+  }
+
+  if(device_link)
+  {
+    batch.device_link = oyProfile_FromName( device_link, icc_profile_flags, 0 );
+    if(!batch.device_link)
+    {
+      WARNc1_S( "Could not open profile: %s", device_link );
+      return 1;
+    }
+    if(!output_profile)
+    {
+      /* the last profile in the link sequence is the output profile */
+      oyProfileTag_s * psid = oyProfile_GetTagById( batch.device_link, icSigProfileSequenceIdentifierTag );
+      int32_t texts_n = 0;
+      char ** texts = oyProfileTag_GetText( psid, &texts_n, 0,0,0,0 );
+      int count = (texts_n-1)/5;
+
+      oyProfileTag_Release( &psid );
+      oyStringListRelease_( &texts, texts_n, oyDeAllocateFunc_ );
+      output_profile = oyProfile_GetFileName( batch.device_link, count - 1 );
+    }
+  }
+  if(output_profile)
+    batch.output_profile = oyProfile_FromName( output_profile, icc_profile_flags, 0 );
+  if(!batch.output_profile)
+  {
+    WARNc1_S( "Could not open output profile: %s", oyNoEmptyString_m_(output_profile) );
+    oyProfile_Release( &batch.device_link );
+    return 1;
+  }
+
+  files = listBatch( batch_name, &n );
+  if(!n)
+    WARNc2_S( "%s: %s", _("No image files found"), batch_name );
+
+  while(i < n || batch.in_flight)
+  {
+    int done = batch.done;
+
+    /* encode a finished image first, to free its memory */
+    if(batch.in_flight)
+      oyJobResult();
+
+    if(i < n && batch.in_flight < jobs)
+    {
+      oyBatchItem_s * item = batchItemNew( &batch, files[i++] );
+      oyJob_s * job;
+
+      if(!item)
+      {
+        ++batch.failed;
+        continue;
+      }
+
+      job = oyJob_New( NULL );
+      job->context = (oyStruct_s*) item;
+      job->work = oyBatchItem_Work_;
+      job->finish = oyBatchItem_Finish_;
+      job->cb_progress = NULL;
+      ++batch.in_flight;
+      oyJob_Add( &job, 0, 0 );
+      /* no threads handler, as oyJob_Add() did not take the job; stay serial */
+      if(job)
+      {
+        job->work( job );
+        job->finish( job );
+        oyJob_Release( &job );
+      }
+    }
+    else if(done == batch.done)
+      usleep( 1000 );
+  }
+
+  fprintf( stderr, "%s: %d/%d %s, %d %s, %.03f s\n", _("Batch"),
+           batch.converted, n, _("images converted"),
+           jobs, _("images in flight"), (oyClock() - clck) / 1000000.0 );
+  fprintf( stderr, "  %-8s %.03f s\n  %-8s %.03f s\n  %-8s %.03f s (%s)\n  %-8s %.03f s\n",
+           _("decode"), batch.decode / 1000000.0,
+           _("link"), batch.link / 1000000.0,
+           _("convert"), batch.convert / 1000000.0, _("summed over threads"),
+           _("encode"), batch.encode / 1000000.0 );
+
+  error = batch.failed > 0;
+
+  oyStringListRelease_( &files, n, oyDeAllocateFunc_ );
+  oyProfile_Release( &batch.output_profile );
+  oyProfile_Release( &batch.device_link );
+
+  return error;
+}
+
 /* This function is called the
  * * first time for GUI generation and then
  * * for executing the tool.
@@ -379,6 +759,8 @@ int myMain( int argc, const char ** argv )
   const char * output_profile = 0;
   const char * device_link = 0;
   const char * input = 0;
+  const char * batch = 0;
+  int jobs = 0;
   const char * output = 0;
   const char * node_name = 0;
   int effect_profile_count = 0;
@@ -397,6 +779,7 @@ int myMain( int argc, const char ** argv )
   const char * render = 0;
   int verbose = 0;
   int version = 0;
+  int stats = 0;
 
   /* handle options */
   /* declare the option choices  *   nick,          name,               description,                  help */
@@ -417,12 +800,14 @@ int myMain( int argc, const char ** argv )
 
   oyjlOptionChoice_s E_choices[] = {{"OY_DEBUG", _("set the Oyranos debug level."),_("Alternatively the -v option can be used."),_("Valid integer range is from 1-20.")},
                                     {"OY_MODULE_PATH",_("route Oyranos to additional directories containing modules."),NULL,                         NULL},
+                                    {"OY_STATS",_("count filter node runs, pixels and times."),_("Alternatively the --stats option can be used."),NULL},
                                     {"XDG_CONFIG_HOME",_("search paths are influenced by the XDG_CONFIG_HOME shell variable."),NULL,                         NULL},
                                     {NULL,NULL,NULL,NULL}};
 
   oyjlOptionChoice_s A_choices[] = {{"",_("Get ICC profile"),_("oyranos-icc -f icc -i image.png | iccexamin -g -i"),                          NULL},
                                     {"",_("Convert image to ICC Color Space"),_("oyranos-icc -i image.png -n lcm2 -p Lab.icc -o image.ppm"),  NULL},
                                     {"",_("Convert image through ICC device link profile"),_("oyranos-icc -i image.png --device-link deviceLink.icc -o image.ppm"),NULL},
+                                    {"",_("Convert all images of a directory"),_("oyranos-icc --batch=images/ -j 8 -p sRGB.icc -o converted/"),NULL},
                                     {"",_("Get Conversion"),_("oyranos-icc -f icc -i input.icc -n lcm2 -p sRGB.icc -o device_link.icc"),      NULL},
                                     {"",_("Create 3D CLUT"),_("oyranos-icc -f clut -i Lab.icc -n lcm2 -p sRGB.icc -o clut.ppm"),              NULL},
                                     {"",_("Play Movie with ffmpeg"),_("oyranos-icc -f=cube -i=web -p=\"`oyranos-monitor -lc -d=1 --path`\" -o monitor-1.cube; ffplay -vf \"lut3d=monitor-1.cube\" -i movie.mp4"),              NULL},
@@ -444,6 +829,10 @@ int myMain( int argc, const char ** argv )
         oyjlOPTIONTYPE_FUNCTION, {.getChoices = listDeviceLinkProfiles},                oyjlSTRING,    {.s=&device_link}, NULL},
     {"oiwi", OYJL_OPTION_FLAG_EDITABLE,  "i","input",         NULL,     _("Input"),    _("Read from file"),          NULL, _("FILE_NAME"),
         oyjlOPTIONTYPE_FUNCTION, {.getChoices = listInput},                oyjlSTRING,{.s=&input}, NULL},
+    {"oiwi", OYJL_OPTION_FLAG_EDITABLE,  NULL,"batch",         NULL,     _("Batch"),    _("Convert many images in one process"),_("A directory with images or a text file with one image file name per line. -o names the output directory. The output files keep the input base names. Other formats than PNG and PPM are written as PNG."), _("FILE_OR_DIR_NAME"),
+        oyjlOPTIONTYPE_CHOICE,   {0},                oyjlSTRING,    {.s=&batch}, NULL},
+    {"oiwi", OYJL_OPTION_FLAG_EDITABLE,  "j","jobs",          NULL,     _("Jobs"),     _("Images in flight"),        _("Caps the count of decoded images waiting for conversion or encoding and thus the memory use. Defaults to 4."), _("NUMBER"),
+        oyjlOPTIONTYPE_DOUBLE,   {.dbl.start = 1, .dbl.end = 64, .dbl.tick = 1, .dbl.d = 4}, oyjlINT, {.i=&jobs}, NULL},
     {"oiwi", OYJL_OPTION_FLAG_EDITABLE,  "o","output",        NULL,     _("Output"),   _("Write to file"),           _("For Convert Image currently only PPM and PNG formats. For -f clut currently only PPM format, CLUT is a levels x levels*levels sized PPM."),_("FILE_NAME"),     
         oyjlOPTIONTYPE_CHOICE,   {0},                oyjlSTRING,    {.s=&output}, NULL},
     {"oiwi", 0,                          "n","node-name",     NULL,     _("Node Name"),_("Module name"),             NULL, _("MODULE_NAME"),
@@ -479,6 +868,7 @@ int myMain( int argc, const char ** argv )
     {"oiwi", OYJL_OPTION_FLAG_ACCEPT_NO_ARG, "h", "help",NULL,NULL,NULL,NULL, NULL, oyjlOPTIONTYPE_NONE, {0}, oyjlSTRING, {.s=&help}, NULL },
     {"oiwi", 0, NULL,"synopsis",NULL, NULL,         NULL,         NULL, NULL, oyjlOPTIONTYPE_NONE, {0}, oyjlNONE, {0}, NULL },
     {"oiwi", 0, "v", "verbose", NULL, _("verbose"), _("verbose"), NULL, NULL, oyjlOPTIONTYPE_NONE, {0}, oyjlINT, {.i=&verbose}, NULL },
+    {"oiwi", 0, NULL,"stats",   NULL, _("Statistics"), _("Print filter node counters as JSON to stderr"), NULL, NULL, oyjlOPTIONTYPE_NONE, {0}, oyjlINT, {.i=&stats}, NULL },
     {"oiwi", 0, "V", "version", NULL, _("version"), _("Version"), NULL, NULL, oyjlOPTIONTYPE_NONE, {0}, oyjlINT, {.i=&version}, NULL },
     /* default option template -X|--export */
     {"oiwi", 0, "X", "export", NULL, NULL, NULL, NULL, NULL, oyjlOPTIONTYPE_CHOICE, {.choices.list = NULL}, oyjlSTRING, {.s=&export_var}, NULL },
@@ -491,11 +881,12 @@ int myMain( int argc, const char ** argv )
   oyjlOptionGroup_s groups[] = {
   /* type,   flags, name,               description,                  help,               mandatory,     optional,      detail */
     {"oiwg", 0,     NULL,               _("Convert Image"),           NULL,               "p|device-link,i","o,n,e,s,levels","i,p,device-link,s,e,o", NULL},
+    {"oiwg", 0,     NULL,               _("Convert Images in Batch"), _("Decoding, conversion and encoding of the images overlap. A per stage timing summary is printed."),"batch,p|device-link,o","n,e,s,j","batch,p,device-link,s,e,o,j", NULL},
     {"oiwg", 0,     NULL,               _("Generate CLUT Image"),     _("Use the -f clut argument. -i shall provide the Input Color Space."),"f,p",         "i,o,n,e,s,levels","f,i,p,s,e,o,levels", NULL},
     {"oiwg", 0,     NULL,               _("Generate Device Link Profile"),_("Use the -f icc argument."),"f,p,i",       "o,n",         "f,uint8,uint16,half,float,double", NULL},
     {"oiwg", 0,     NULL,               _("Extract ICC profile"),     _("Use the -f icc argument."),"f,i",         "o,n",         "f,o", NULL},
     {"oiwg", 0,     NULL,               _("Generate Image"),          _("Use the -f hald|slice|lab arguments."),"f",           "o,levels",    "f,o,levels", NULL},
-    {"oiwg", OYJL_GROUP_FLAG_GENERAL_OPTS,NULL,               _("General options"),         NULL,               "X|h|V|R",     "v",           "n,d,h,X,R,V,v", NULL},
+    {"oiwg", OYJL_GROUP_FLAG_GENERAL_OPTS,NULL,               _("General options"),         NULL,               "X|h|V|R",     "v,stats",     "n,d,h,X,R,V,v,stats", NULL},
     {"",0,0,0,0,0,0,0,0}
   };
 
@@ -678,6 +1069,9 @@ int myMain( int argc, const char ** argv )
     fprintf( stderr, "  Oyranos v%s\n",
                   oyNoEmptyName_m_(oyVersionString(1)));
 
+  if(stats)
+    oy_stats = 1;
+
 #if 1
   if(other_args)
   {
@@ -779,6 +1173,12 @@ int myMain( int argc, const char ** argv )
     }
 
 
+    if(batch)
+    {
+      error = convertBatch( batch, output, output_profile, device_link,
+                            module_options, icc_profile_flags, flags,
+                            jobs, verbose );
+    } else
     if(format &&
        ( oyStringCaseCmp_(format,"clut") == 0 ||
          oyStringCaseCmp_(format,"cube") == 0
@@ -841,6 +1241,8 @@ int myMain( int argc, const char ** argv )
 
       error = oyConversion_RunPixels( cc, 0 );
       image = oyConversion_GetImage( cc, OY_OUTPUT );
+      if(oy_stats)
+        printStats( cc );
 
       if(oyStringCaseCmp_(format,"cube") == 0)
         error = oyImage_WriteCUBE( image, output, comment);
@@ -977,6 +1379,8 @@ int myMain( int argc, const char ** argv )
 
       error = oyConversion_RunPixels( cc, 0 );
       image = oyConversion_GetImage( cc, OY_OUTPUT );
+      if(oy_stats)
+        printStats( cc );
       if(verbose)
       {
         oyFilterGraph_s * cc_graph = oyConversion_GetGraph( cc );
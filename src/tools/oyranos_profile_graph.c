@@ -49,6 +49,7 @@
 #include "oyranos_helper.h"
 #include "oyranos_helper_macros.h"
 #include "oyranos_internal.h"
+#include "oyranos_measurement.h"
 #include "oyranos_config.h"
 #include "oyranos_version.h"
 #include "oyranos_sentinel.h"
@@ -62,8 +63,6 @@
 #endif
 
 
-#include "ciexyz31_2.h" /* cieXYZ_31_2 1931 2° */
-#include "ciexyz64_1.h"
 #include "spd_A_5.h"
 #include "spd_D65_5.h"
 #include "spd_S1S2S3_5.h"
@@ -90,11 +89,6 @@ int      oyXYZ2sRGB ( double * rgb );
 void     oyLCh2Lab                   ( const double        i[],
                                        double              o[],
                                        void              * none OY_UNUSED );
-int      oyLabGamutCheck             ( double            * lab,
-                                       int                 count,
-                                       oyProfiles_s      * proofing,
-                                       int               * is_in_gamut,
-                                       double            * lab_tested );
 
 typedef struct { /* oyF3 three floats */
   float f[3];
@@ -115,18 +109,17 @@ double   oySpectrumGetParam  ( oyImage_s * spec, oySPECTRUM_PARAM_e mode );
 const char* oySpectrumGetString ( oyImage_s * spec, oySPECTRUM_PARAM_e mode );
 double   oySpectrumGet( oyImage_s * spec, int column, int channel );
 void        oySpectrumSetString ( oyImage_s * spec, oySPECTRUM_PARAM_e mode, char * names );
-int         oySpectrumComputeWhite( oyImage_s * spectra, int stdobs, float * illu_300_830_5nm, oyF3 *white, double * spectra_rect );
-int         oySpectrumComputeXYZ( oyImage_s * spectra, int index, float * illu_300_830_5nm, int stdobs, oyF3 *xyz );
+oySpectralWeights_s * oySpectrumCreateWeights( oyImage_s * spectra, int stdobs, float * illu_300_830_5nm );
+void        oySpectrumComputeRect( oyImage_s * spectra, double * spectra_rect );
+int         oySpectrumComputeXYZ( oyImage_s * spectra, oySpectralWeights_s * weights, double * XYZ );
 
 oyImage_s * oySpectrumFromTree    ( oyjl_val root );
 void        oySpectrumToPpm( oyImage_s * spectra, const char * input, const char * output );
 
-void        oySpecCompute ( int start, int lambda, int channel, int pos, oyF3 *xyz, oyF3 *white, double y, int stdobs, float * illu_spd );
+oyImage_s * oySpectrumFromMeasurement( oyMeasurement_s * m );
 
 oyjl_val    oyTreeFromCxf( const char * text );
-oyjl_val    oyTreeFromCsv( const char * text );
 oyImage_s * oyImage_FromVcgt( const char * fn );
-oyjl_val    oyTreeFromCgats( const char * text );
 
 int         oyTreeToCgats( oyjl_val root, int * level OYJL_UNUSED, char ** text );
 int         oyTreeToCsv( oyjl_val root, int * level, char ** text );
@@ -723,25 +716,28 @@ int myMain( int argc, const char ** argv )
     }
     if(!specT && text)
     {
-      specT = oyTreeFromCsv( text );
-      oyjlTreeSetStringF( specT, OYJL_CREATE_NEW, strchr(input,'/')?strrchr(input,'/')+1:input, "description" );
-      oyTreeFilterColors( specT, pattern );
-      spectra = oySpectrumFromTree( specT );
+      /* CSV and CGATS: fill the spectral image directly from the numeric table */
+      oyMeasurement_s * m = oyMeasurementParse( text, 0, oyMEASUREMENT_UNKNOWN );
+      if(m && m->bands)
+      {
+        specT = oyMeasurementToTree( m );
+        if(m->format == oyMEASUREMENT_CSV)
+          oyjlTreeSetStringF( specT, OYJL_CREATE_NEW, strchr(input,'/')?strrchr(input,'/')+1:input, "description" );
+        if(pattern)
+        {
+          oyTreeFilterColors( specT, pattern );
+          spectra = oySpectrumFromTree( specT );
+        } else
+          spectra = oySpectrumFromMeasurement( m );
+      }
       if(!spectra)
       {
         oyjlTreeFree(specT);
         specT = NULL;
       }
-      if(verbose && spectra) fprintf( stderr, "CSV parsed\n" );
-      if(oy_debug) fprintf( stderr, "%s", oyStruct_GetText((oyStruct_s*)spectra, oyNAME_NAME, 0));
-    }
-    if(!specT && text && data_format <= 0)
-    {
-      specT = oyTreeFromCgats( text );
-      oyTreeFilterColors( specT, pattern );
-      spectra = oySpectrumFromTree( specT );
-      if(verbose && spectra) fprintf( stderr, "CGATS parsed\n" );
+      if(verbose && spectra) fprintf( stderr, "%s parsed\n", m->format == oyMEASUREMENT_CGATS ? "CGATS" : m->format == oyMEASUREMENT_CXF ? "CxF" : "CSV" );
       if(oy_debug) fprintf( stderr, "%s", oyStruct_GetText((oyStruct_s*)spectra, oyNAME_NAME, 0));
+      oyMeasurementRelease( &m );
     }
 
     if(spectra)
@@ -782,14 +778,28 @@ int myMain( int argc, const char ** argv )
       spectral_count = (int)oySpectrumGetParam( spectra, oySPECTRUM_COLUMNS );
       spectra_XYZ = (oyF3*) calloc( (unsigned)spectral_count, sizeof(oyF3) );
 
-      oySpectrumComputeWhite( spectra, stdobs, illu_300_830_5nm, &white, spectra_rect );
+      oySpectralWeights_s * weights = oySpectrumCreateWeights( spectra, stdobs, illu_300_830_5nm );
+      double * XYZ = (double*) calloc( (unsigned)spectral_count, 3 * sizeof(double) );
+      oySpectrumComputeRect( spectra, spectra_rect );
+      if(weights && XYZ)
+      {
+        if(oySpectrumComputeXYZ( spectra, weights, XYZ ))
+          oyMessageFunc_p( oyMSG_WARN,0, "spectra with missing values" );
+        for(i = 0; i < 3; ++i)
+          white.f[i] = weights->white[i];
+      }
       for(j = 0; j < spectral_count; ++j)
       {
-        oySpectrumComputeXYZ ( spectra, j, illu_300_830_5nm, stdobs, &spectra_XYZ[j] );
+        /* keep the unscaled sums */
+        if(weights && XYZ)
+          for(i = 0; i < 3; ++i)
+            spectra_XYZ[j].f[i] = XYZ[j*3 + i] * weights->white[1];
         double computedXYZ_Y = spectra_XYZ[j].f[1]/white.f[0];
         if(luminance_spec && CIE_Y_max < computedXYZ_Y)
           CIE_Y_max = computedXYZ_Y;
       }
+      oySpectralWeightsRelease( &weights );
+      if(XYZ) free( XYZ );
 
       if(fabs(spectra_rect[3]) > fabs(spectra_rect[2]))
         scale = spectra_rect[3];
@@ -919,10 +929,11 @@ int myMain( int argc, const char ** argv )
     int h = 0;
     char * t = NULL;
     oyStructList_s * ccs = oyStructList_New(0); /* color conversions */
+    oyStructList_s * gcs = oyStructList_New(0); /* gamut checks */
     oyProfiles_s * ps = oyProfiles_New(0);
     oyProfile_s * pLab = oyProfile_FromStd( oyASSUMED_LAB, 0, 0 );
     double color[16];
-    int * outside = NULL, index = 0;
+    int * outside = NULL, * tested = NULL, index = 0;
     double * lab = NULL;
     int count = lcount * ccount;
     oyOptions_s * module_options = NULL;
@@ -954,7 +965,8 @@ int myMain( int argc, const char ** argv )
     {
       lab = calloc( count, sizeof(double) * 3 );
       outside = calloc( count, sizeof(int) );
-      int error = !outside || !lab;
+      tested = calloc( count, sizeof(int) );
+      int error = !outside || !tested || !lab;
       if(error) return error;
       if(verbose)
         fprintf(stderr, "ccount: %d c_max: %d  lcount: %d\n", ccount, c_max, lcount );
@@ -982,6 +994,24 @@ int myMain( int argc, const char ** argv )
         error = oyStructList_MoveIn( ccs, (oyStruct_s**)&cc, i, 0 );
         if(error)
           oyMessageFunc_p( oyMSG_ERROR, NULL, "in oyStructList_MoveIn( cc ): %s", oyProfile_GetFileName( p, -1 ) );
+
+        /* one gamut check context per profile serves all pages */
+        {
+          oyProfiles_s * proofing = oyProfiles_New(0);
+          oyProfile_s * proof = oyProfile_Copy( p, NULL );
+          oyProfiles_MoveIn( proofing, &proof, -1 );
+          cc = oyConversion_CreateGamutCheck( pLab, proofing, NULL, NULL );
+          if(cc)
+            oyStructList_MoveIn( gcs, (oyStruct_s**)&cc, i, 0 );
+          else
+          {
+            /* a placeholder keeps gcs aligned with the ps indices */
+            oyOptions_s * none = oyOptions_New( 0 );
+            oyMessageFunc_p( oyMSG_ERROR, NULL, "in oyConversion_CreateGamutCheck( ): %s", oyProfile_GetFileName( p, -1 ) );
+            oyStructList_MoveIn( gcs, (oyStruct_s**)&none, i, 0 );
+          }
+          oyProfiles_Release( &proofing );
+        }
         oyProfiles_MoveIn( ps, &p, i );
       }
     }
@@ -1027,20 +1057,22 @@ int myMain( int argc, const char ** argv )
         }
         for(i = 0; i < profile_count; ++i)
         {
-          const char * filename = profile_names[i];
-          oyProfile_s * p = oyProfile_FromName( filename, pflags, NULL );
-          oyProfiles_s * proofing = oyProfiles_New(0);
-          int error;
+          oyConversion_s * gc = (oyConversion_s*) oyStructList_GetRefType( gcs, i, oyOBJECT_CONVERSION_S );
+          int error, j;
+          /* skip profiles without gamut check */
+          if(!gc)
+            continue;
           if(verbose)
-            fprintf(stderr, "proofing: %s\n", filename);
-          oyProfiles_MoveIn( proofing, &p, -1 );
-          error = oyLabGamutCheck( lab, count, proofing, outside, NULL );
+            fprintf(stderr, "proofing: %s\n", profile_names[i]);
+          error = oyConversion_GamutCheck( gc, lab, count, tested, NULL ) < 0;
+          oyConversion_Release( &gc );
           if(error)
           {
-            oyMessageFunc_p( oyMSG_ERROR, NULL, "in oyLabGamutCheck( ): %s", oyProfile_GetFileName( p, -1 ) );
+            oyMessageFunc_p( oyMSG_ERROR, NULL, "in oyConversion_GamutCheck( ): %s", profile_names[i] );
             return error;
           }
-          oyProfiles_Release( &proofing );
+          for(j = 0; j < count; ++j)
+            outside[j] |= tested[j];
         }
       }
 
@@ -1214,9 +1246,11 @@ int myMain( int argc, const char ** argv )
     }
 
     oyStructList_Release( &ccs );
+    oyStructList_Release( &gcs );
     oyProfiles_Release( &ps );
     if(lab) free(lab);
     if(outside) free(outside);
+    if(tested) free(tested);
   }
 
   /* create a surface to place our images on */
@@ -2233,9 +2267,7 @@ double * getSaturationLine_(oyProfile_s * profile, int intent, size_t * size_, o
   if(size > 1)
   {
     double * values = oyAllocateFunc_( (size+1) * sizeof(double) );
-    int i;
-    for(i = 0; i < size; ++i)
-      values[i] = oyOption_GetValueDouble( o, i );
+    oyOption_GetValueDoubles( o, values, size, 0 );
     *size_ = size/3;
     return values;
   } else
@@ -2264,104 +2296,6 @@ void         oyLCh2Lab               ( const double        i[],
   /* CIE*b = C * sin(h) */
   o[2] = i[1] * sin(M_PI*2.0*i[2])/2.0 + 0.5;
 }
-int  oyIsInRange                     ( const double        i,
-                                       const double        reference,
-                                       const double        delta )
-{ 
-  if(fabs(reference - i) < delta) return 1;
-  return 0;
-}
-int  oyColorIsProofingMarker         ( const double        i[],
-                                       double              delta )
-{ 
-  if( oyIsInRange(i[0], 0.5, delta) &&
-      oyIsInRange(i[1], 0.5, delta) &&
-      oyIsInRange(i[2], 0.5, delta) )
-    return 1;
-  return 0;
-}
-/** @brief   Lab in PCS*Lab range -> ICC profile -> inGamutTest
- *
- *  While it is possible to add multiple proofing profiles at once,
- *  the results will be washed out. It is much more precise to run
- *  this function for each proofing profile separately.
- *
- *  @param[in]     lab                 input Lab values
- *  @param[in]     count               count of 'lab' values
- *  @param[in]     space               color space for gamut boundary check; optional
- *  @param[in,out] is_outside_gamut    array with result of out of gamut test
- *  @param[in,out] lab_tested          the resulting colors
- *  @return                            results
- *                                     - -1 : no operation
- *                                     -  0 : success
- *                                     -  1 : found error
- *
- *  @version Oyranos: 0.9.7
- *  @date    2020/05/29
- *  @since   2020/03/11 (Oyranos: 0.9.7)
- */
-int      oyLabGamutCheck             ( double            * lab,
-                                       int                 count,
-                                       oyProfiles_s      * proofing,
-                                       int               * is_outside_gamut,
-                                       double            * lab_tested )
-{
-  int error = -1;
-  int icc_profile_flags = 0, i, found_outsider = 0;
-  oyProfile_s * pLab = oyProfile_FromStd( oyASSUMED_LAB, icc_profile_flags, 0 )/*,
-              * proof1 = oyProfiles_Get(proofing, 0);
-  icColorSpaceSignature csp = (icColorSpaceSignature) oyProfile_GetSignature( proof1, oySIGNATURE_COLOR_SPACE)*/;
-  double * tmp = lab_tested ? NULL : calloc( 3*count, sizeof(double) ),
-         delta = 0.01;
-  oyOptions_s * module_options = NULL;
-  oyProfiles_s * profs = oyProfiles_Copy( proofing, NULL );
-  if(!lab_tested) lab_tested = tmp;
-  if(!lab_tested) return error;
-  oyOptions_SetFromString( &module_options, OY_DEFAULT_RENDERING_INTENT, "1", OY_CREATE_NEW );
-  oyOptions_SetFromString( &module_options, OY_DEFAULT_RENDERING_BPC, "0", OY_CREATE_NEW );
-  if(oyProfiles_Count(proofing))
-  {
-    oyOptions_MoveInStruct( &module_options,
-                                       OY_PROFILES_SIMULATION,
-                                       (oyStruct_s**) &profs,
-                                       OY_CREATE_NEW );
-    oyOptions_SetFromString( &module_options, OY_DEFAULT_PROOF_SOFT, "1", OY_CREATE_NEW );
-    oyOptions_SetFromString( &module_options, OY_DEFAULT_RENDERING_GAMUT_WARNING, "1", OY_CREATE_NEW ); /* This option expands the grid size and slows the initial context creation down. However, it is needed for precise enough output. */
-    oyOptions_SetFromString( &module_options, OY_DEFAULT_RENDERING_INTENT_PROOF, "3", OY_CREATE_NEW );
-  }
-  oyConversion_s * cc = oyConversion_CreateBasicPixelsFromBuffers (
-                                       pLab, lab, oyDataType_m(oyDOUBLE),
-                                       pLab, lab_tested, oyDataType_m(oyDOUBLE),
-                                       module_options, count );
-  error = !cc;
-  oyConversion_RunPixels( cc, 0 );
-
-  for(i = 0; i < count; ++i)
-  {
-    int is_outside = is_outside_gamut[i];
-    if(is_outside) continue;
-    if(oyColorIsProofingMarker( &lab[i*3], delta + 0.02 )) /* test source in greater range */
-      is_outside = 0;
-    else
-      is_outside = oyColorIsProofingMarker(&lab_tested[i*3], delta);
-    if(is_outside)
-    {
-      ++found_outsider;
-      is_outside_gamut[i] = is_outside;
-    }
-  }
-  /*if((csp == icSigCmykData || csp == icSigRgbData) && found_outsider == 0)
-    error = 1;*/
-
-  oyProfile_Release( &pLab );
-  oyOptions_Release( &module_options );
-  oyConversion_Release( &cc );
-  if(tmp)
-    free(tmp);
-
-  return error;
-}
-
 const char* oySpectrumGetString ( oyImage_s * spec, oySPECTRUM_PARAM_e mode )
 {
   oyOptions_s * tags;
@@ -2519,63 +2453,27 @@ double   oySpectrumGet( oyImage_s * spec, int pos, int channel )
   return dbl[channel];
 }
 
-/** compute accumulative CIE*XYZ for single spectral value using the Std 2° CMF and custom illuminant
+/** create CIE*XYZ weights for the band layout of a spectral image
  *
- *  @param[in]     start               spectrum start
- *  @param[in]     lambda              spectral step size
- *  @param[in]     channel             spectral step to use for computing
- *  @param[in]     pos                 the position of the pixel
- *  @parem[in,out] xyz                 the accumulated XYZ triple
- *  @param[out]    white               the white point
- *  @param[in]     y                   spectral value in nm
+ *  @param[in]     spectra             spectral image
  *  @param[in]     stdobs              standard observer; typical 2 for 2°, or 10 for 10°
- *  @param[in]     illu_spd            the illuminant spectrum, with start @300nm and 5nm lambda
+ *  @param[in]     illu_300_830_5nm    illuminant spd 300-830nm lambda 5nm
  */
-void        oySpecCompute ( int start, int lambda, int channel, int pos, oyF3 *xyz, oyF3 *white, double y, int stdobs, float * illu_spd )
+oySpectralWeights_s * oySpectrumCreateWeights( oyImage_s * spectra, int stdobs, float * illu_300_830_5nm )
 {
-  int cmf_startNM = 360;
-  int cmf_start_pos = start - cmf_startNM;
-  int illu_startNM = 300;
-  int illu_start_pos = (start - illu_startNM) / 5;
-
-  if( lambda%5 == 0 && start >= cmf_startNM )
-  {
-    double illu = 1.0;
-    if(illu_spd)
-      illu = illu_spd[illu_start_pos + channel*lambda/5] / 100.0; /* D50 max ~103 */
-    int k;
-    for(k = 0; k < 3; ++k)
-    {
-      double spd = 0.0;
-      double weigthed = 0.0;
-
-      if(stdobs == 2)
-        spd = cieXYZ_31_2[1 + cmf_start_pos + channel*lambda][k];
-      else if(stdobs == 10)
-        spd = cieXYZ_64_10[cmf_start_pos + channel*lambda][k];
-      weigthed = y * illu * spd;
-
-      if(xyz)
-        xyz->f[k] += weigthed;
-      if(pos == 0)
-      {
-        weigthed = 1.0 * illu * spd;
-        if(white)
-          white->f[k] += weigthed;
-      }
-    }
-  } else
-    oyMessageFunc_p( oyMSG_ERROR,0, "need lambda of %5, got: %d; start: %d spd_start: %d", lambda%5, start, cmf_startNM );
+  int lambda = (int)(oySpectrumGetParam( spectra, oySPECTRUM_LAMBDA ) + 0.5);
+  int start = (int)(oySpectrumGetParam( spectra, oySPECTRUM_START ) + 0.5);
+  int spectral_channels = (int)oySpectrumGetParam( spectra, oySPECTRUM_CHANNELS );
+
+  return oySpectralWeightsCreate( start, lambda, spectral_channels, stdobs, illu_300_830_5nm );
 }
 
-int         oySpectrumComputeWhite( oyImage_s * spectra, int stdobs, float * illu_300_830_5nm, oyF3 *white, double * spectra_rect )
+void        oySpectrumComputeRect( oyImage_s * spectra, double * spectra_rect )
 {
-  int error = 0, i,j;
+  int i,j;
 
   if(spectra)
   {
-    int lambda = oySpectrumGetParam( spectra, oySPECTRUM_LAMBDA );
-    int start = oySpectrumGetParam( spectra, oySPECTRUM_START );
     int spectral_channels = oySpectrumGetParam( spectra, oySPECTRUM_CHANNELS );
     int spectral_count = oySpectrumGetParam( spectra, oySPECTRUM_COLUMNS );
     for(i = 0; i < spectral_channels; ++i)
@@ -2583,10 +2481,14 @@ int         oySpectrumComputeWhite( oyImage_s * spectra, int stdobs, float * ill
       float x = oySpectrumGet( spectra, -1, i );
       if(x < spectra_rect[0]) spectra_rect[0] = x;
       if(x > spectra_rect[1]) spectra_rect[1] = x;
-      for(j = 0; j < spectral_count; ++j)
+    }
+    for(j = 0; j < spectral_count; ++j)
+    {
+      int is_allocated = 0;
+      double * dbl = (double*) oyImage_GetPointF(spectra)( spectra, j,0,-1, &is_allocated );
+      for(i = 0; i < spectral_channels; ++i)
       {
-        double y = oySpectrumGet( spectra, j, i );
-        oySpecCompute ( start, lambda, i, j, NULL, white, y, stdobs, illu_300_830_5nm );
+        double y = dbl[i];
         if(isnan(y))
           continue;
         if(y < spectra_rect[2]) spectra_rect[2] = y;
@@ -2594,48 +2496,30 @@ int         oySpectrumComputeWhite( oyImage_s * spectra, int stdobs, float * ill
       }
     }
   }
-
-  return error;
 }
 
-/** compute CIE*XYZ for spectral color using the Std 2° CMF and custom illuminant
+/** compute CIE*XYZ for all spectral colors
+ *
+ *  The spectral image keeps all columns in one continuous line.
  *
  *  @param[in]     spectra             spectral image
- *  @param[in]     index               position in color list
- *  @param[in]     illu_300_830_5nm    illuminant spd 300-830nm lambda 5nm
- *  @param[out]    xyz                 ICC*XYZ triple
+ *  @param[in]     weights             from oySpectrumCreateWeights()
+ *  @param[out]    XYZ                 ICC*XYZ triple per column; perfect reflector Y = 1.0
+ *  @return                            spectra with missing values
  */
-int         oySpectrumComputeXYZ( oyImage_s * spectra, int index, float * illu_300_830_5nm, int stdobs, oyF3 *xyz )
+int         oySpectrumComputeXYZ( oyImage_s * spectra, oySpectralWeights_s * weights, double * XYZ )
 {
-  int error = 0, i, j = index;
-
-  if(spectra)
-  {
-    int lambda = oySpectrumGetParam( spectra, oySPECTRUM_LAMBDA );
-    int start = oySpectrumGetParam( spectra, oySPECTRUM_START );
-    int spectral_channels = oySpectrumGetParam( spectra, oySPECTRUM_CHANNELS );
-    int spectral_count = oySpectrumGetParam( spectra, oySPECTRUM_COLUMNS );
+  int is_allocated = 0;
+  double * dbl;
 
-    if(j >= spectral_count)
-    {
-      error = 1;
-      oyMessageFunc_p(oyMSG_ERROR,0,"Index out of range %d max: %d", j, spectral_count);
-      return error;
-    }
+  if(!spectra || !weights)
+    return 1;
 
-    for(i = 0; i < spectral_channels; ++i)
-    {
-      double y = oySpectrumGet( spectra, j, i );
-      oySpecCompute ( start, lambda, i, j, xyz, NULL, y, stdobs, illu_300_830_5nm );
-      if(isnan(y))
-      {
-        error = 1;
-        continue;
-      }
-    }
-  }
+  dbl = (double*) oyImage_GetPointF(spectra)( spectra, 0,0,-1, &is_allocated );
 
-  return error;
+  return oySpectralToXYZ( weights, dbl,
+                          (int)oySpectrumGetParam( spectra, oySPECTRUM_COLUMNS ),
+                          0, XYZ );
 }
 
 static oyConversion_s * oy_xyz_srgb = NULL;
@@ -2942,34 +2826,6 @@ int      oyDXXCIEfromTemperature( double kelvin, float ** SPD )
   return error;
 }
 
-int oyCSVglines( const char * text )
-{
-  int lines = 0;
-  if(text)
-  {
-    int len = strlen(text), i;
-    int last_line_break = 0;
-    for(i = 0; i < len; ++i)
-      if(text[i] == '\n')
-      {
-        ++lines;
-        last_line_break = i;
-      }
-    if(last_line_break < len - 3)
-      ++lines;
-  }
-  return lines;
-}
-double oyCSVparseDouble( const char * text )
-{
-  double v = -1;
-  if(text)
-  {
-    int r = oyjlStringToDouble( text, &v, 0,0 );
-    if(r <= 0) return v;
-  }
-  return v;
-}
 int oyIsNumber( const char c )
 {
   if(((int)'0' <= (int)c &&
@@ -2983,27 +2839,6 @@ int oyIsNumber( const char c )
     return 1;
   return 0;
 }
-int oyCSVgetColumns( const char * text )
-{
-  int len = oyStrlen_(text), i;
-  int pixels = 0;
-  for(i = 0; i < len; ++i)
-  {
-    char c = text[i];
-    int is_line_break = 0;
-    if(oyIsNumber(c))
-      continue; /* is a number */
-    else if(c == ',')
-      ++pixels;
-    else if(c == '\n')
-      is_line_break = 1;
-    else
-      return pixels;
-    if(is_line_break)
-      return pixels ? pixels : i?1:0;
-  }
-  return pixels;
-}
 const char * oySkipHeaderComment   ( const char * text, const char ** table_header )
 {
   if(oyIsNumber( text[0] )) return text;
@@ -3017,98 +2852,6 @@ const char * oySkipHeaderComment   ( const char * text, const char ** table_head
   }
   return NULL;
 }
-oyjl_val    oyTreeFromCsv( const char * text )
-{
-  oyjl_val specT = NULL;
-  int pixels = 0,
-      lines = 0,
-      cols = 0;
-  float nm, start, end, lambda;
-  double d;
-  const char * header_start = NULL;
-  char * header = NULL, * t, ** hlist = NULL;
-  if(!text) return specT;
-  text = oySkipHeaderComment( text, &header_start );
-  if(header_start)
-  {
-    header = oyjlStringCopy( header_start, 0 );
-    t = strchr( header, '\n' );
-    if(t)
-      t[0] = '\000';
-    hlist = oyjlStringSplit( header, ',', &cols, 0 );
-  }
-  pixels = oyCSVgetColumns( text );
-  lines = oyCSVglines( text );
-  if(verbose)
-    fprintf( stderr, "lines: %d\n", lines );
-
-  if(pixels >= 1)
-  {
-    int i,index;
-    specT = oyjlTreeNew( "" );
-    oyjlTreeSetStringF( specT, OYJL_CREATE_NEW, "ncc1", "type" );
-    oyjlTreeSetStringF( specT, OYJL_CREATE_NEW, "Named Color Collection v1", "comment" );
-    for(index = 0; index < pixels; ++index)
-      if(cols-1 == pixels)
-      {
-        int len;
-        /* remove guarding quotes */
-        t = hlist[index + 1];
-        if(t[0] == '\"')
-          ++t;
-        len = strlen(t);
-        if(t[len-1] == '\"')
-          t[len-1] = '\000';
-        oyjlTreeSetStringF( specT, OYJL_CREATE_NEW, t, "collection/[0]/colors/[%d]/name", index + 1 );
-      } else
-        oyjlTreeSetStringF( specT, OYJL_CREATE_NEW, "", "collection/[0]/colors/[%d]/name", index + 1 );
-
-    for(i = 0; i < lines; ++i)
-    {
-      const char * endl;
-
-      if(!text) continue;
-      endl = strchr( text, '\n' );
-      if(!endl)
-      {
-        int len = strlen(text);
-        if(len > 2)
-          endl = text + len;
-      }
-      nm = oyCSVparseDouble(text);
-      if(i == 0) start = nm;
-      else if(i == 1) lambda = nm - start;
-      else if(i == lines-1) end = nm;
-
-      if(verbose > 1) fprintf( stderr, "%d lamda: %f ", i, nm );
-
-      for(index = 0; index < pixels; ++index)
-      {
-        if(text)
-          text = strchr( text, ',' );
-        if(text && text < endl && text[0] != '\r' && text[1] != '\r')
-        {
-          d = oyCSVparseDouble(++text);
-          oyjlTreeSetDoubleF( specT, OYJL_CREATE_NEW, d, "collection/[0]/colors/[%d]/spectral/0/data/[%d]", index, i );
-        }
-      }
-
-      if(text)
-      {
-        text = strchr( text, '\n' );
-        if(text) ++text;
-
-        if(verbose > 1) fprintf( stderr, "\n" );
-      }
-    }
-    oyjlTreeSetDoubleF( specT, OYJL_CREATE_NEW, start, "collection/[0]/spectral/[0]/startNM" );
-    oyjlTreeSetDoubleF( specT, OYJL_CREATE_NEW, end, "collection/[0]/spectral/[0]/endNM" );
-    oyjlTreeSetDoubleF( specT, OYJL_CREATE_NEW, lambda, "collection/[0]/spectral/[0]/lambda" );
-    oyjlTreeSetDoubleF( specT, OYJL_CREATE_NEW, (end-start+lambda)/lambda, "collection/[0]/spectral/[0]/steps" );
-  }
-
-  return specT;
-}
 uint16_t * oyCSVparseShorts          ( const char        * text,
                                        int               * width )
 {
@@ -3191,26 +2934,6 @@ oyImage_s * oyImage_FromVcgt( const char * text )
   return img;
 }
 
-oyjl_val    oyTreeFromCgats( const char * text )
-{
-  oyOptions_s * opts = oyOptions_New(0),
-              * result = NULL;
-  oyOption_s * o = oyOption_FromRegistration(OY_TOP_SHARED OY_SLASH OY_DOMAIN_INTERNAL OY_SLASH OY_TYPE_STD OY_SLASH "cgats",0);
-  oyOption_SetFromString( o, text, 0 );
-  oyOptions_MoveIn( opts, &o, -1 );
-  oyOption_Release( &o );
-
-  oyOptions_Handle( "//"OY_TYPE_STD"/parse_cgats",
-                    opts, "parse_cgats",
-                    &result );
-
-  o = oyOptions_Find( result, "cgats.data", oyNAME_PATTERN );
-  oyPointer_s * ptr = (oyPointer_s *) oyOption_GetStruct( o, oyOBJECT_POINTER_S );
-  oyjl_val specT = (oyjl_val) oyPointer_GetPointer( ptr );
-
-  return specT;
-}
-
 oyjl_val    oyjlTreeGetValueFilteredF( oyjl_val root, int flag, const char * filter, const char * format, ... )
 {
   oyjl_val value = NULL;
@@ -3593,6 +3316,36 @@ oyImage_s * oySpectrumFromTree       ( oyjl_val root )
   return spec;
 }
 
+oyImage_s * oySpectrumFromMeasurement( oyMeasurement_s * m )
+{
+  oyImage_s * spec = NULL;
+  char * channel_names = NULL;
+  double end;
+  int index;
+
+  if(!m || !m->bands || m->lambda <= 0.0) return spec;
+
+  end = m->start + m->lambda * (m->bands - 1);
+  spec = oySpectrumCreateEmpty( m->start, end, m->lambda, m->count );
+  if(spec && oySpectrumGetParam( spec, oySPECTRUM_CHANNELS ) != m->bands)
+  {
+    oyImage_Release( &spec );
+    return spec;
+  }
+  for(index = 0; index < m->count && spec; ++index)
+  {
+    int is_allocated = 0;
+    double * dbl = (double*) oyImage_GetPointF(spec)( spec, index,0,-1, &is_allocated );
+    memcpy( dbl, &m->values[(size_t)index * m->columns + m->spectral], sizeof(double) * m->bands );
+    oyjlStringAdd( &channel_names, 0,0, "%s\"%s\"", index?",":"", m->names[index]?m->names[index]:"" );
+  }
+  if(spec)
+    oySpectrumSetString( spec, oySPECTRUM_CHANNELS, channel_names );
+  if(channel_names) free( channel_names );
+
+  return spec;
+}
+
 int oyTreeToCgats( oyjl_val root, int * level OYJL_UNUSED, char ** text )
 {
   oyjl_str t = NULL;